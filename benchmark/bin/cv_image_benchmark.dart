@@ -0,0 +1,82 @@
+import 'dart:io';
+
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv_benchmark/flutter_opencv_benchmark.dart';
+
+const String _usage = '''
+CvImage FFI 경로 벤치마크
+
+사용법: dart run bin/cv_image_benchmark.dart [옵션]
+
+  --filter=REGEX          이름이 일치하는 케이스만 실행
+  --resolutions=LIST      vga,hd,fhd,4k,12mp 중 선택 (기본: vga,hd,fhd,4k)
+  --min-time=SECONDS      케이스당 최소 측정 시간 (기본: 0.5)
+  --repetitions=N         반복 측정 횟수, 2 이상이면 median 집계 추가 (기본: 1)
+  --json=PATH             Google Benchmark 형식 JSON 저장 (src/bench/compare.py 로 비교)
+''';
+
+Future<void> main(List<String> args) async {
+  var resolutionLabels = ['vga', 'hd', 'fhd', '4k'];
+  var minTime = 0.5;
+  var repetitions = 1;
+  RegExp? filter;
+  String? jsonPath;
+
+  for (final arg in args) {
+    final separator = arg.indexOf('=');
+    final key = separator < 0 ? arg : arg.substring(0, separator);
+    final value = separator < 0 ? '' : arg.substring(separator + 1);
+    switch (key) {
+      case '--filter':
+        filter = RegExp(value);
+      case '--resolutions':
+        resolutionLabels = value.split(',');
+      case '--min-time':
+        minTime = double.parse(value);
+      case '--repetitions':
+        repetitions = int.parse(value);
+      case '--json':
+        jsonPath = value;
+      case '--help' || '-h':
+        stdout.write(_usage);
+        return;
+      default:
+        stderr.write('알 수 없는 옵션: $arg\n\n$_usage');
+        exitCode = 64;
+        return;
+    }
+  }
+
+  final resolutions = <Resolution>[];
+  for (final label in resolutionLabels) {
+    final matches = kResolutions.where((r) => r.label == label);
+    if (matches.isEmpty) {
+      stderr.writeln('알 수 없는 해상도: $label');
+      exitCode = 64;
+      return;
+    }
+    resolutions.add(matches.first);
+  }
+
+  stdout.writeln('OpenCV ${opencvVersion()}, ${Platform.numberOfProcessors} CPUs');
+  stdout.writeln(Platform.version);
+  stdout.writeln();
+
+  final inputs = InputCache();
+  try {
+    final results = await runBenchmarks(
+      [...callOverheadBenchmarks(), ...codecBenchmarks(resolutions, inputs)],
+      BenchmarkOptions(
+        minTime: Duration(microseconds: (minTime * 1e6).round()),
+        repetitions: repetitions,
+        filter: filter,
+      ),
+    );
+    if (jsonPath != null) {
+      writeJson(jsonPath, results, repetitions);
+      stdout.writeln('\n$jsonPath 저장');
+    }
+  } finally {
+    inputs.dispose();
+  }
+}
@@ -0,0 +1,3 @@
+export 'src/cases.dart';
+export 'src/harness.dart';
+export 'src/inputs.dart';
@@ -0,0 +1,206 @@
+import 'dart:ffi' as ffi;
+import 'dart:isolate';
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+
+import 'harness.dart';
+import 'inputs.dart';
+
+/// 측정 결과가 버려지지 않도록 보관
+int _sink = 0;
+
+/// isolate_image_processor.dart 의 isolateApplyFilter (FilterType.none) 와 같은 경로:
+/// 디코드 -> JPEG 인코드 (`encode()` 의 toList 복사) -> Uint8List 복사
+Uint8List? decodeEncodeJpeg(Uint8List imageBytes) {
+  final image = CvImage.fromBytes(imageBytes);
+  if (image == null) {
+    return null;
+  }
+  final bytes = image.encode(ext: '.jpg');
+  image.dispose();
+  return Uint8List.fromList(bytes);
+}
+
+/// 네이티브 플랫폼의 `compute()` 와 동일한 `Isolate.run` 호출
+///
+/// 클로저 컨텍스트에 바이트만 담기도록 별도 함수로 분리합니다.
+Future<Uint8List?> computeDecodeEncodeJpeg(Uint8List imageBytes) {
+  return Isolate.run(
+    () => decodeEncodeJpeg(imageBytes),
+    debugName: 'decodeEncodeJpeg',
+  );
+}
+
+/// `encode()` 에서 toList 복사만 뺀 경로. [copy] 가 true 면 Uint8List 로 memcpy
+void _encodeRaw(CvImage image, String ext, {required bool copy}) {
+  final extC = ext.toNativeUtf8();
+  try {
+    final result = bindings.cv_imencode(extC.cast(), image.pointer);
+    if (result.data == ffi.nullptr) {
+      throw Exception('Failed to encode image');
+    }
+    final view = result.data.asTypedList(result.len);
+    _sink += copy ? Uint8List.fromList(view).length : view[0];
+    bindings.cv_free_bytes(result);
+  } finally {
+    malloc.free(extC);
+  }
+}
+
+/// 해상도와 무관한 호출 단위 비용: FFI 전환, NativeFinalizer attach/detach
+List<BenchmarkCase> callOverheadBenchmarks() {
+  const calls = 1000;
+  late CvImage small;
+  void setUp() {
+    small = CvImage.fromBytes(syntheticPpm(16, 16))!;
+  }
+
+  void tearDown() => small.dispose();
+
+  return [
+    BenchmarkCase(
+      'dart_ffi/cv_mat_width',
+      () {
+        final ptr = small.pointer;
+        var sum = 0;
+        for (var i = 0; i < calls; i++) {
+          sum += bindings.cv_mat_width(ptr);
+        }
+        _sink += sum;
+      },
+      opsPerRun: calls,
+      setUp: setUp,
+      tearDown: tearDown,
+    ),
+    BenchmarkCase(
+      'dart_ffi/CvImage.width',
+      () {
+        var sum = 0;
+        for (var i = 0; i < calls; i++) {
+          sum += small.width;
+        }
+        _sink += sum;
+      },
+      opsPerRun: calls,
+      setUp: setUp,
+      tearDown: tearDown,
+    ),
+    // 영상 하나를 검사할 때 흔히 쓰는 width/height/channels 조합 (op 1 회 = 호출 3 회)
+    BenchmarkCase(
+      'dart_ffi/CvImage.width+height+channels',
+      () {
+        var sum = 0;
+        for (var i = 0; i < calls; i++) {
+          sum += small.width + small.height + small.channels;
+        }
+        _sink += sum;
+      },
+      opsPerRun: calls,
+      setUp: setUp,
+      tearDown: tearDown,
+    ),
+    // 위와 같은 속성 (+ 타입/행 간격/연속성) 을 cv_mat_info 한 번으로 조회
+    BenchmarkCase(
+      'dart_ffi/CvImage.info',
+      () {
+        var sum = 0;
+        for (var i = 0; i < calls; i++) {
+          final info = small.info;
+          sum += info.width + info.height + info.channels;
+        }
+        _sink += sum;
+      },
+      opsPerRun: calls,
+      setUp: setUp,
+      tearDown: tearDown,
+    ),
+    // NativeFinalizer 없이 생성/해제 (아래 wrap 케이스와의 차이가 attach/detach 비용)
+    BenchmarkCase(
+      'dart_cvimage/create_release_raw',
+      () {
+        for (var i = 0; i < 100; i++) {
+          bindings.cv_mat_release(bindings.cv_mat_create());
+        }
+      },
+      opsPerRun: 100,
+    ),
+    BenchmarkCase(
+      'dart_cvimage/wrap_dispose',
+      () {
+        for (var i = 0; i < 100; i++) {
+          CvImage.wrap(bindings.cv_mat_create()).dispose();
+        }
+      },
+      opsPerRun: 100,
+    ),
+    // dispose 를 호출하지 않아 GC 가 finalizer 로 해제하는 경로
+    BenchmarkCase(
+      'dart_cvimage/wrap_gc_finalize',
+      () {
+        for (var i = 0; i < 100; i++) {
+          _sink += CvImage.wrap(bindings.cv_mat_create()).hashCode & 1;
+        }
+      },
+      opsPerRun: 100,
+    ),
+    // 작은 영상 연산 1 회: FFI 전환 + 네이티브 할당 + 결과 CvImage attach/dispose
+    BenchmarkCase(
+      'dart_cvimage/flip_16x16_dispose',
+      () {
+        for (var i = 0; i < 100; i++) {
+          small.flip(1).dispose();
+        }
+      },
+      opsPerRun: 100,
+      setUp: setUp,
+      tearDown: tearDown,
+    ),
+  ];
+}
+
+/// 해상도별 인코드/디코드 및 compute() 왕복 비용
+List<BenchmarkCase> codecBenchmarks(
+  List<Resolution> resolutions,
+  InputCache inputs,
+) {
+  final cases = <BenchmarkCase>[];
+  for (final resolution in resolutions) {
+    final suffix = resolution.suffix;
+    for (final ext in const ['.jpg', '.png']) {
+      final format = ext.substring(1);
+      cases.addAll([
+        // 공개 API: encode() 는 asTypedList(...).toList() 로 List<int> 를 만듦
+        BenchmarkCase(
+          'dart_encode/$format/$suffix',
+          () => _sink += inputs[resolution].image.encode(ext: ext).length,
+        ),
+        BenchmarkCase(
+          'dart_encode_copy/$format/$suffix',
+          () => _encodeRaw(inputs[resolution].image, ext, copy: true),
+        ),
+        BenchmarkCase(
+          'dart_encode_view/$format/$suffix',
+          () => _encodeRaw(inputs[resolution].image, ext, copy: false),
+        ),
+        BenchmarkCase('dart_decode/$format/$suffix', () {
+          final input = inputs[resolution];
+          CvImage.fromBytes(ext == '.jpg' ? input.jpeg : input.png)!.dispose();
+        }),
+      ]);
+    }
+    cases.addAll([
+      // 같은 isolate 에서 실행 (compute 케이스와의 차이가 isolate 생성 + 메시지 복사 비용)
+      BenchmarkCase(
+        'dart_roundtrip_sync/jpg/$suffix',
+        () => _sink += decodeEncodeJpeg(inputs[resolution].jpeg)!.length,
+      ),
+      BenchmarkCase('dart_roundtrip_compute/jpg/$suffix', () async {
+        final result = await computeDecodeEncodeJpeg(inputs[resolution].jpeg);
+        _sink += result!.length;
+      }),
+    ]);
+  }
+  return cases;
+}
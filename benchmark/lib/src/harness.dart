@@ -0,0 +1,164 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+
+/// 벤치마크 케이스
+///
+/// [run] 이 Future 를 반환하면 await 하고, 아니면 동기로 반복 실행합니다.
+/// FFI 호출처럼 짧은 경로는 [run] 안에서 [opsPerRun] 번 반복해 루프 오버헤드를 나눕니다.
+class BenchmarkCase {
+  final String name;
+  final FutureOr<void> Function() run;
+  final int opsPerRun;
+
+  /// 측정 전 입력 준비 / 측정 후 해제
+  final void Function()? setUp;
+  final void Function()? tearDown;
+
+  BenchmarkCase(
+    this.name,
+    this.run, {
+    this.opsPerRun = 1,
+    this.setUp,
+    this.tearDown,
+  });
+}
+
+/// 측정 결과 한 건 (Google Benchmark JSON 의 benchmarks 항목과 같은 의미)
+class BenchmarkResult {
+  final String name;
+  final int iterations;
+  final double nsPerOp;
+  final int repetitionIndex;
+
+  BenchmarkResult(this.name, this.iterations, this.nsPerOp, this.repetitionIndex);
+}
+
+/// 실행 옵션
+class BenchmarkOptions {
+  /// 케이스 하나를 측정하는 최소 시간
+  final Duration minTime;
+
+  /// 반복 측정 횟수. 2 이상이면 median 집계를 추가
+  final int repetitions;
+
+  /// 이름 필터 (정규식)
+  final RegExp? filter;
+
+  const BenchmarkOptions({
+    this.minTime = const Duration(milliseconds: 500),
+    this.repetitions = 1,
+    this.filter,
+  });
+}
+
+/// 케이스를 순서대로 측정하고 결과를 표로 출력
+Future<List<BenchmarkResult>> runBenchmarks(
+  List<BenchmarkCase> cases,
+  BenchmarkOptions options,
+) async {
+  final results = <BenchmarkResult>[];
+  final selected = cases
+      .where((c) => options.filter == null || options.filter!.hasMatch(c.name))
+      .toList();
+  final width = selected.fold<int>(
+    9,
+    (w, c) => c.name.length > w ? c.name.length : w,
+  );
+  stdout.writeln('${'benchmark'.padRight(width)}  ${'time/op'.padLeft(12)}  iterations');
+  for (final c in selected) {
+    c.setUp?.call();
+    try {
+      // 워밍업: JIT 컴파일, 네이티브 스레드 풀과 캐시
+      await _runFor(c, const Duration(milliseconds: 100));
+      final perRun = <double>[];
+      for (var r = 0; r < options.repetitions; r++) {
+        final (iterations, elapsedNs) = await _runFor(c, options.minTime);
+        final nsPerOp = elapsedNs / (iterations * c.opsPerRun);
+        perRun.add(nsPerOp);
+        results.add(BenchmarkResult(c.name, iterations, nsPerOp, r));
+        stdout.writeln(
+          '${c.name.padRight(width)}  ${formatNs(nsPerOp).padLeft(12)}  $iterations',
+        );
+      }
+      if (options.repetitions > 1) {
+        perRun.sort();
+        stdout.writeln(
+          '${'${c.name}_median'.padRight(width)}  ${formatNs(perRun[perRun.length ~/ 2]).padLeft(12)}',
+        );
+      }
+    } finally {
+      c.tearDown?.call();
+    }
+  }
+  return results;
+}
+
+/// [duration] 이상 반복 실행하고 (반복 횟수, 경과 ns) 반환
+Future<(int, double)> _runFor(BenchmarkCase c, Duration duration) async {
+  final stopwatch = Stopwatch()..start();
+  final limitTicks = duration.inMicroseconds * stopwatch.frequency ~/ 1000000;
+  var iterations = 0;
+  do {
+    final pending = c.run();
+    if (pending is Future) {
+      await pending;
+    }
+    iterations++;
+  } while (stopwatch.elapsedTicks < limitTicks);
+  return (iterations, stopwatch.elapsedTicks * 1e9 / stopwatch.frequency);
+}
+
+String formatNs(double ns) {
+  if (ns >= 1e9) return '${(ns / 1e9).toStringAsFixed(2)} s';
+  if (ns >= 1e6) return '${(ns / 1e6).toStringAsFixed(2)} ms';
+  if (ns >= 1e3) return '${(ns / 1e3).toStringAsFixed(2)} us';
+  return '${ns.toStringAsFixed(1)} ns';
+}
+
+/// Google Benchmark 형식 JSON 으로 저장 (src/bench/compare.py 로 비교 가능)
+void writeJson(String path, List<BenchmarkResult> results, int repetitions) {
+  final benchmarks = <Map<String, Object>>[];
+  final byName = <String, List<double>>{};
+  for (final r in results) {
+    byName.putIfAbsent(r.name, () => []).add(r.nsPerOp);
+    benchmarks.add({
+      'name': r.name,
+      'run_name': r.name,
+      'run_type': 'iteration',
+      'repetitions': repetitions,
+      'repetition_index': r.repetitionIndex,
+      'iterations': r.iterations,
+      'real_time': r.nsPerOp,
+      'cpu_time': r.nsPerOp,
+      'time_unit': 'ns',
+    });
+  }
+  if (repetitions > 1) {
+    byName.forEach((name, times) {
+      times.sort();
+      final median = times[times.length ~/ 2];
+      benchmarks.add({
+        'name': '${name}_median',
+        'run_name': name,
+        'run_type': 'aggregate',
+        'aggregate_name': 'median',
+        'repetitions': repetitions,
+        'real_time': median,
+        'cpu_time': median,
+        'time_unit': 'ns',
+      });
+    });
+  }
+  final json = {
+    'context': {
+      'date': DateTime.now().toIso8601String(),
+      'host_name': Platform.localHostname,
+      'executable': 'flutter_opencv_benchmark',
+      'num_cpus': Platform.numberOfProcessors,
+      'dart_version': Platform.version,
+    },
+    'benchmarks': benchmarks,
+  };
+  File(path).writeAsStringSync(const JsonEncoder.withIndent('  ').convert(json));
+}
@@ -0,0 +1,85 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter_opencv/flutter_opencv.dart';
+
+/// 측정 해상도
+class Resolution {
+  final String label;
+  final int width;
+  final int height;
+
+  const Resolution(this.label, this.width, this.height);
+
+  /// 벤치마크 이름 접미사 (Google Benchmark 인자 표기와 동일)
+  String get suffix => 'w:$width/h:$height';
+}
+
+/// src/bench 와 같은 해상도 행렬
+const List<Resolution> kResolutions = [
+  Resolution('vga', 640, 480),
+  Resolution('hd', 1280, 720),
+  Resolution('fhd', 1920, 1080),
+  Resolution('4k', 3840, 2160),
+  Resolution('12mp', 4000, 3000),
+];
+
+/// 결정적인 합성 영상의 PPM(P6) 바이트: 그라디언트 + 체크 무늬 + 노이즈
+///
+/// 파일 없이 cv_imdecode 로 원하는 크기의 BGR 영상을 만들기 위해 사용합니다.
+Uint8List syntheticPpm(int width, int height, {int seed = 1}) {
+  final header = ascii.encode('P6\n$width $height\n255\n');
+  final bytes = Uint8List(header.length + width * height * 3);
+  bytes.setAll(0, header);
+  var state = seed;
+  var i = header.length;
+  for (var y = 0; y < height; y++) {
+    for (var x = 0; x < width; x++) {
+      state = (state * 1103515245 + 12345) & 0x7fffffff;
+      final noise = (state >> 16) & 0x0f;
+      final block = ((x ~/ 48) + (y ~/ 48)).isEven ? 48 : 0;
+      bytes[i++] = (x * 191 ~/ width + block + noise) & 0xff;
+      bytes[i++] = (y * 191 ~/ height + block + noise) & 0xff;
+      bytes[i++] = ((x + y) * 127 ~/ (width + height) + 64 + noise) & 0xff;
+    }
+  }
+  return bytes;
+}
+
+/// 해상도별 입력 (영상과 그 JPEG/PNG 인코딩)
+class BenchmarkInput {
+  final CvImage image;
+  final Uint8List jpeg;
+  final Uint8List png;
+
+  BenchmarkInput(this.image, this.jpeg, this.png);
+
+  factory BenchmarkInput.create(Resolution resolution) {
+    final image = CvImage.fromBytes(
+      syntheticPpm(resolution.width, resolution.height),
+    );
+    if (image == null) {
+      throw Exception('Failed to decode synthetic ${resolution.label} image');
+    }
+    return BenchmarkInput(
+      image,
+      Uint8List.fromList(image.encode(ext: '.jpg')),
+      Uint8List.fromList(image.encode(ext: '.png')),
+    );
+  }
+}
+
+/// 해상도별 입력을 처음 사용할 때 한 번만 만들고 재사용
+class InputCache {
+  final Map<Resolution, BenchmarkInput> _inputs = {};
+
+  BenchmarkInput operator [](Resolution resolution) =>
+      _inputs.putIfAbsent(resolution, () => BenchmarkInput.create(resolution));
+
+  void dispose() {
+    for (final input in _inputs.values) {
+      input.image.dispose();
+    }
+    _inputs.clear();
+  }
+}
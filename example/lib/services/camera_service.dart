@@ -195,6 +195,9 @@ class CameraService {
       // 프레임을 콜백으로 전달
       // 주의: 콜백에서 프레임 처리 후 반드시 dispose() 호출 필요
       _onFrame?.call(frame);
+      
+      // 콜백 처리까지 끝난 시점을 기록 (캡처 -> 처리 완료 지연 통계)
+      _capture?.markDone();
     } catch (e, stackTrace) {
       // 프레임 캡처 중 에러 발생
       // 에러를 로그로 남기지만 스트리밍은 계속 진행
@@ -207,6 +210,17 @@ class CameraService {
     }
   }
   
+  /// 구간별 프레임 지연 통계 (p50/p95/p99)
+  /// 
+  /// [stage]: 측정 구간 (기본값: 캡처부터 콜백 처리 완료까지)
+  /// 
+  /// Returns: 카메라가 연결되지 않았으면 null
+  CvLatencySummary? latency([
+    CvLatencyStage stage = CvLatencyStage.endToEnd,
+  ]) {
+    return _capture?.latency(stage);
+  }
+  
   /// 카메라 속성 가져오기
   /// 
   /// [propertyId]: OpenCV 속성 ID
@@ -41,13 +41,14 @@ class ImageProcessingService {
         return null;
       }
 
-      AppLogger.debug('원본 이미지 크기: ${image.width}x${image.height}', tag: _tag);
+      final info = image.info;
+      AppLogger.debug('원본 이미지 크기: ${info.width}x${info.height}', tag: _tag);
 
       // 이미지가 너무 큰 경우 리사이즈 (성능 최적화)
-      if (image.width > maxSize || image.height > maxSize) {
+      if (info.width > maxSize || info.height > maxSize) {
         AppLogger.info('이미지 크기 조정 중...', tag: _tag);
 
-        final aspectRatio = image.height / image.width;
+        final aspectRatio = info.height / info.width;
         final newWidth = maxSize;
         final newHeight = (newWidth * aspectRatio).toInt();
 
@@ -418,10 +419,11 @@ class ImageProcessingService {
   /// resize를 동일한 크기로 수행하여 복사본을 생성합니다.
   static CvImage cloneImage(CvImage image) {
     try {
-      AppLogger.debug('이미지 복사 시작: ${image.width}x${image.height}', tag: _tag);
+      final info = image.info;
+      AppLogger.debug('이미지 복사 시작: ${info.width}x${info.height}', tag: _tag);
 
       // 동일한 크기로 resize하여 복사본 생성
-      final clone = image.resize(image.width, image.height);
+      final clone = image.resize(info.width, info.height);
 
       AppLogger.success('이미지 복사 완료', tag: _tag);
       return clone;
@@ -557,30 +559,32 @@ class ImageProcessingService {
   /// [source]: 원본 이미지
   ///
   /// 처리 단계:
-  /// 1. Grayscale 변환
-  /// 2. Gaussian Blur (노이즈 제거)
-  /// 3. Adaptive Threshold (이진화)
-  /// 4. Morph Open (노이즈 제거)
+  /// 1. 문서 영역 검출 및 원근 보정 (검출 실패 시 원본 사용)
+  /// 2. Grayscale 변환
+  /// 3. Sauvola 이진화 (다중 스케일로 그림자/여백 영역 보정)
   static CvImage processDocumentScanner(CvImage source) {
     try {
       AppLogger.debug('문서 스캐너 처리 시작', tag: _tag);
 
-      // 1. Grayscale
-      final gray = source.toGrayscale();
-
-      // 2. Blur
-      final blurred = gray.gaussianBlur(5, 0);
-      if (blurred != gray) gray.dispose();
+      // 1. Detect & Warp
+      // 축소 영상에서 검출하고, 꼭짓점 보정과 워프만 전체 해상도에서 수행
+      CvImage page = source;
+      final quad = CvDocumentScanner.detect(source);
+      if (quad != null && quad.confidence >= 0.5) {
+        final refined = CvDocumentScanner.refine(source, quad);
+        page = CvDocumentScanner.warp(source, refined);
+        AppLogger.debug('문서 영역 검출: $refined', tag: _tag);
+      }
 
-      // 3. Adaptive Threshold
-      // 조명 변화에 강한 적응형 임계값 사용
-      final binary = blurred.adaptiveThreshold(255, 1, 0, 11, 2);
-      if (binary != blurred) blurred.dispose();
+      // 2. Grayscale
+      final gray = page.toGrayscale();
+      if (page != source) page.dispose();
 
-      // 4. Morph Open
-      // 작은 점이나 노이즈 제거
-      final result = binary.morphologyEx(2, 3);
-      if (result != binary) binary.dispose();
+      // 3. Document Binarization
+      // 지역 평균/표준편차 기반이라 조명 변화에 강하고, 대비가 낮은 영역은
+      // 큰 창으로 보정되어 별도의 블러/모폴로지 패스가 필요 없음
+      final result = gray.binarizeDocument(windowSize: 25, k: 0.2, scales: 2);
+      if (result != gray) gray.dispose();
 
       AppLogger.success('문서 스캐너 처리 완료', tag: _tag);
       return result;
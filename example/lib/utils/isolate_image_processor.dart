@@ -49,8 +49,9 @@ Future<Uint8List?> isolateLoadImage(LoadImageParams params) async {
 
     // 리사이징
     CvImage finalImage = image;
-    if (image.width > params.maxSize || image.height > params.maxSize) {
-      final aspectRatio = image.height / image.width;
+    final info = image.info;
+    if (info.width > params.maxSize || info.height > params.maxSize) {
+      final aspectRatio = info.height / info.width;
       final newWidth = params.maxSize;
       final newHeight = (newWidth * aspectRatio).toInt();
 
@@ -4,8 +4,24 @@ import 'package:ffi/ffi.dart';
 
 import 'flutter_opencv_bindings_generated.dart';
 
+export 'src/cv_camera_calibration.dart';
+export 'src/cv_clahe.dart';
+export 'src/cv_document_scanner.dart';
+export 'src/cv_flow_tracker.dart';
+export 'src/cv_frame_stats.dart';
 export 'src/cv_image.dart';
+export 'src/cv_integral_image.dart';
+export 'src/cv_kernel.dart';
+export 'src/cv_lut.dart';
+export 'src/cv_motion_detector.dart';
+export 'src/cv_pyramid.dart';
+export 'src/cv_remap_cache.dart';
+export 'src/cv_stabilizer.dart';
+export 'src/cv_stats.dart';
+export 'src/cv_temporal_denoiser.dart';
+export 'src/cv_trace.dart';
 export 'src/cv_video_capture.dart';
+export 'src/cv_video_writer.dart';
 
 const String _libName = 'flutter_opencv';
 
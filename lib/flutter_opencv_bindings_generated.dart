@@ -36,7 +36,7 @@ class FlutterOpencvBindings {
         'opencv_version',
       );
   late final _opencv_version = _opencv_versionPtr
-      .asFunction<ffi.Pointer<ffi.Char> Function()>();
+      .asFunction<ffi.Pointer<ffi.Char> Function()>(isLeaf: true);
 
   /// 메모리 관리
   ffi.Pointer<CvMat> cv_mat_create() {
@@ -193,6 +193,7 @@ class FlutterOpencvBindings {
       .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>();
 
   /// 변환
+  /// interpolation: -1=자동 (축소 AREA, 확대 LINEAR). 8비트 AREA 축소는 2배 이상이면 정수 배율 박스 축소를 먼저 수행
   ffi.Pointer<CvMat> cv_resize(
     ffi.Pointer<CvMat> mat,
     int width,
@@ -244,508 +245,2837 @@ class FlutterOpencvBindings {
   late final _cv_rotate = _cv_rotatePtr
       .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int)>();
 
-  /// 필터
-  ffi.Pointer<CvMat> cv_gaussian_blur(
+  /// m: 행 우선 2x3 (affine) / 3x3 (perspective) 행렬. width, height 가 0 이면 입력 크기
+  ffi.Pointer<CvMat> cv_warp_affine(
     ffi.Pointer<CvMat> mat,
-    int kernelSize,
-    double sigma,
+    ffi.Pointer<ffi.Double> m,
+    int width,
+    int height,
+    int interpolation,
+    int borderMode,
   ) {
-    return _cv_gaussian_blur(mat, kernelSize, sigma);
+    return _cv_warp_affine(mat, m, width, height, interpolation, borderMode);
   }
 
-  late final _cv_gaussian_blurPtr =
+  late final _cv_warp_affinePtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Double)
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
         >
-      >('cv_gaussian_blur');
-  late final _cv_gaussian_blur = _cv_gaussian_blurPtr
+      >('cv_warp_affine');
+  late final _cv_warp_affine = _cv_warp_affinePtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, double)
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Double>,
+          int,
+          int,
+          int,
+          int,
+        )
       >();
 
-  ffi.Pointer<CvMat> cv_median_blur(ffi.Pointer<CvMat> mat, int kernelSize) {
-    return _cv_median_blur(mat, kernelSize);
-  }
-
-  late final _cv_median_blurPtr =
-      _lookup<
-        ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int)
-        >
-      >('cv_median_blur');
-  late final _cv_median_blur = _cv_median_blurPtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int)>();
-
-  ffi.Pointer<CvMat> cv_bilateral_filter(
+  ffi.Pointer<CvMat> cv_warp_perspective(
     ffi.Pointer<CvMat> mat,
-    int d,
-    double sigmaColor,
-    double sigmaSpace,
+    ffi.Pointer<ffi.Double> m,
+    int width,
+    int height,
+    int interpolation,
+    int borderMode,
   ) {
-    return _cv_bilateral_filter(mat, d, sigmaColor, sigmaSpace);
+    return _cv_warp_perspective(
+      mat,
+      m,
+      width,
+      height,
+      interpolation,
+      borderMode,
+    );
   }
 
-  late final _cv_bilateral_filterPtr =
+  late final _cv_warp_perspectivePtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Pointer<CvMat> Function(
             ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
             ffi.Int,
-            ffi.Double,
-            ffi.Double,
           )
         >
-      >('cv_bilateral_filter');
-  late final _cv_bilateral_filter = _cv_bilateral_filterPtr
+      >('cv_warp_perspective');
+  late final _cv_warp_perspective = _cv_warp_perspectivePtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, double, double)
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Double>,
+          int,
+          int,
+          int,
+          int,
+        )
       >();
 
-  ffi.Pointer<CvMat> cv_canny(
+  /// mapX, mapY: 출력 크기의 CV_32FC1 입력 좌표 맵
+  ffi.Pointer<CvMat> cv_remap(
     ffi.Pointer<CvMat> mat,
-    double threshold1,
-    double threshold2,
+    ffi.Pointer<CvMat> mapX,
+    ffi.Pointer<CvMat> mapY,
+    int interpolation,
+    int borderMode,
   ) {
-    return _cv_canny(mat, threshold1, threshold2);
+    return _cv_remap(mat, mapX, mapY, interpolation, borderMode);
   }
 
-  late final _cv_cannyPtr =
+  late final _cv_remapPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Pointer<CvMat> Function(
             ffi.Pointer<CvMat>,
-            ffi.Double,
-            ffi.Double,
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
           )
         >
-      >('cv_canny');
-  late final _cv_canny = _cv_cannyPtr
+      >('cv_remap');
+  late final _cv_remap = _cv_remapPtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, double)
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+        )
       >();
 
-  ffi.Pointer<CvMat> cv_sobel(
-    ffi.Pointer<CvMat> mat,
-    int dx,
-    int dy,
-    int ksize,
+  /// width x height 출력용 캐시 생성 (m 은 정방향 변환 행렬)
+  ffi.Pointer<CvRemapCache> cv_remap_cache_create_affine(
+    ffi.Pointer<ffi.Double> m,
+    int width,
+    int height,
+    int interpolation,
+    int borderMode,
   ) {
-    return _cv_sobel(mat, dx, dy, ksize);
+    return _cv_remap_cache_create_affine(
+      m,
+      width,
+      height,
+      interpolation,
+      borderMode,
+    );
   }
 
-  late final _cv_sobelPtr =
+  late final _cv_remap_cache_create_affinePtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(
-            ffi.Pointer<CvMat>,
+          ffi.Pointer<CvRemapCache> Function(
+            ffi.Pointer<ffi.Double>,
+            ffi.Int,
             ffi.Int,
             ffi.Int,
             ffi.Int,
           )
         >
-      >('cv_sobel');
-  late final _cv_sobel = _cv_sobelPtr
+      >('cv_remap_cache_create_affine');
+  late final _cv_remap_cache_create_affine = _cv_remap_cache_create_affinePtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int, int)
+        ffi.Pointer<CvRemapCache> Function(
+          ffi.Pointer<ffi.Double>,
+          int,
+          int,
+          int,
+          int,
+        )
       >();
 
-  ffi.Pointer<CvMat> cv_laplacian(ffi.Pointer<CvMat> mat, int ksize) {
-    return _cv_laplacian(mat, ksize);
+  ffi.Pointer<CvRemapCache> cv_remap_cache_create_perspective(
+    ffi.Pointer<ffi.Double> m,
+    int width,
+    int height,
+    int interpolation,
+    int borderMode,
+  ) {
+    return _cv_remap_cache_create_perspective(
+      m,
+      width,
+      height,
+      interpolation,
+      borderMode,
+    );
   }
 
-  late final _cv_laplacianPtr =
+  late final _cv_remap_cache_create_perspectivePtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int)
+          ffi.Pointer<CvRemapCache> Function(
+            ffi.Pointer<ffi.Double>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
         >
-      >('cv_laplacian');
-  late final _cv_laplacian = _cv_laplacianPtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int)>();
+      >('cv_remap_cache_create_perspective');
+  late final _cv_remap_cache_create_perspective =
+      _cv_remap_cache_create_perspectivePtr
+          .asFunction<
+            ffi.Pointer<CvRemapCache> Function(
+              ffi.Pointer<ffi.Double>,
+              int,
+              int,
+              int,
+              int,
+            )
+          >();
 
-  ffi.Pointer<CvMat> cv_sharpen(ffi.Pointer<CvMat> mat) {
-    return _cv_sharpen(mat);
+  ffi.Pointer<CvRemapCache> cv_remap_cache_create_maps(
+    ffi.Pointer<CvMat> mapX,
+    ffi.Pointer<CvMat> mapY,
+    int interpolation,
+    int borderMode,
+  ) {
+    return _cv_remap_cache_create_maps(mapX, mapY, interpolation, borderMode);
   }
 
-  late final _cv_sharpenPtr =
+  late final _cv_remap_cache_create_mapsPtr =
       _lookup<
-        ffi.NativeFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>
-      >('cv_sharpen');
-  late final _cv_sharpen = _cv_sharpenPtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>();
+        ffi.NativeFunction<
+          ffi.Pointer<CvRemapCache> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_remap_cache_create_maps');
+  late final _cv_remap_cache_create_maps = _cv_remap_cache_create_mapsPtr
+      .asFunction<
+        ffi.Pointer<CvRemapCache> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+        )
+      >();
 
-  /// 형태학 연산
-  ffi.Pointer<CvMat> cv_erode(
+  void cv_remap_cache_release(ffi.Pointer<CvRemapCache> cache) {
+    return _cv_remap_cache_release(cache);
+  }
+
+  late final _cv_remap_cache_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvRemapCache>)>>(
+        'cv_remap_cache_release',
+      );
+  late final _cv_remap_cache_release = _cv_remap_cache_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvRemapCache>)>();
+
+  ffi.Pointer<CvMat> cv_remap_cache_apply(
+    ffi.Pointer<CvRemapCache> cache,
     ffi.Pointer<CvMat> mat,
-    int kernelSize,
-    int iterations,
   ) {
-    return _cv_erode(mat, kernelSize, iterations);
+    return _cv_remap_cache_apply(cache, mat);
   }
 
-  late final _cv_erodePtr =
+  late final _cv_remap_cache_applyPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvRemapCache>,
+            ffi.Pointer<CvMat>,
+          )
         >
-      >('cv_erode');
-  late final _cv_erode = _cv_erodePtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int)>();
+      >('cv_remap_cache_apply');
+  late final _cv_remap_cache_apply = _cv_remap_cache_applyPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvRemapCache>,
+          ffi.Pointer<CvMat>,
+        )
+      >();
 
-  ffi.Pointer<CvMat> cv_dilate(
-    ffi.Pointer<CvMat> mat,
-    int kernelSize,
-    int iterations,
+  /// patternCols x patternRows: 체스보드 내부 코너 개수, squareSize: 칸 한 변 길이
+  ffi.Pointer<CvCalibration> cv_calibration_create(
+    int patternCols,
+    int patternRows,
+    double squareSize,
   ) {
-    return _cv_dilate(mat, kernelSize, iterations);
+    return _cv_calibration_create(patternCols, patternRows, squareSize);
   }
 
-  late final _cv_dilatePtr =
+  late final _cv_calibration_createPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+          ffi.Pointer<CvCalibration> Function(ffi.Int, ffi.Int, ffi.Float)
         >
-      >('cv_dilate');
-  late final _cv_dilate = _cv_dilatePtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int)>();
+      >('cv_calibration_create');
+  late final _cv_calibration_create = _cv_calibration_createPtr
+      .asFunction<ffi.Pointer<CvCalibration> Function(int, int, double)>();
 
-  ffi.Pointer<CvMat> cv_morphology_ex(
+  void cv_calibration_release(ffi.Pointer<CvCalibration> calib) {
+    return _cv_calibration_release(calib);
+  }
+
+  late final _cv_calibration_releasePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvCalibration>)>
+      >('cv_calibration_release');
+  late final _cv_calibration_release = _cv_calibration_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvCalibration>)>();
+
+  /// 체스보드를 찾으면 관측값에 추가하고 1 반환. outCorners(선택)에 코너 (x, y) 를 기록
+  int cv_calibration_add_frame(
+    ffi.Pointer<CvCalibration> calib,
     ffi.Pointer<CvMat> mat,
-    int op,
-    int kernelSize,
+    ffi.Pointer<ffi.Float> outCorners,
   ) {
-    return _cv_morphology_ex(mat, op, kernelSize);
+    return _cv_calibration_add_frame(calib, mat, outCorners);
   }
 
-  late final _cv_morphology_exPtr =
+  late final _cv_calibration_add_framePtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+          ffi.Int Function(
+            ffi.Pointer<CvCalibration>,
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Float>,
+          )
         >
-      >('cv_morphology_ex');
-  late final _cv_morphology_ex = _cv_morphology_exPtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int)>();
+      >('cv_calibration_add_frame');
+  late final _cv_calibration_add_frame = _cv_calibration_add_framePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvCalibration>,
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Float>,
+        )
+      >();
 
-  /// 임계값 처리
-  ffi.Pointer<CvMat> cv_threshold(
-    ffi.Pointer<CvMat> mat,
-    double thresh,
-    double maxval,
-    int type,
+  int cv_calibration_frame_count(ffi.Pointer<CvCalibration> calib) {
+    return _cv_calibration_frame_count(calib);
+  }
+
+  late final _cv_calibration_frame_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvCalibration>)>>(
+        'cv_calibration_frame_count',
+      );
+  late final _cv_calibration_frame_count = _cv_calibration_frame_countPtr
+      .asFunction<int Function(ffi.Pointer<CvCalibration>)>();
+
+  /// 3장 이상의 관측값으로 보정하고 재투영 RMS 오차 반환 (실패 시 -1)
+  double cv_calibration_calibrate(ffi.Pointer<CvCalibration> calib) {
+    return _cv_calibration_calibrate(calib);
+  }
+
+  late final _cv_calibration_calibratePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Double Function(ffi.Pointer<CvCalibration>)>
+      >('cv_calibration_calibrate');
+  late final _cv_calibration_calibrate = _cv_calibration_calibratePtr
+      .asFunction<double Function(ffi.Pointer<CvCalibration>)>();
+
+  /// outCameraMatrix: 3x3 행 우선, outDistCoeffs: k1 k2 p1 p2 k3, outSize: width height
+  int cv_calibration_get_params(
+    ffi.Pointer<CvCalibration> calib,
+    ffi.Pointer<ffi.Double> outCameraMatrix,
+    ffi.Pointer<ffi.Double> outDistCoeffs,
+    ffi.Pointer<ffi.Int> outSize,
   ) {
-    return _cv_threshold(mat, thresh, maxval, type);
+    return _cv_calibration_get_params(
+      calib,
+      outCameraMatrix,
+      outDistCoeffs,
+      outSize,
+    );
   }
 
-  late final _cv_thresholdPtr =
+  late final _cv_calibration_get_paramsPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(
-            ffi.Pointer<CvMat>,
-            ffi.Double,
-            ffi.Double,
-            ffi.Int,
+          ffi.Int Function(
+            ffi.Pointer<CvCalibration>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
           )
         >
-      >('cv_threshold');
-  late final _cv_threshold = _cv_thresholdPtr
+      >('cv_calibration_get_params');
+  late final _cv_calibration_get_params = _cv_calibration_get_paramsPtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, double, int)
+        int Function(
+          ffi.Pointer<CvCalibration>,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
       >();
 
-  ffi.Pointer<CvMat> cv_adaptive_threshold(
-    ffi.Pointer<CvMat> mat,
-    double maxValue,
-    int adaptiveMethod,
-    int thresholdType,
-    int blockSize,
-    double C,
+  void cv_calibration_set_params(
+    ffi.Pointer<CvCalibration> calib,
+    ffi.Pointer<ffi.Double> cameraMatrix,
+    ffi.Pointer<ffi.Double> distCoeffs,
+    int width,
+    int height,
   ) {
-    return _cv_adaptive_threshold(
-      mat,
-      maxValue,
-      adaptiveMethod,
-      thresholdType,
-      blockSize,
-      C,
+    return _cv_calibration_set_params(
+      calib,
+      cameraMatrix,
+      distCoeffs,
+      width,
+      height,
     );
   }
 
-  late final _cv_adaptive_thresholdPtr =
+  late final _cv_calibration_set_paramsPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(
-            ffi.Pointer<CvMat>,
-            ffi.Double,
-            ffi.Int,
+          ffi.Void Function(
+            ffi.Pointer<CvCalibration>,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Double>,
             ffi.Int,
             ffi.Int,
-            ffi.Double,
           )
         >
-      >('cv_adaptive_threshold');
-  late final _cv_adaptive_threshold = _cv_adaptive_thresholdPtr
+      >('cv_calibration_set_params');
+  late final _cv_calibration_set_params = _cv_calibration_set_paramsPtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(
-          ffi.Pointer<CvMat>,
-          double,
-          int,
+        void Function(
+          ffi.Pointer<CvCalibration>,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Double>,
           int,
           int,
-          double,
         )
       >();
 
-  /// 히스토그램
-  ffi.Pointer<CvMat> cv_equalize_hist(ffi.Pointer<CvMat> mat) {
-    return _cv_equalize_hist(mat);
+  /// OpenCV FileStorage 형식 (확장자에 따라 .yml / .xml / .json)
+  int cv_calibration_save(
+    ffi.Pointer<CvCalibration> calib,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _cv_calibration_save(calib, path);
   }
 
-  late final _cv_equalize_histPtr =
+  late final _cv_calibration_savePtr =
       _lookup<
-        ffi.NativeFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>
-      >('cv_equalize_hist');
-  late final _cv_equalize_hist = _cv_equalize_histPtr
-      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>();
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvCalibration>, ffi.Pointer<ffi.Char>)
+        >
+      >('cv_calibration_save');
+  late final _cv_calibration_save = _cv_calibration_savePtr
+      .asFunction<
+        int Function(ffi.Pointer<CvCalibration>, ffi.Pointer<ffi.Char>)
+      >();
 
-  /// 노이즈 제거
-  ffi.Pointer<CvMat> cv_fast_nl_means_denoising(
-    ffi.Pointer<CvMat> mat,
-    double h,
-    int templateWindowSize,
-    int searchWindowSize,
+  ffi.Pointer<CvCalibration> cv_calibration_load(ffi.Pointer<ffi.Char> path) {
+    return _cv_calibration_load(path);
+  }
+
+  late final _cv_calibration_loadPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvCalibration> Function(ffi.Pointer<ffi.Char>)
+        >
+      >('cv_calibration_load');
+  late final _cv_calibration_load = _cv_calibration_loadPtr
+      .asFunction<ffi.Pointer<CvCalibration> Function(ffi.Pointer<ffi.Char>)>();
+
+  /// 왜곡 보정 맵을 한 번 생성한 리맵 캐시 반환 (cv_videocapture_set_remap 으로 캡처에 부착 가능)
+  ffi.Pointer<CvRemapCache> cv_undistorter_create(
+    ffi.Pointer<CvCalibration> calib,
+    double alpha,
+    int interpolation,
   ) {
-    return _cv_fast_nl_means_denoising(
-      mat,
-      h,
-      templateWindowSize,
-      searchWindowSize,
-    );
+    return _cv_undistorter_create(calib, alpha, interpolation);
   }
 
-  late final _cv_fast_nl_means_denoisingPtr =
+  late final _cv_undistorter_createPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Pointer<CvMat> Function(
-            ffi.Pointer<CvMat>,
-            ffi.Float,
-            ffi.Int,
+          ffi.Pointer<CvRemapCache> Function(
+            ffi.Pointer<CvCalibration>,
+            ffi.Double,
             ffi.Int,
           )
         >
-      >('cv_fast_nl_means_denoising');
-  late final _cv_fast_nl_means_denoising = _cv_fast_nl_means_denoisingPtr
+      >('cv_undistorter_create');
+  late final _cv_undistorter_create = _cv_undistorter_createPtr
       .asFunction<
-        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, int, int)
+        ffi.Pointer<CvRemapCache> Function(
+          ffi.Pointer<CvCalibration>,
+          double,
+          int,
+        )
       >();
 
-  ffi.Pointer<CvMat> cv_fast_nl_means_denoising_colored(
+  /// levels 가 0 이하면 짧은 변이 16 픽셀 이상인 최대 레벨 수. 레벨 0 은 원본과 데이터를 공유
+  ffi.Pointer<CvPyramid> cv_pyramid_create(ffi.Pointer<CvMat> mat, int levels) {
+    return _cv_pyramid_create(mat, levels);
+  }
+
+  late final _cv_pyramid_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvPyramid> Function(ffi.Pointer<CvMat>, ffi.Int)
+        >
+      >('cv_pyramid_create');
+  late final _cv_pyramid_create = _cv_pyramid_createPtr
+      .asFunction<ffi.Pointer<CvPyramid> Function(ffi.Pointer<CvMat>, int)>();
+
+  void cv_pyramid_release(ffi.Pointer<CvPyramid> pyramid) {
+    return _cv_pyramid_release(pyramid);
+  }
+
+  late final _cv_pyramid_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvPyramid>)>>(
+        'cv_pyramid_release',
+      );
+  late final _cv_pyramid_release = _cv_pyramid_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvPyramid>)>();
+
+  int cv_pyramid_levels(ffi.Pointer<CvPyramid> pyramid) {
+    return _cv_pyramid_levels(pyramid);
+  }
+
+  late final _cv_pyramid_levelsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvPyramid>)>>(
+        'cv_pyramid_levels',
+      );
+  late final _cv_pyramid_levels = _cv_pyramid_levelsPtr
+      .asFunction<int Function(ffi.Pointer<CvPyramid>)>();
+
+  /// 반환된 영상은 레벨별 독립 버퍼를 공유 (피라미드를 해제해도 유효)
+  ffi.Pointer<CvMat> cv_pyramid_gaussian(
+    ffi.Pointer<CvPyramid> pyramid,
+    int level,
+  ) {
+    return _cv_pyramid_gaussian(pyramid, level);
+  }
+
+  late final _cv_pyramid_gaussianPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvPyramid>, ffi.Int)
+        >
+      >('cv_pyramid_gaussian');
+  late final _cv_pyramid_gaussian = _cv_pyramid_gaussianPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvPyramid>, int)>();
+
+  /// 8비트 입력은 CV_16S, 그 외는 CV_32F. level == levels 이면 가장 작은 Gaussian 레벨
+  ffi.Pointer<CvMat> cv_pyramid_laplacian(
+    ffi.Pointer<CvPyramid> pyramid,
+    int level,
+  ) {
+    return _cv_pyramid_laplacian(pyramid, level);
+  }
+
+  late final _cv_pyramid_laplacianPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvPyramid>, ffi.Int)
+        >
+      >('cv_pyramid_laplacian');
+  late final _cv_pyramid_laplacian = _cv_pyramid_laplacianPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvPyramid>, int)>();
+
+  /// 필터
+  ffi.Pointer<CvMat> cv_gaussian_blur(
     ffi.Pointer<CvMat> mat,
-    double h,
-    double hColor,
-    int templateWindowSize,
-    int searchWindowSize,
+    int kernelSize,
+    double sigma,
   ) {
-    return _cv_fast_nl_means_denoising_colored(
-      mat,
-      h,
-      hColor,
-      templateWindowSize,
-      searchWindowSize,
-    );
+    return _cv_gaussian_blur(mat, kernelSize, sigma);
   }
 
-  late final _cv_fast_nl_means_denoising_coloredPtr =
+  late final _cv_gaussian_blurPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Double)
+        >
+      >('cv_gaussian_blur');
+  late final _cv_gaussian_blur = _cv_gaussian_blurPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, double)
+      >();
+
+  ffi.Pointer<CvMat> cv_median_blur(ffi.Pointer<CvMat> mat, int kernelSize) {
+    return _cv_median_blur(mat, kernelSize);
+  }
+
+  late final _cv_median_blurPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int)
+        >
+      >('cv_median_blur');
+  late final _cv_median_blur = _cv_median_blurPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int)>();
+
+  ffi.Pointer<CvMat> cv_bilateral_filter(
+    ffi.Pointer<CvMat> mat,
+    int d,
+    double sigmaColor,
+    double sigmaSpace,
+  ) {
+    return _cv_bilateral_filter(mat, d, sigmaColor, sigmaSpace);
+  }
+
+  late final _cv_bilateral_filterPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Pointer<CvMat> Function(
             ffi.Pointer<CvMat>,
-            ffi.Float,
-            ffi.Float,
-            ffi.Int,
             ffi.Int,
+            ffi.Double,
+            ffi.Double,
           )
         >
-      >('cv_fast_nl_means_denoising_colored');
-  late final _cv_fast_nl_means_denoising_colored =
-      _cv_fast_nl_means_denoising_coloredPtr
-          .asFunction<
-            ffi.Pointer<CvMat> Function(
-              ffi.Pointer<CvMat>,
-              double,
-              double,
-              int,
-              int,
-            )
-          >();
+      >('cv_bilateral_filter');
+  late final _cv_bilateral_filter = _cv_bilateral_filterPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, double, double)
+      >();
 
-  ContoursResult cv_find_contours(
+  ffi.Pointer<CvMat> cv_canny(
     ffi.Pointer<CvMat> mat,
-    int mode,
-    int method,
+    double threshold1,
+    double threshold2,
   ) {
-    return _cv_find_contours(mat, mode, method);
+    return _cv_canny(mat, threshold1, threshold2);
   }
 
-  late final _cv_find_contoursPtr =
+  late final _cv_cannyPtr =
       _lookup<
         ffi.NativeFunction<
-          ContoursResult Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Double,
+            ffi.Double,
+          )
         >
-      >('cv_find_contours');
-  late final _cv_find_contours = _cv_find_contoursPtr
-      .asFunction<ContoursResult Function(ffi.Pointer<CvMat>, int, int)>();
-
-  void cv_free_contours(ContoursResult result) {
-    return _cv_free_contours(result);
-  }
-
-  late final _cv_free_contoursPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ContoursResult)>>(
-        'cv_free_contours',
-      );
-  late final _cv_free_contours = _cv_free_contoursPtr
-      .asFunction<void Function(ContoursResult)>();
+      >('cv_canny');
+  late final _cv_canny = _cv_cannyPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, double)
+      >();
 
-  void cv_draw_contours(
+  ffi.Pointer<CvMat> cv_sobel(
     ffi.Pointer<CvMat> mat,
-    ContoursResult contours,
-    int contourIdx,
-    int r,
-    int g,
-    int b,
-    int thickness,
+    int dx,
+    int dy,
+    int ksize,
   ) {
-    return _cv_draw_contours(mat, contours, contourIdx, r, g, b, thickness);
+    return _cv_sobel(mat, dx, dy, ksize);
   }
 
-  late final _cv_draw_contoursPtr =
+  late final _cv_sobelPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Void Function(
+          ffi.Pointer<CvMat> Function(
             ffi.Pointer<CvMat>,
-            ContoursResult,
-            ffi.Int,
-            ffi.Int,
             ffi.Int,
             ffi.Int,
             ffi.Int,
           )
         >
-      >('cv_draw_contours');
-  late final _cv_draw_contours = _cv_draw_contoursPtr
+      >('cv_sobel');
+  late final _cv_sobel = _cv_sobelPtr
       .asFunction<
-        void Function(
-          ffi.Pointer<CvMat>,
-          ContoursResult,
-          int,
-          int,
-          int,
-          int,
-          int,
-        )
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int, int)
       >();
 
-  /// 그리기
-  void cv_rectangle(
+  ffi.Pointer<CvMat> cv_laplacian(ffi.Pointer<CvMat> mat, int ksize) {
+    return _cv_laplacian(mat, ksize);
+  }
+
+  late final _cv_laplacianPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int)
+        >
+      >('cv_laplacian');
+  late final _cv_laplacian = _cv_laplacianPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int)>();
+
+  ffi.Pointer<CvMat> cv_sharpen(ffi.Pointer<CvMat> mat) {
+    return _cv_sharpen(mat);
+  }
+
+  late final _cv_sharpenPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>
+      >('cv_sharpen');
+  late final _cv_sharpen = _cv_sharpenPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>();
+
+  /// 형태학 연산
+  ffi.Pointer<CvMat> cv_erode(
     ffi.Pointer<CvMat> mat,
-    int x,
-    int y,
-    int width,
-    int height,
-    int r,
-    int g,
-    int b,
-    int thickness,
+    int kernelSize,
+    int iterations,
+  ) {
+    return _cv_erode(mat, kernelSize, iterations);
+  }
+
+  late final _cv_erodePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+        >
+      >('cv_erode');
+  late final _cv_erode = _cv_erodePtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int)>();
+
+  ffi.Pointer<CvMat> cv_dilate(
+    ffi.Pointer<CvMat> mat,
+    int kernelSize,
+    int iterations,
+  ) {
+    return _cv_dilate(mat, kernelSize, iterations);
+  }
+
+  late final _cv_dilatePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+        >
+      >('cv_dilate');
+  late final _cv_dilate = _cv_dilatePtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int)>();
+
+  ffi.Pointer<CvMat> cv_morphology_ex(
+    ffi.Pointer<CvMat> mat,
+    int op,
+    int kernelSize,
+  ) {
+    return _cv_morphology_ex(mat, op, kernelSize);
+  }
+
+  late final _cv_morphology_exPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+        >
+      >('cv_morphology_ex');
+  late final _cv_morphology_ex = _cv_morphology_exPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, int, int)>();
+
+  ffi.Pointer<CvKernel> cv_kernel_create(int shape, int width, int height) {
+    return _cv_kernel_create(shape, width, height);
+  }
+
+  late final _cv_kernel_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvKernel> Function(ffi.Int, ffi.Int, ffi.Int)
+        >
+      >('cv_kernel_create');
+  late final _cv_kernel_create = _cv_kernel_createPtr
+      .asFunction<ffi.Pointer<CvKernel> Function(int, int, int)>();
+
+  ffi.Pointer<CvKernel> cv_kernel_create_custom(
+    ffi.Pointer<ffi.Float> data,
+    int width,
+    int height,
+    int anchorX,
+    int anchorY,
+  ) {
+    return _cv_kernel_create_custom(data, width, height, anchorX, anchorY);
+  }
+
+  late final _cv_kernel_create_customPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvKernel> Function(
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_kernel_create_custom');
+  late final _cv_kernel_create_custom = _cv_kernel_create_customPtr
+      .asFunction<
+        ffi.Pointer<CvKernel> Function(
+          ffi.Pointer<ffi.Float>,
+          int,
+          int,
+          int,
+          int,
+        )
+      >();
+
+  void cv_kernel_release(ffi.Pointer<CvKernel> kernel) {
+    return _cv_kernel_release(kernel);
+  }
+
+  late final _cv_kernel_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvKernel>)>>(
+        'cv_kernel_release',
+      );
+  late final _cv_kernel_release = _cv_kernel_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvKernel>)>();
+
+  ffi.Pointer<CvMat> cv_erode_kernel(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<CvKernel> kernel,
+    int iterations,
+  ) {
+    return _cv_erode_kernel(mat, kernel, iterations);
+  }
+
+  late final _cv_erode_kernelPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvKernel>,
+            ffi.Int,
+          )
+        >
+      >('cv_erode_kernel');
+  late final _cv_erode_kernel = _cv_erode_kernelPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvKernel>,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvMat> cv_dilate_kernel(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<CvKernel> kernel,
+    int iterations,
+  ) {
+    return _cv_dilate_kernel(mat, kernel, iterations);
+  }
+
+  late final _cv_dilate_kernelPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvKernel>,
+            ffi.Int,
+          )
+        >
+      >('cv_dilate_kernel');
+  late final _cv_dilate_kernel = _cv_dilate_kernelPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvKernel>,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvMat> cv_morphology_ex_kernel(
+    ffi.Pointer<CvMat> mat,
+    int op,
+    ffi.Pointer<CvKernel> kernel,
+    int iterations,
+  ) {
+    return _cv_morphology_ex_kernel(mat, op, kernel, iterations);
+  }
+
+  late final _cv_morphology_ex_kernelPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Pointer<CvKernel>,
+            ffi.Int,
+          )
+        >
+      >('cv_morphology_ex_kernel');
+  late final _cv_morphology_ex_kernel = _cv_morphology_ex_kernelPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          int,
+          ffi.Pointer<CvKernel>,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvMat> cv_filter2d_kernel(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<CvKernel> kernel,
+    double delta,
+    int borderType,
+  ) {
+    return _cv_filter2d_kernel(mat, kernel, delta, borderType);
+  }
+
+  late final _cv_filter2d_kernelPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvKernel>,
+            ffi.Double,
+            ffi.Int,
+          )
+        >
+      >('cv_filter2d_kernel');
+  late final _cv_filter2d_kernel = _cv_filter2d_kernelPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvKernel>,
+          double,
+          int,
+        )
+      >();
+
+  /// 사용자 커널 필터 (anchor -1 이면 중앙, 분리 가능한 커널은 자동으로 분리 적용)
+  ffi.Pointer<CvMat> cv_filter2d(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<ffi.Float> kernel,
+    int kernelWidth,
+    int kernelHeight,
+    int anchorX,
+    int anchorY,
+    double delta,
+    int borderType,
+  ) {
+    return _cv_filter2d(
+      mat,
+      kernel,
+      kernelWidth,
+      kernelHeight,
+      anchorX,
+      anchorY,
+      delta,
+      borderType,
+    );
+  }
+
+  late final _cv_filter2dPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Double,
+            ffi.Int,
+          )
+        >
+      >('cv_filter2d');
+  late final _cv_filter2d = _cv_filter2dPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Float>,
+          int,
+          int,
+          int,
+          int,
+          double,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvMat> cv_sep_filter2d(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<ffi.Float> kernelX,
+    int kernelXLen,
+    ffi.Pointer<ffi.Float> kernelY,
+    int kernelYLen,
+    int anchorX,
+    int anchorY,
+    double delta,
+    int borderType,
+  ) {
+    return _cv_sep_filter2d(
+      mat,
+      kernelX,
+      kernelXLen,
+      kernelY,
+      kernelYLen,
+      anchorX,
+      anchorY,
+      delta,
+      borderType,
+    );
+  }
+
+  late final _cv_sep_filter2dPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Double,
+            ffi.Int,
+          )
+        >
+      >('cv_sep_filter2d');
+  late final _cv_sep_filter2d = _cv_sep_filter2dPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Float>,
+          int,
+          ffi.Pointer<ffi.Float>,
+          int,
+          int,
+          int,
+          double,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvMat> cv_unsharp_mask(
+    ffi.Pointer<CvMat> mat,
+    double sigma,
+    double amount,
+    int threshold,
+  ) {
+    return _cv_unsharp_mask(mat, sigma, amount, threshold);
+  }
+
+  late final _cv_unsharp_maskPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Double,
+            ffi.Double,
+            ffi.Int,
+          )
+        >
+      >('cv_unsharp_mask');
+  late final _cv_unsharp_mask = _cv_unsharp_maskPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, double, int)
+      >();
+
+  /// 임계값 처리
+  ffi.Pointer<CvMat> cv_threshold(
+    ffi.Pointer<CvMat> mat,
+    double thresh,
+    double maxval,
+    int type,
+  ) {
+    return _cv_threshold(mat, thresh, maxval, type);
+  }
+
+  late final _cv_thresholdPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Double,
+            ffi.Double,
+            ffi.Int,
+          )
+        >
+      >('cv_threshold');
+  late final _cv_threshold = _cv_thresholdPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, double, int)
+      >();
+
+  ffi.Pointer<CvMat> cv_adaptive_threshold(
+    ffi.Pointer<CvMat> mat,
+    double maxValue,
+    int adaptiveMethod,
+    int thresholdType,
+    int blockSize,
+    double C,
+  ) {
+    return _cv_adaptive_threshold(
+      mat,
+      maxValue,
+      adaptiveMethod,
+      thresholdType,
+      blockSize,
+      C,
+    );
+  }
+
+  late final _cv_adaptive_thresholdPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Double,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Double,
+          )
+        >
+      >('cv_adaptive_threshold');
+  late final _cv_adaptive_threshold = _cv_adaptive_thresholdPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          double,
+          int,
+          int,
+          int,
+          double,
+        )
+      >();
+
+  /// 문서 이진화 (method: 0=Sauvola, 1=Wolf, 2=Niblack). scales > 1 이면 대비가 낮은 영역에 2배씩 큰 창을 사용
+  ffi.Pointer<CvMat> cv_binarize_document(
+    ffi.Pointer<CvMat> mat,
+    int method,
+    int windowSize,
+    double k,
+    double r,
+    int scales,
+  ) {
+    return _cv_binarize_document(mat, method, windowSize, k, r, scales);
+  }
+
+  late final _cv_binarize_documentPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Double,
+            ffi.Double,
+            ffi.Int,
+          )
+        >
+      >('cv_binarize_document');
+  late final _cv_binarize_document = _cv_binarize_documentPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+          double,
+          double,
+          int,
+        )
+      >();
+
+  /// 문서 스캐너
+  /// 축소 영상(긴 변 maxSide)에서 문서 사각형 검출. outQuad 에 좌상, 우상, 우하, 좌하 (x, y) 8개를 원본 좌표로 기록하고 신뢰도(0~1)를 반환 (없으면 0)
+  double cv_document_detect(
+    ffi.Pointer<CvMat> mat,
+    int maxSide,
+    ffi.Pointer<ffi.Float> outQuad,
+  ) {
+    return _cv_document_detect(mat, maxSide, outQuad);
+  }
+
+  late final _cv_document_detectPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Double Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Pointer<ffi.Float>,
+          )
+        >
+      >('cv_document_detect');
+  late final _cv_document_detect = _cv_document_detectPtr
+      .asFunction<
+        double Function(ffi.Pointer<CvMat>, int, ffi.Pointer<ffi.Float>)
+      >();
+
+  /// 전체 해상도에서 꼭짓점 주변 ROI 만 사용해 quad 를 서브픽셀로 보정
+  int cv_document_refine(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<ffi.Float> quad,
+    int searchRadius,
+  ) {
+    return _cv_document_refine(mat, quad, searchRadius);
+  }
+
+  late final _cv_document_refinePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvMat>, ffi.Pointer<ffi.Float>, ffi.Int)
+        >
+      >('cv_document_refine');
+  late final _cv_document_refine = _cv_document_refinePtr
+      .asFunction<
+        int Function(ffi.Pointer<CvMat>, ffi.Pointer<ffi.Float>, int)
+      >();
+
+  /// quad 를 outWidth x outHeight 로 원근 보정. 0 이면 변 길이로 자동 결정
+  ffi.Pointer<CvMat> cv_document_warp(
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<ffi.Float> quad,
+    int outWidth,
+    int outHeight,
+  ) {
+    return _cv_document_warp(mat, quad, outWidth, outHeight);
+  }
+
+  late final _cv_document_warpPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_document_warp');
+  late final _cv_document_warp = _cv_document_warpPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Float>,
+          int,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvIntegral> cv_integral_create() {
+    return _cv_integral_create();
+  }
+
+  late final _cv_integral_createPtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<CvIntegral> Function()>>(
+        'cv_integral_create',
+      );
+  late final _cv_integral_create = _cv_integral_createPtr
+      .asFunction<ffi.Pointer<CvIntegral> Function()>();
+
+  void cv_integral_release(ffi.Pointer<CvIntegral> integral) {
+    return _cv_integral_release(integral);
+  }
+
+  late final _cv_integral_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvIntegral>)>>(
+        'cv_integral_release',
+      );
+  late final _cv_integral_release = _cv_integral_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvIntegral>)>();
+
+  int cv_integral_compute(
+    ffi.Pointer<CvIntegral> integral,
+    ffi.Pointer<CvMat> mat,
+    int flags,
+  ) {
+    return _cv_integral_compute(integral, mat, flags);
+  }
+
+  late final _cv_integral_computePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvIntegral>, ffi.Pointer<CvMat>, ffi.Int)
+        >
+      >('cv_integral_compute');
+  late final _cv_integral_compute = _cv_integral_computePtr
+      .asFunction<
+        int Function(ffi.Pointer<CvIntegral>, ffi.Pointer<CvMat>, int)
+      >();
+
+  /// rects: (x, y, width, height) * count. 영상 경계로 잘라서 계산하며 처리한 개수를 반환
+  int cv_integral_rect_sums(
+    ffi.Pointer<CvIntegral> integral,
+    ffi.Pointer<ffi.Int> rects,
+    int count,
+    int channel,
+    ffi.Pointer<ffi.Double> outSums,
+  ) {
+    return _cv_integral_rect_sums(integral, rects, count, channel, outSums);
+  }
+
+  late final _cv_integral_rect_sumsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvIntegral>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Pointer<ffi.Double>,
+          )
+        >
+      >('cv_integral_rect_sums');
+  late final _cv_integral_rect_sums = _cv_integral_rect_sumsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvIntegral>,
+          ffi.Pointer<ffi.Int>,
+          int,
+          int,
+          ffi.Pointer<ffi.Double>,
+        )
+      >();
+
+  int cv_integral_rect_stats(
+    ffi.Pointer<CvIntegral> integral,
+    ffi.Pointer<ffi.Int> rects,
+    int count,
+    int channel,
+    ffi.Pointer<ffi.Double> outMeans,
+    ffi.Pointer<ffi.Double> outVariances,
+  ) {
+    return _cv_integral_rect_stats(
+      integral,
+      rects,
+      count,
+      channel,
+      outMeans,
+      outVariances,
+    );
+  }
+
+  late final _cv_integral_rect_statsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvIntegral>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Double>,
+          )
+        >
+      >('cv_integral_rect_stats');
+  late final _cv_integral_rect_stats = _cv_integral_rect_statsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvIntegral>,
+          ffi.Pointer<ffi.Int>,
+          int,
+          int,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Double>,
+        )
+      >();
+
+  /// rects: 위쪽 꼭짓점 (x, y) 와 45도 기울어진 변 길이 (width, height)
+  int cv_integral_tilted_sums(
+    ffi.Pointer<CvIntegral> integral,
+    ffi.Pointer<ffi.Int> rects,
+    int count,
+    int channel,
+    ffi.Pointer<ffi.Double> outSums,
+  ) {
+    return _cv_integral_tilted_sums(integral, rects, count, channel, outSums);
+  }
+
+  late final _cv_integral_tilted_sumsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvIntegral>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Pointer<ffi.Double>,
+          )
+        >
+      >('cv_integral_tilted_sums');
+  late final _cv_integral_tilted_sums = _cv_integral_tilted_sumsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvIntegral>,
+          ffi.Pointer<ffi.Int>,
+          int,
+          int,
+          ffi.Pointer<ffi.Double>,
+        )
+      >();
+
+  /// 히스토그램
+  /// outHist 에 bins 개씩 채널 순서로 기록 (channel -1 이면 모든 채널, channels * bins). mask 는 nullptr 가능
+  int cv_calc_hist(
+    ffi.Pointer<CvMat> mat,
+    int channel,
+    int bins,
+    double rangeMin,
+    double rangeMax,
+    ffi.Pointer<CvMat> mask,
+    ffi.Pointer<ffi.Float> outHist,
+  ) {
+    return _cv_calc_hist(mat, channel, bins, rangeMin, rangeMax, mask, outHist);
+  }
+
+  late final _cv_calc_histPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Float,
+            ffi.Float,
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Float>,
+          )
+        >
+      >('cv_calc_hist');
+  late final _cv_calc_hist = _cv_calc_histPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+          double,
+          double,
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Float>,
+        )
+      >();
+
+  /// 컬러 영상은 밝기(Y)만 평활화, BGRA 는 알파 유지. 8비트 1/3/4 채널이 아니면 nullptr
+  ffi.Pointer<CvMat> cv_equalize_hist(ffi.Pointer<CvMat> mat) {
+    return _cv_equalize_hist(mat);
+  }
+
+  late final _cv_equalize_histPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>
+      >('cv_equalize_hist');
+  late final _cv_equalize_hist = _cv_equalize_histPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>)>();
+
+  ffi.Pointer<CvClahe> cv_clahe_create(
+    double clipLimit,
+    int tilesX,
+    int tilesY,
+  ) {
+    return _cv_clahe_create(clipLimit, tilesX, tilesY);
+  }
+
+  late final _cv_clahe_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvClahe> Function(ffi.Double, ffi.Int, ffi.Int)
+        >
+      >('cv_clahe_create');
+  late final _cv_clahe_create = _cv_clahe_createPtr
+      .asFunction<ffi.Pointer<CvClahe> Function(double, int, int)>();
+
+  void cv_clahe_release(ffi.Pointer<CvClahe> clahe) {
+    return _cv_clahe_release(clahe);
+  }
+
+  late final _cv_clahe_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvClahe>)>>(
+        'cv_clahe_release',
+      );
+  late final _cv_clahe_release = _cv_clahe_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvClahe>)>();
+
+  void cv_clahe_set(
+    ffi.Pointer<CvClahe> clahe,
+    double clipLimit,
+    int tilesX,
+    int tilesY,
+  ) {
+    return _cv_clahe_set(clahe, clipLimit, tilesX, tilesY);
+  }
+
+  late final _cv_clahe_setPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvClahe>, ffi.Double, ffi.Int, ffi.Int)
+        >
+      >('cv_clahe_set');
+  late final _cv_clahe_set = _cv_clahe_setPtr
+      .asFunction<void Function(ffi.Pointer<CvClahe>, double, int, int)>();
+
+  /// 컬러 영상은 밝기(Y)에만 적용
+  ffi.Pointer<CvMat> cv_clahe_apply(
+    ffi.Pointer<CvClahe> clahe,
+    ffi.Pointer<CvMat> mat,
+  ) {
+    return _cv_clahe_apply(clahe, mat);
+  }
+
+  late final _cv_clahe_applyPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvClahe>, ffi.Pointer<CvMat>)
+        >
+      >('cv_clahe_apply');
+  late final _cv_clahe_apply = _cv_clahe_applyPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvClahe>, ffi.Pointer<CvMat>)
+      >();
+
+  /// 항등 테이블로 생성
+  ffi.Pointer<CvLut> cv_lut_create() {
+    return _cv_lut_create();
+  }
+
+  late final _cv_lut_createPtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<CvLut> Function()>>(
+        'cv_lut_create',
+      );
+  late final _cv_lut_create = _cv_lut_createPtr
+      .asFunction<ffi.Pointer<CvLut> Function()>();
+
+  void cv_lut_release(ffi.Pointer<CvLut> lut) {
+    return _cv_lut_release(lut);
+  }
+
+  late final _cv_lut_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvLut>)>>(
+        'cv_lut_release',
+      );
+  late final _cv_lut_release = _cv_lut_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvLut>)>();
+
+  void cv_lut_reset(ffi.Pointer<CvLut> lut) {
+    return _cv_lut_reset(lut);
+  }
+
+  late final _cv_lut_resetPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvLut>)>>(
+        'cv_lut_reset',
+      );
+  late final _cv_lut_reset = _cv_lut_resetPtr
+      .asFunction<void Function(ffi.Pointer<CvLut>)>();
+
+  /// channel: -1=색상 채널 전체(알파 제외), 0~3=해당 채널. 1채널 영상은 0번 테이블 사용
+  void cv_lut_brightness(ffi.Pointer<CvLut> lut, int channel, double delta) {
+    return _cv_lut_brightness(lut, channel, delta);
+  }
+
+  late final _cv_lut_brightnessPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvLut>, ffi.Int, ffi.Double)
+        >
+      >('cv_lut_brightness');
+  late final _cv_lut_brightness = _cv_lut_brightnessPtr
+      .asFunction<void Function(ffi.Pointer<CvLut>, int, double)>();
+
+  void cv_lut_contrast(
+    ffi.Pointer<CvLut> lut,
+    int channel,
+    double factor,
+    double pivot,
+  ) {
+    return _cv_lut_contrast(lut, channel, factor, pivot);
+  }
+
+  late final _cv_lut_contrastPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvLut>, ffi.Int, ffi.Double, ffi.Double)
+        >
+      >('cv_lut_contrast');
+  late final _cv_lut_contrast = _cv_lut_contrastPtr
+      .asFunction<void Function(ffi.Pointer<CvLut>, int, double, double)>();
+
+  void cv_lut_gamma(ffi.Pointer<CvLut> lut, int channel, double gamma) {
+    return _cv_lut_gamma(lut, channel, gamma);
+  }
+
+  late final _cv_lut_gammaPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvLut>, ffi.Int, ffi.Double)
+        >
+      >('cv_lut_gamma');
+  late final _cv_lut_gamma = _cv_lut_gammaPtr
+      .asFunction<void Function(ffi.Pointer<CvLut>, int, double)>();
+
+  void cv_lut_levels(
+    ffi.Pointer<CvLut> lut,
+    int channel,
+    double inBlack,
+    double inWhite,
+    double outBlack,
+    double outWhite,
+  ) {
+    return _cv_lut_levels(lut, channel, inBlack, inWhite, outBlack, outWhite);
+  }
+
+  late final _cv_lut_levelsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvLut>,
+            ffi.Int,
+            ffi.Double,
+            ffi.Double,
+            ffi.Double,
+            ffi.Double,
+          )
+        >
+      >('cv_lut_levels');
+  late final _cv_lut_levels = _cv_lut_levelsPtr
+      .asFunction<
+        void Function(ffi.Pointer<CvLut>, int, double, double, double, double)
+      >();
+
+  /// points: 제어점 (x, y) count 개, 0~255
+  void cv_lut_curve(
+    ffi.Pointer<CvLut> lut,
+    int channel,
+    ffi.Pointer<ffi.Float> points,
+    int count,
+  ) {
+    return _cv_lut_curve(lut, channel, points, count);
+  }
+
+  late final _cv_lut_curvePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvLut>,
+            ffi.Int,
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+          )
+        >
+      >('cv_lut_curve');
+  late final _cv_lut_curve = _cv_lut_curvePtr
+      .asFunction<
+        void Function(ffi.Pointer<CvLut>, int, ffi.Pointer<ffi.Float>, int)
+      >();
+
+  /// table: 256개 값을 현재 결과 뒤에 합성
+  void cv_lut_table(
+    ffi.Pointer<CvLut> lut,
+    int channel,
+    ffi.Pointer<ffi.Uint8> table,
+  ) {
+    return _cv_lut_table(lut, channel, table);
+  }
+
+  late final _cv_lut_tablePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvLut>, ffi.Int, ffi.Pointer<ffi.Uint8>)
+        >
+      >('cv_lut_table');
+  late final _cv_lut_table = _cv_lut_tablePtr
+      .asFunction<
+        void Function(ffi.Pointer<CvLut>, int, ffi.Pointer<ffi.Uint8>)
+      >();
+
+  /// 3D 색보정 격자 (.cube 순서, size^3 * 3 개 RGB 0~1). data 가 nullptr 이면 제거
+  int cv_lut_set_3d(
+    ffi.Pointer<CvLut> lut,
+    ffi.Pointer<ffi.Float> data,
+    int size,
+  ) {
+    return _cv_lut_set_3d(lut, data, size);
+  }
+
+  late final _cv_lut_set_3dPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvLut>, ffi.Pointer<ffi.Float>, ffi.Int)
+        >
+      >('cv_lut_set_3d');
+  late final _cv_lut_set_3d = _cv_lut_set_3dPtr
+      .asFunction<
+        int Function(ffi.Pointer<CvLut>, ffi.Pointer<ffi.Float>, int)
+      >();
+
+  /// 8비트 영상에 적용
+  ffi.Pointer<CvMat> cv_lut_apply(
+    ffi.Pointer<CvLut> lut,
+    ffi.Pointer<CvMat> mat,
+  ) {
+    return _cv_lut_apply(lut, mat);
+  }
+
+  late final _cv_lut_applyPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvLut>, ffi.Pointer<CvMat>)
+        >
+      >('cv_lut_apply');
+  late final _cv_lut_apply = _cv_lut_applyPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvLut>, ffi.Pointer<CvMat>)
+      >();
+
+  ffi.Pointer<CvFlowTracker> cv_flow_tracker_create(int winSize, int maxLevel) {
+    return _cv_flow_tracker_create(winSize, maxLevel);
+  }
+
+  late final _cv_flow_tracker_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvFlowTracker> Function(ffi.Int, ffi.Int)
+        >
+      >('cv_flow_tracker_create');
+  late final _cv_flow_tracker_create = _cv_flow_tracker_createPtr
+      .asFunction<ffi.Pointer<CvFlowTracker> Function(int, int)>();
+
+  void cv_flow_tracker_release(ffi.Pointer<CvFlowTracker> tracker) {
+    return _cv_flow_tracker_release(tracker);
+  }
+
+  late final _cv_flow_tracker_releasePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvFlowTracker>)>
+      >('cv_flow_tracker_release');
+  late final _cv_flow_tracker_release = _cv_flow_tracker_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvFlowTracker>)>();
+
+  void cv_flow_tracker_reset(ffi.Pointer<CvFlowTracker> tracker) {
+    return _cv_flow_tracker_reset(tracker);
+  }
+
+  late final _cv_flow_tracker_resetPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvFlowTracker>)>
+      >('cv_flow_tracker_reset');
+  late final _cv_flow_tracker_reset = _cv_flow_tracker_resetPtr
+      .asFunction<void Function(ffi.Pointer<CvFlowTracker>)>();
+
+  /// 새 프레임을 넣고 이전 프레임의 points (x, y) count 개를 추적. 이전 프레임이 없으면 0 반환 (프레임은 저장됨)
+  /// outPoints: count * 2, outStatus: count (1=성공), outError: count. 각각 nullptr 가능
+  int cv_flow_tracker_track(
+    ffi.Pointer<CvFlowTracker> tracker,
+    ffi.Pointer<CvMat> mat,
+    ffi.Pointer<ffi.Float> points,
+    int count,
+    ffi.Pointer<ffi.Float> outPoints,
+    ffi.Pointer<ffi.Uint8> outStatus,
+    ffi.Pointer<ffi.Float> outError,
+  ) {
+    return _cv_flow_tracker_track(
+      tracker,
+      mat,
+      points,
+      count,
+      outPoints,
+      outStatus,
+      outError,
+    );
+  }
+
+  late final _cv_flow_tracker_trackPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvFlowTracker>,
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<ffi.Float>,
+            ffi.Int,
+            ffi.Pointer<ffi.Float>,
+            ffi.Pointer<ffi.Uint8>,
+            ffi.Pointer<ffi.Float>,
+          )
+        >
+      >('cv_flow_tracker_track');
+  late final _cv_flow_tracker_track = _cv_flow_tracker_trackPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvFlowTracker>,
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<ffi.Float>,
+          int,
+          ffi.Pointer<ffi.Float>,
+          ffi.Pointer<ffi.Uint8>,
+          ffi.Pointer<ffi.Float>,
+        )
+      >();
+
+  /// 마지막 프레임에서 추적할 코너를 최대 maxCorners 개 검출해 outPoints (x, y) 에 기록하고 개수 반환
+  int cv_flow_tracker_detect(
+    ffi.Pointer<CvFlowTracker> tracker,
+    int maxCorners,
+    double quality,
+    double minDistance,
+    ffi.Pointer<ffi.Float> outPoints,
+  ) {
+    return _cv_flow_tracker_detect(
+      tracker,
+      maxCorners,
+      quality,
+      minDistance,
+      outPoints,
+    );
+  }
+
+  late final _cv_flow_tracker_detectPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvFlowTracker>,
+            ffi.Int,
+            ffi.Double,
+            ffi.Double,
+            ffi.Pointer<ffi.Float>,
+          )
+        >
+      >('cv_flow_tracker_detect');
+  late final _cv_flow_tracker_detect = _cv_flow_tracker_detectPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvFlowTracker>,
+          int,
+          double,
+          double,
+          ffi.Pointer<ffi.Float>,
+        )
+      >();
+
+  /// 조밀 옵티컬 플로우 (CV_32FC2). method: 0=DIS, 1=Farneback. preset: DIS 프리셋 (0=ultrafast, 1=fast, 2=medium)
+  ffi.Pointer<CvMat> cv_optical_flow_dense(
+    ffi.Pointer<CvMat> prev,
+    ffi.Pointer<CvMat> next,
+    int method,
+    int preset,
+  ) {
+    return _cv_optical_flow_dense(prev, next, method, preset);
+  }
+
+  late final _cv_optical_flow_densePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_optical_flow_dense');
+  late final _cv_optical_flow_dense = _cv_optical_flow_densePtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+        )
+      >();
+
+  /// 노이즈 제거
+  ffi.Pointer<CvMat> cv_fast_nl_means_denoising(
+    ffi.Pointer<CvMat> mat,
+    double h,
+    int templateWindowSize,
+    int searchWindowSize,
+  ) {
+    return _cv_fast_nl_means_denoising(
+      mat,
+      h,
+      templateWindowSize,
+      searchWindowSize,
+    );
+  }
+
+  late final _cv_fast_nl_means_denoisingPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Float,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_fast_nl_means_denoising');
+  late final _cv_fast_nl_means_denoising = _cv_fast_nl_means_denoisingPtr
+      .asFunction<
+        ffi.Pointer<CvMat> Function(ffi.Pointer<CvMat>, double, int, int)
+      >();
+
+  ffi.Pointer<CvMat> cv_fast_nl_means_denoising_colored(
+    ffi.Pointer<CvMat> mat,
+    double h,
+    double hColor,
+    int templateWindowSize,
+    int searchWindowSize,
+  ) {
+    return _cv_fast_nl_means_denoising_colored(
+      mat,
+      h,
+      hColor,
+      templateWindowSize,
+      searchWindowSize,
+    );
+  }
+
+  late final _cv_fast_nl_means_denoising_coloredPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(
+            ffi.Pointer<CvMat>,
+            ffi.Float,
+            ffi.Float,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_fast_nl_means_denoising_colored');
+  late final _cv_fast_nl_means_denoising_colored =
+      _cv_fast_nl_means_denoising_coloredPtr
+          .asFunction<
+            ffi.Pointer<CvMat> Function(
+              ffi.Pointer<CvMat>,
+              double,
+              double,
+              int,
+              int,
+            )
+          >();
+
+  ContoursResult cv_find_contours(
+    ffi.Pointer<CvMat> mat,
+    int mode,
+    int method,
+  ) {
+    return _cv_find_contours(mat, mode, method);
+  }
+
+  late final _cv_find_contoursPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ContoursResult Function(ffi.Pointer<CvMat>, ffi.Int, ffi.Int)
+        >
+      >('cv_find_contours');
+  late final _cv_find_contours = _cv_find_contoursPtr
+      .asFunction<ContoursResult Function(ffi.Pointer<CvMat>, int, int)>();
+
+  void cv_free_contours(ContoursResult result) {
+    return _cv_free_contours(result);
+  }
+
+  late final _cv_free_contoursPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ContoursResult)>>(
+        'cv_free_contours',
+      );
+  late final _cv_free_contours = _cv_free_contoursPtr
+      .asFunction<void Function(ContoursResult)>();
+
+  void cv_draw_contours(
+    ffi.Pointer<CvMat> mat,
+    ContoursResult contours,
+    int contourIdx,
+    int r,
+    int g,
+    int b,
+    int thickness,
+  ) {
+    return _cv_draw_contours(mat, contours, contourIdx, r, g, b, thickness);
+  }
+
+  late final _cv_draw_contoursPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvMat>,
+            ContoursResult,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_draw_contours');
+  late final _cv_draw_contours = _cv_draw_contoursPtr
+      .asFunction<
+        void Function(
+          ffi.Pointer<CvMat>,
+          ContoursResult,
+          int,
+          int,
+          int,
+          int,
+          int,
+        )
+      >();
+
+  /// 그리기
+  void cv_rectangle(
+    ffi.Pointer<CvMat> mat,
+    int x,
+    int y,
+    int width,
+    int height,
+    int r,
+    int g,
+    int b,
+    int thickness,
+  ) {
+    return _cv_rectangle(mat, x, y, width, height, r, g, b, thickness);
+  }
+
+  late final _cv_rectanglePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_rectangle');
+  late final _cv_rectangle = _cv_rectanglePtr
+      .asFunction<
+        void Function(
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+          int,
+          int,
+          int,
+          int,
+          int,
+          int,
+        )
+      >();
+
+  void cv_circle(
+    ffi.Pointer<CvMat> mat,
+    int centerX,
+    int centerY,
+    int radius,
+    int r,
+    int g,
+    int b,
+    int thickness,
+  ) {
+    return _cv_circle(mat, centerX, centerY, radius, r, g, b, thickness);
+  }
+
+  late final _cv_circlePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_circle');
+  late final _cv_circle = _cv_circlePtr
+      .asFunction<
+        void Function(ffi.Pointer<CvMat>, int, int, int, int, int, int, int)
+      >();
+
+  void cv_line(
+    ffi.Pointer<CvMat> mat,
+    int x1,
+    int y1,
+    int x2,
+    int y2,
+    int r,
+    int g,
+    int b,
+    int thickness,
+  ) {
+    return _cv_line(mat, x1, y1, x2, y2, r, g, b, thickness);
+  }
+
+  late final _cv_linePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvMat>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_line');
+  late final _cv_line = _cv_linePtr
+      .asFunction<
+        void Function(
+          ffi.Pointer<CvMat>,
+          int,
+          int,
+          int,
+          int,
+          int,
+          int,
+          int,
+          int,
+        )
+      >();
+
+  ffi.Pointer<CvVideoCapture> cv_videocapture_create(int index) {
+    return _cv_videocapture_create(index);
+  }
+
+  late final _cv_videocapture_createPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Pointer<CvVideoCapture> Function(ffi.Int)>
+      >('cv_videocapture_create');
+  late final _cv_videocapture_create = _cv_videocapture_createPtr
+      .asFunction<ffi.Pointer<CvVideoCapture> Function(int)>();
+
+  /// 동영상 파일/스트림 URL 열기. api: cv::CAP_* 백엔드 (0 이면 자동),
+  /// queueSize > 0 이면 백그라운드 스레드가 최대 queueSize 프레임을 미리 디코드, stride: N 프레임마다 한 장만 디코드
+  ffi.Pointer<CvVideoCapture> cv_videocapture_open(
+    ffi.Pointer<ffi.Char> path,
+    int api,
+    int queueSize,
+    int stride,
+  ) {
+    return _cv_videocapture_open(path, api, queueSize, stride);
+  }
+
+  late final _cv_videocapture_openPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvVideoCapture> Function(
+            ffi.Pointer<ffi.Char>,
+            ffi.Int,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_videocapture_open');
+  late final _cv_videocapture_open = _cv_videocapture_openPtr
+      .asFunction<
+        ffi.Pointer<CvVideoCapture> Function(
+          ffi.Pointer<ffi.Char>,
+          int,
+          int,
+          int,
+        )
+      >();
+
+  void cv_videocapture_release(ffi.Pointer<CvVideoCapture> cap) {
+    return _cv_videocapture_release(cap);
+  }
+
+  late final _cv_videocapture_releasePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoCapture>)>
+      >('cv_videocapture_release');
+  late final _cv_videocapture_release = _cv_videocapture_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvVideoCapture>)>();
+
+  int cv_videocapture_read(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvMat> dst,
+  ) {
+    return _cv_videocapture_read(cap, dst);
+  }
+
+  late final _cv_videocapture_readPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvVideoCapture>, ffi.Pointer<CvMat>)
+        >
+      >('cv_videocapture_read');
+  late final _cv_videocapture_read = _cv_videocapture_readPtr
+      .asFunction<
+        int Function(ffi.Pointer<CvVideoCapture>, ffi.Pointer<CvMat>)
+      >();
+
+  double cv_videocapture_get(ffi.Pointer<CvVideoCapture> cap, int propId) {
+    return _cv_videocapture_get(cap, propId);
+  }
+
+  late final _cv_videocapture_getPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Double Function(ffi.Pointer<CvVideoCapture>, ffi.Int)
+        >
+      >('cv_videocapture_get');
+  late final _cv_videocapture_get = _cv_videocapture_getPtr
+      .asFunction<double Function(ffi.Pointer<CvVideoCapture>, int)>();
+
+  void cv_videocapture_set(
+    ffi.Pointer<CvVideoCapture> cap,
+    int propId,
+    double value,
+  ) {
+    return _cv_videocapture_set(cap, propId, value);
+  }
+
+  late final _cv_videocapture_setPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvVideoCapture>, ffi.Int, ffi.Double)
+        >
+      >('cv_videocapture_set');
+  late final _cv_videocapture_set = _cv_videocapture_setPtr
+      .asFunction<void Function(ffi.Pointer<CvVideoCapture>, int, double)>();
+
+  /// 다음 read 가 frameIndex 프레임부터 반환하도록 이동 (미리 디코드된 프레임은 버리고 부착된 안정화기/디노이저는 초기화). 실패 시 0
+  int cv_videocapture_seek(ffi.Pointer<CvVideoCapture> cap, int frameIndex) {
+    return _cv_videocapture_seek(cap, frameIndex);
+  }
+
+  late final _cv_videocapture_seekPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvVideoCapture>, ffi.Int)
+        >
+      >('cv_videocapture_seek');
+  late final _cv_videocapture_seek = _cv_videocapture_seekPtr
+      .asFunction<int Function(ffi.Pointer<CvVideoCapture>, int)>();
+
+  /// 마지막 read 로 반환된 프레임 번호 (아직 없으면 -1)
+  int cv_videocapture_position(ffi.Pointer<CvVideoCapture> cap) {
+    return _cv_videocapture_position(cap);
+  }
+
+  late final _cv_videocapture_positionPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvVideoCapture>)>
+      >('cv_videocapture_position');
+  late final _cv_videocapture_position = _cv_videocapture_positionPtr
+      .asFunction<int Function(ffi.Pointer<CvVideoCapture>)>();
+
+  /// 단조 증가 시계 (ns)
+  int cv_monotonic_ns() {
+    return _cv_monotonic_ns();
+  }
+
+  late final _cv_monotonic_nsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function()>>(
+        'cv_monotonic_ns',
+      );
+  late final _cv_monotonic_ns = _cv_monotonic_nsPtr
+      .asFunction<int Function()>(isLeaf: true);
+
+  /// 마지막 read 로 반환된 프레임의 시각. 아직 없으면 0
+  int cv_videocapture_timing(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvFrameTiming> out,
+  ) {
+    return _cv_videocapture_timing(cap, out);
+  }
+
+  late final _cv_videocapture_timingPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Pointer<CvFrameTiming>,
+          )
+        >
+      >('cv_videocapture_timing');
+  late final _cv_videocapture_timing = _cv_videocapture_timingPtr
+      .asFunction<
+        int Function(ffi.Pointer<CvVideoCapture>, ffi.Pointer<CvFrameTiming>)
+      >();
+
+  /// 마지막 프레임의 표시/인코딩이 끝났음을 기록 (CV_LATENCY_END_TO_END)
+  void cv_videocapture_mark_done(ffi.Pointer<CvVideoCapture> cap) {
+    return _cv_videocapture_mark_done(cap);
+  }
+
+  late final _cv_videocapture_mark_donePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoCapture>)>
+      >('cv_videocapture_mark_done');
+  late final _cv_videocapture_mark_done = _cv_videocapture_mark_donePtr
+      .asFunction<void Function(ffi.Pointer<CvVideoCapture>)>();
+
+  /// stage 구간의 누적 지연 통계 (로그 구간 히스토그램 기반 p50/p95/p99)
+  int cv_videocapture_latency(
+    ffi.Pointer<CvVideoCapture> cap,
+    int stage,
+    ffi.Pointer<CvLatencyStats> out,
+  ) {
+    return _cv_videocapture_latency(cap, stage, out);
+  }
+
+  late final _cv_videocapture_latencyPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Int,
+            ffi.Pointer<CvLatencyStats>,
+          )
+        >
+      >('cv_videocapture_latency');
+  late final _cv_videocapture_latency = _cv_videocapture_latencyPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvVideoCapture>,
+          int,
+          ffi.Pointer<CvLatencyStats>,
+        )
+      >();
+
+  void cv_videocapture_latency_reset(ffi.Pointer<CvVideoCapture> cap) {
+    return _cv_videocapture_latency_reset(cap);
+  }
+
+  late final _cv_videocapture_latency_resetPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoCapture>)>
+      >('cv_videocapture_latency_reset');
+  late final _cv_videocapture_latency_reset = _cv_videocapture_latency_resetPtr
+      .asFunction<void Function(ffi.Pointer<CvVideoCapture>)>();
+
+  ffi.Pointer<CvTemporalDenoiser> cv_temporal_denoiser_create(
+    int mode,
+    int windowSize,
+    double h,
+    double alpha,
+    int motionThreshold,
+  ) {
+    return _cv_temporal_denoiser_create(
+      mode,
+      windowSize,
+      h,
+      alpha,
+      motionThreshold,
+    );
+  }
+
+  late final _cv_temporal_denoiser_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvTemporalDenoiser> Function(
+            ffi.Int,
+            ffi.Int,
+            ffi.Float,
+            ffi.Float,
+            ffi.Int,
+          )
+        >
+      >('cv_temporal_denoiser_create');
+  late final _cv_temporal_denoiser_create = _cv_temporal_denoiser_createPtr
+      .asFunction<
+        ffi.Pointer<CvTemporalDenoiser> Function(int, int, double, double, int)
+      >();
+
+  void cv_temporal_denoiser_release(ffi.Pointer<CvTemporalDenoiser> denoiser) {
+    return _cv_temporal_denoiser_release(denoiser);
+  }
+
+  late final _cv_temporal_denoiser_releasePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvTemporalDenoiser>)>
+      >('cv_temporal_denoiser_release');
+  late final _cv_temporal_denoiser_release = _cv_temporal_denoiser_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvTemporalDenoiser>)>();
+
+  void cv_temporal_denoiser_reset(ffi.Pointer<CvTemporalDenoiser> denoiser) {
+    return _cv_temporal_denoiser_reset(denoiser);
+  }
+
+  late final _cv_temporal_denoiser_resetPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvTemporalDenoiser>)>
+      >('cv_temporal_denoiser_reset');
+  late final _cv_temporal_denoiser_reset = _cv_temporal_denoiser_resetPtr
+      .asFunction<void Function(ffi.Pointer<CvTemporalDenoiser>)>();
+
+  /// 프레임을 넣고 디노이즈된 프레임을 dst 에 기록. 멀티 프레임 모드는 창 (windowSize 장) 이 찰 때까지 출력할 프레임이 없어 0
+  int cv_temporal_denoiser_process(
+    ffi.Pointer<CvTemporalDenoiser> denoiser,
+    ffi.Pointer<CvMat> src,
+    ffi.Pointer<CvMat> dst,
+  ) {
+    return _cv_temporal_denoiser_process(denoiser, src, dst);
+  }
+
+  late final _cv_temporal_denoiser_processPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvTemporalDenoiser>,
+            ffi.Pointer<CvMat>,
+            ffi.Pointer<CvMat>,
+          )
+        >
+      >('cv_temporal_denoiser_process');
+  late final _cv_temporal_denoiser_process = _cv_temporal_denoiser_processPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<CvTemporalDenoiser>,
+          ffi.Pointer<CvMat>,
+          ffi.Pointer<CvMat>,
+        )
+      >();
+
+  /// 캡처 스트림에 부착 (nullptr 이면 해제). read 시 프레임이 디노이즈되어 반환됨
+  void cv_videocapture_set_denoiser(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvTemporalDenoiser> denoiser,
+  ) {
+    return _cv_videocapture_set_denoiser(cap, denoiser);
+  }
+
+  late final _cv_videocapture_set_denoiserPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Pointer<CvTemporalDenoiser>,
+          )
+        >
+      >('cv_videocapture_set_denoiser');
+  late final _cv_videocapture_set_denoiser = _cv_videocapture_set_denoiserPtr
+      .asFunction<
+        void Function(
+          ffi.Pointer<CvVideoCapture>,
+          ffi.Pointer<CvTemporalDenoiser>,
+        )
+      >();
+
+  /// 리맵 캐시 부착 (nullptr 이면 해제). 노이즈 제거보다 먼저 적용됨
+  void cv_videocapture_set_remap(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvRemapCache> cache,
+  ) {
+    return _cv_videocapture_set_remap(cap, cache);
+  }
+
+  late final _cv_videocapture_set_remapPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Pointer<CvRemapCache>,
+          )
+        >
+      >('cv_videocapture_set_remap');
+  late final _cv_videocapture_set_remap = _cv_videocapture_set_remapPtr
+      .asFunction<
+        void Function(ffi.Pointer<CvVideoCapture>, ffi.Pointer<CvRemapCache>)
+      >();
+
+  /// step: 샘플링 격자 간격 (4 이면 1/16 픽셀), lowClip / highClip: 클리핑으로 볼 밝기
+  ffi.Pointer<CvFrameStatsCollector> cv_frame_stats_create(
+    int step,
+    int lowClip,
+    int highClip,
+  ) {
+    return _cv_frame_stats_create(step, lowClip, highClip);
+  }
+
+  late final _cv_frame_stats_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvFrameStatsCollector> Function(ffi.Int, ffi.Int, ffi.Int)
+        >
+      >('cv_frame_stats_create');
+  late final _cv_frame_stats_create = _cv_frame_stats_createPtr
+      .asFunction<ffi.Pointer<CvFrameStatsCollector> Function(int, int, int)>();
+
+  void cv_frame_stats_release(ffi.Pointer<CvFrameStatsCollector> collector) {
+    return _cv_frame_stats_release(collector);
+  }
+
+  late final _cv_frame_stats_releasePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<CvFrameStatsCollector>)
+        >
+      >('cv_frame_stats_release');
+  late final _cv_frame_stats_release = _cv_frame_stats_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvFrameStatsCollector>)>();
+
+  int cv_frame_stats_compute(
+    ffi.Pointer<CvFrameStatsCollector> collector,
+    ffi.Pointer<CvMat> mat,
+  ) {
+    return _cv_frame_stats_compute(collector, mat);
+  }
+
+  late final _cv_frame_stats_computePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvFrameStatsCollector>,
+            ffi.Pointer<CvMat>,
+          )
+        >
+      >('cv_frame_stats_compute');
+  late final _cv_frame_stats_compute = _cv_frame_stats_computePtr
+      .asFunction<
+        int Function(ffi.Pointer<CvFrameStatsCollector>, ffi.Pointer<CvMat>)
+      >();
+
+  /// 수집기 내부 구조체 포인터 (복사 없이 읽기, 수집기가 해제되기 전까지 유효)
+  ffi.Pointer<CvFrameStats> cv_frame_stats_get(
+    ffi.Pointer<CvFrameStatsCollector> collector,
+  ) {
+    return _cv_frame_stats_get(collector);
+  }
+
+  late final _cv_frame_stats_getPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvFrameStats> Function(ffi.Pointer<CvFrameStatsCollector>)
+        >
+      >('cv_frame_stats_get');
+  late final _cv_frame_stats_get = _cv_frame_stats_getPtr
+      .asFunction<
+        ffi.Pointer<CvFrameStats> Function(ffi.Pointer<CvFrameStatsCollector>)
+      >();
+
+  /// 캡처 스트림에 부착 (nullptr 이면 해제). read 시 최종 프레임의 통계가 갱신됨
+  void cv_videocapture_set_frame_stats(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvFrameStatsCollector> collector,
+  ) {
+    return _cv_videocapture_set_frame_stats(cap, collector);
+  }
+
+  late final _cv_videocapture_set_frame_statsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Pointer<CvFrameStatsCollector>,
+          )
+        >
+      >('cv_videocapture_set_frame_stats');
+  late final _cv_videocapture_set_frame_stats =
+      _cv_videocapture_set_frame_statsPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<CvVideoCapture>,
+              ffi.Pointer<CvFrameStatsCollector>,
+            )
+          >();
+
+  /// method: 0=이동 평균 배경 차분, 1=MOG2, 2=KNN. maxSide: 처리 해상도의 긴 변, minArea: 축소 좌표 기준 최소 영역 넓이
+  ffi.Pointer<CvMotionDetector> cv_motion_detector_create(
+    int method,
+    int maxSide,
+    double learningRate,
+    int threshold,
+    int minArea,
+  ) {
+    return _cv_motion_detector_create(
+      method,
+      maxSide,
+      learningRate,
+      threshold,
+      minArea,
+    );
+  }
+
+  late final _cv_motion_detector_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMotionDetector> Function(
+            ffi.Int,
+            ffi.Int,
+            ffi.Double,
+            ffi.Int,
+            ffi.Int,
+          )
+        >
+      >('cv_motion_detector_create');
+  late final _cv_motion_detector_create = _cv_motion_detector_createPtr
+      .asFunction<
+        ffi.Pointer<CvMotionDetector> Function(int, int, double, int, int)
+      >();
+
+  void cv_motion_detector_release(ffi.Pointer<CvMotionDetector> detector) {
+    return _cv_motion_detector_release(detector);
+  }
+
+  late final _cv_motion_detector_releasePtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvMotionDetector>)>
+      >('cv_motion_detector_release');
+  late final _cv_motion_detector_release = _cv_motion_detector_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvMotionDetector>)>();
+
+  void cv_motion_detector_reset(ffi.Pointer<CvMotionDetector> detector) {
+    return _cv_motion_detector_reset(detector);
+  }
+
+  late final _cv_motion_detector_resetPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvMotionDetector>)>
+      >('cv_motion_detector_reset');
+  late final _cv_motion_detector_reset = _cv_motion_detector_resetPtr
+      .asFunction<void Function(ffi.Pointer<CvMotionDetector>)>();
+
+  int cv_motion_detector_process(
+    ffi.Pointer<CvMotionDetector> detector,
+    ffi.Pointer<CvMat> mat,
+  ) {
+    return _cv_motion_detector_process(detector, mat);
+  }
+
+  late final _cv_motion_detector_processPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvMotionDetector>, ffi.Pointer<CvMat>)
+        >
+      >('cv_motion_detector_process');
+  late final _cv_motion_detector_process = _cv_motion_detector_processPtr
+      .asFunction<
+        int Function(ffi.Pointer<CvMotionDetector>, ffi.Pointer<CvMat>)
+      >();
+
+  /// 마지막 프레임에서 움직인 픽셀 비율 (0~1)
+  double cv_motion_detector_activity(ffi.Pointer<CvMotionDetector> detector) {
+    return _cv_motion_detector_activity(detector);
+  }
+
+  late final _cv_motion_detector_activityPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Double Function(ffi.Pointer<CvMotionDetector>)>
+      >('cv_motion_detector_activity');
+  late final _cv_motion_detector_activity = _cv_motion_detector_activityPtr
+      .asFunction<double Function(ffi.Pointer<CvMotionDetector>)>();
+
+  /// 움직임 영역 (x, y, width, height) 을 원본 좌표로 최대 maxBoxes 개 기록하고 개수 반환. outBoxes 가 nullptr 이면 전체 개수만 반환
+  int cv_motion_detector_boxes(
+    ffi.Pointer<CvMotionDetector> detector,
+    ffi.Pointer<ffi.Int> outBoxes,
+    int maxBoxes,
+  ) {
+    return _cv_motion_detector_boxes(detector, outBoxes, maxBoxes);
+  }
+
+  late final _cv_motion_detector_boxesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(
+            ffi.Pointer<CvMotionDetector>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Int,
+          )
+        >
+      >('cv_motion_detector_boxes');
+  late final _cv_motion_detector_boxes = _cv_motion_detector_boxesPtr
+      .asFunction<
+        int Function(ffi.Pointer<CvMotionDetector>, ffi.Pointer<ffi.Int>, int)
+      >();
+
+  /// 마지막 움직임 마스크 (축소 해상도) 복사본
+  ffi.Pointer<CvMat> cv_motion_detector_mask(
+    ffi.Pointer<CvMotionDetector> detector,
+  ) {
+    return _cv_motion_detector_mask(detector);
+  }
+
+  late final _cv_motion_detector_maskPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvMat> Function(ffi.Pointer<CvMotionDetector>)
+        >
+      >('cv_motion_detector_mask');
+  late final _cv_motion_detector_mask = _cv_motion_detector_maskPtr
+      .asFunction<ffi.Pointer<CvMat> Function(ffi.Pointer<CvMotionDetector>)>();
+
+  /// 캡처 스트림에 부착 (nullptr 이면 해제). read 시 최종 프레임으로 갱신됨
+  void cv_videocapture_set_motion_detector(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvMotionDetector> detector,
+  ) {
+    return _cv_videocapture_set_motion_detector(cap, detector);
+  }
+
+  late final _cv_videocapture_set_motion_detectorPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Void Function(
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Pointer<CvMotionDetector>,
+          )
+        >
+      >('cv_videocapture_set_motion_detector');
+  late final _cv_videocapture_set_motion_detector =
+      _cv_videocapture_set_motion_detectorPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<CvVideoCapture>,
+              ffi.Pointer<CvMotionDetector>,
+            )
+          >();
+
+  /// radius: 궤적 평활화 반경 (앞뒤 프레임 수), zoom: 가장자리를 가리기 위한 확대 비율 (>= 1), maxSide: 움직임 추정 해상도의 긴 변
+  ffi.Pointer<CvStabilizer> cv_stabilizer_create(
+    int radius,
+    double zoom,
+    int maxSide,
+  ) {
+    return _cv_stabilizer_create(radius, zoom, maxSide);
+  }
+
+  late final _cv_stabilizer_createPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Pointer<CvStabilizer> Function(ffi.Int, ffi.Double, ffi.Int)
+        >
+      >('cv_stabilizer_create');
+  late final _cv_stabilizer_create = _cv_stabilizer_createPtr
+      .asFunction<ffi.Pointer<CvStabilizer> Function(int, double, int)>();
+
+  void cv_stabilizer_release(ffi.Pointer<CvStabilizer> stabilizer) {
+    return _cv_stabilizer_release(stabilizer);
+  }
+
+  late final _cv_stabilizer_releasePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvStabilizer>)>>(
+        'cv_stabilizer_release',
+      );
+  late final _cv_stabilizer_release = _cv_stabilizer_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvStabilizer>)>();
+
+  void cv_stabilizer_reset(ffi.Pointer<CvStabilizer> stabilizer) {
+    return _cv_stabilizer_reset(stabilizer);
+  }
+
+  late final _cv_stabilizer_resetPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvStabilizer>)>>(
+        'cv_stabilizer_reset',
+      );
+  late final _cv_stabilizer_reset = _cv_stabilizer_resetPtr
+      .asFunction<void Function(ffi.Pointer<CvStabilizer>)>();
+
+  /// 프레임을 넣고 radius 프레임 전의 보정된 프레임을 dst 에 기록. 아직 출력할 프레임이 없으면 0
+  int cv_stabilizer_process(
+    ffi.Pointer<CvStabilizer> stabilizer,
+    ffi.Pointer<CvMat> src,
+    ffi.Pointer<CvMat> dst,
   ) {
-    return _cv_rectangle(mat, x, y, width, height, r, g, b, thickness);
+    return _cv_stabilizer_process(stabilizer, src, dst);
   }
 
-  late final _cv_rectanglePtr =
+  late final _cv_stabilizer_processPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Void Function(
+          ffi.Int Function(
+            ffi.Pointer<CvStabilizer>,
+            ffi.Pointer<CvMat>,
             ffi.Pointer<CvMat>,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
           )
         >
-      >('cv_rectangle');
-  late final _cv_rectangle = _cv_rectanglePtr
+      >('cv_stabilizer_process');
+  late final _cv_stabilizer_process = _cv_stabilizer_processPtr
       .asFunction<
-        void Function(
+        int Function(
+          ffi.Pointer<CvStabilizer>,
+          ffi.Pointer<CvMat>,
           ffi.Pointer<CvMat>,
-          int,
-          int,
-          int,
-          int,
-          int,
-          int,
-          int,
-          int,
         )
       >();
 
-  void cv_circle(
-    ffi.Pointer<CvMat> mat,
-    int centerX,
-    int centerY,
-    int radius,
-    int r,
-    int g,
-    int b,
-    int thickness,
+  /// 마지막 프레임의 처리 시간 (ms)
+  double cv_stabilizer_latency_ms(ffi.Pointer<CvStabilizer> stabilizer) {
+    return _cv_stabilizer_latency_ms(stabilizer);
+  }
+
+  late final _cv_stabilizer_latency_msPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Double Function(ffi.Pointer<CvStabilizer>)>
+      >('cv_stabilizer_latency_ms');
+  late final _cv_stabilizer_latency_ms = _cv_stabilizer_latency_msPtr
+      .asFunction<double Function(ffi.Pointer<CvStabilizer>)>();
+
+  /// 출력 지연 프레임 수
+  int cv_stabilizer_delay_frames(ffi.Pointer<CvStabilizer> stabilizer) {
+    return _cv_stabilizer_delay_frames(stabilizer);
+  }
+
+  late final _cv_stabilizer_delay_framesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvStabilizer>)>>(
+        'cv_stabilizer_delay_frames',
+      );
+  late final _cv_stabilizer_delay_frames = _cv_stabilizer_delay_framesPtr
+      .asFunction<int Function(ffi.Pointer<CvStabilizer>)>();
+
+  /// 캡처 스트림에 부착 (nullptr 이면 해제). 리맵 뒤, 노이즈 제거 앞에 적용됨
+  void cv_videocapture_set_stabilizer(
+    ffi.Pointer<CvVideoCapture> cap,
+    ffi.Pointer<CvStabilizer> stabilizer,
   ) {
-    return _cv_circle(mat, centerX, centerY, radius, r, g, b, thickness);
+    return _cv_videocapture_set_stabilizer(cap, stabilizer);
   }
 
-  late final _cv_circlePtr =
+  late final _cv_videocapture_set_stabilizerPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Void Function(
-            ffi.Pointer<CvMat>,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
+            ffi.Pointer<CvVideoCapture>,
+            ffi.Pointer<CvStabilizer>,
           )
         >
-      >('cv_circle');
-  late final _cv_circle = _cv_circlePtr
-      .asFunction<
-        void Function(ffi.Pointer<CvMat>, int, int, int, int, int, int, int)
-      >();
+      >('cv_videocapture_set_stabilizer');
+  late final _cv_videocapture_set_stabilizer =
+      _cv_videocapture_set_stabilizerPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<CvVideoCapture>,
+              ffi.Pointer<CvStabilizer>,
+            )
+          >();
 
-  void cv_line(
-    ffi.Pointer<CvMat> mat,
-    int x1,
-    int y1,
-    int x2,
-    int y2,
-    int r,
-    int g,
-    int b,
-    int thickness,
+  /// fourcc: 코덱 4 글자 (예: "mp4v", "MJPG"), queueSize: 대기 가능한 프레임 수,
+  /// dropWhenFull: 1 이면 큐가 가득 찼을 때 새 프레임을 버림, 0 이면 빈자리가 날 때까지 대기
+  ffi.Pointer<CvVideoWriter> cv_videowriter_open(
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<ffi.Char> fourcc,
+    double fps,
+    int width,
+    int height,
+    int isColor,
+    int queueSize,
+    int dropWhenFull,
   ) {
-    return _cv_line(mat, x1, y1, x2, y2, r, g, b, thickness);
+    return _cv_videowriter_open(
+      path,
+      fourcc,
+      fps,
+      width,
+      height,
+      isColor,
+      queueSize,
+      dropWhenFull,
+    );
   }
 
-  late final _cv_linePtr =
+  late final _cv_videowriter_openPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Void Function(
-            ffi.Pointer<CvMat>,
-            ffi.Int,
-            ffi.Int,
-            ffi.Int,
+          ffi.Pointer<CvVideoWriter> Function(
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Double,
             ffi.Int,
             ffi.Int,
             ffi.Int,
@@ -753,14 +3083,13 @@ class FlutterOpencvBindings {
             ffi.Int,
           )
         >
-      >('cv_line');
-  late final _cv_line = _cv_linePtr
+      >('cv_videowriter_open');
+  late final _cv_videowriter_open = _cv_videowriter_openPtr
       .asFunction<
-        void Function(
-          ffi.Pointer<CvMat>,
-          int,
-          int,
-          int,
+        ffi.Pointer<CvVideoWriter> Function(
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          double,
           int,
           int,
           int,
@@ -769,75 +3098,81 @@ class FlutterOpencvBindings {
         )
       >();
 
-  ffi.Pointer<CvVideoCapture> cv_videocapture_create(int index) {
-    return _cv_videocapture_create(index);
-  }
-
-  late final _cv_videocapture_createPtr =
-      _lookup<
-        ffi.NativeFunction<ffi.Pointer<CvVideoCapture> Function(ffi.Int)>
-      >('cv_videocapture_create');
-  late final _cv_videocapture_create = _cv_videocapture_createPtr
-      .asFunction<ffi.Pointer<CvVideoCapture> Function(int)>();
-
-  void cv_videocapture_release(ffi.Pointer<CvVideoCapture> cap) {
-    return _cv_videocapture_release(cap);
+  /// 남은 프레임을 모두 기록하고 해제
+  void cv_videowriter_release(ffi.Pointer<CvVideoWriter> writer) {
+    return _cv_videowriter_release(writer);
   }
 
-  late final _cv_videocapture_releasePtr =
+  late final _cv_videowriter_releasePtr =
       _lookup<
-        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoCapture>)>
-      >('cv_videocapture_release');
-  late final _cv_videocapture_release = _cv_videocapture_releasePtr
-      .asFunction<void Function(ffi.Pointer<CvVideoCapture>)>();
-
-  int cv_videocapture_read(
-    ffi.Pointer<CvVideoCapture> cap,
-    ffi.Pointer<CvMat> dst,
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoWriter>)>
+      >('cv_videowriter_release');
+  late final _cv_videowriter_release = _cv_videowriter_releasePtr
+      .asFunction<void Function(ffi.Pointer<CvVideoWriter>)>();
+
+  /// frame 을 큐로 이동 (성공 시 frame 은 빈 Mat 이 됨). 버려지거나 실패하면 0 을 반환하고 frame 은 그대로
+  int cv_videowriter_write(
+    ffi.Pointer<CvVideoWriter> writer,
+    ffi.Pointer<CvMat> frame,
   ) {
-    return _cv_videocapture_read(cap, dst);
+    return _cv_videowriter_write(writer, frame);
   }
 
-  late final _cv_videocapture_readPtr =
+  late final _cv_videowriter_writePtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Int Function(ffi.Pointer<CvVideoCapture>, ffi.Pointer<CvMat>)
+          ffi.Int Function(ffi.Pointer<CvVideoWriter>, ffi.Pointer<CvMat>)
         >
-      >('cv_videocapture_read');
-  late final _cv_videocapture_read = _cv_videocapture_readPtr
+      >('cv_videowriter_write');
+  late final _cv_videowriter_write = _cv_videowriter_writePtr
       .asFunction<
-        int Function(ffi.Pointer<CvVideoCapture>, ffi.Pointer<CvMat>)
+        int Function(ffi.Pointer<CvVideoWriter>, ffi.Pointer<CvMat>)
       >();
 
-  double cv_videocapture_get(ffi.Pointer<CvVideoCapture> cap, int propId) {
-    return _cv_videocapture_get(cap, propId);
+  /// 남은 프레임을 모두 기록하고 파일을 닫음 (이후 write 는 0)
+  void cv_videowriter_close(ffi.Pointer<CvVideoWriter> writer) {
+    return _cv_videowriter_close(writer);
   }
 
-  late final _cv_videocapture_getPtr =
+  late final _cv_videowriter_closePtr =
       _lookup<
-        ffi.NativeFunction<
-          ffi.Double Function(ffi.Pointer<CvVideoCapture>, ffi.Int)
-        >
-      >('cv_videocapture_get');
-  late final _cv_videocapture_get = _cv_videocapture_getPtr
-      .asFunction<double Function(ffi.Pointer<CvVideoCapture>, int)>();
+        ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoWriter>)>
+      >('cv_videowriter_close');
+  late final _cv_videowriter_close = _cv_videowriter_closePtr
+      .asFunction<void Function(ffi.Pointer<CvVideoWriter>)>();
 
-  void cv_videocapture_set(
-    ffi.Pointer<CvVideoCapture> cap,
-    int propId,
-    double value,
-  ) {
-    return _cv_videocapture_set(cap, propId, value);
+  int cv_videowriter_pending(ffi.Pointer<CvVideoWriter> writer) {
+    return _cv_videowriter_pending(writer);
   }
 
-  late final _cv_videocapture_setPtr =
-      _lookup<
-        ffi.NativeFunction<
-          ffi.Void Function(ffi.Pointer<CvVideoCapture>, ffi.Int, ffi.Double)
-        >
-      >('cv_videocapture_set');
-  late final _cv_videocapture_set = _cv_videocapture_setPtr
-      .asFunction<void Function(ffi.Pointer<CvVideoCapture>, int, double)>();
+  late final _cv_videowriter_pendingPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvVideoWriter>)>>(
+        'cv_videowriter_pending',
+      );
+  late final _cv_videowriter_pending = _cv_videowriter_pendingPtr
+      .asFunction<int Function(ffi.Pointer<CvVideoWriter>)>();
+
+  int cv_videowriter_written(ffi.Pointer<CvVideoWriter> writer) {
+    return _cv_videowriter_written(writer);
+  }
+
+  late final _cv_videowriter_writtenPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvVideoWriter>)>>(
+        'cv_videowriter_written',
+      );
+  late final _cv_videowriter_written = _cv_videowriter_writtenPtr
+      .asFunction<int Function(ffi.Pointer<CvVideoWriter>)>();
+
+  int cv_videowriter_dropped(ffi.Pointer<CvVideoWriter> writer) {
+    return _cv_videowriter_dropped(writer);
+  }
+
+  late final _cv_videowriter_droppedPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvVideoWriter>)>>(
+        'cv_videowriter_dropped',
+      );
+  late final _cv_videowriter_dropped = _cv_videowriter_droppedPtr
+      .asFunction<int Function(ffi.Pointer<CvVideoWriter>)>();
 
   /// 속성 접근자
   int cv_mat_width(ffi.Pointer<CvMat> mat) {
@@ -849,7 +3184,7 @@ class FlutterOpencvBindings {
         'cv_mat_width',
       );
   late final _cv_mat_width = _cv_mat_widthPtr
-      .asFunction<int Function(ffi.Pointer<CvMat>)>();
+      .asFunction<int Function(ffi.Pointer<CvMat>)>(isLeaf: true);
 
   int cv_mat_height(ffi.Pointer<CvMat> mat) {
     return _cv_mat_height(mat);
@@ -860,7 +3195,7 @@ class FlutterOpencvBindings {
         'cv_mat_height',
       );
   late final _cv_mat_height = _cv_mat_heightPtr
-      .asFunction<int Function(ffi.Pointer<CvMat>)>();
+      .asFunction<int Function(ffi.Pointer<CvMat>)>(isLeaf: true);
 
   int cv_mat_channels(ffi.Pointer<CvMat> mat) {
     return _cv_mat_channels(mat);
@@ -871,7 +3206,7 @@ class FlutterOpencvBindings {
         'cv_mat_channels',
       );
   late final _cv_mat_channels = _cv_mat_channelsPtr
-      .asFunction<int Function(ffi.Pointer<CvMat>)>();
+      .asFunction<int Function(ffi.Pointer<CvMat>)>(isLeaf: true);
 
   ffi.Pointer<ffi.Uint8> cv_mat_data(ffi.Pointer<CvMat> mat) {
     return _cv_mat_data(mat);
@@ -882,7 +3217,9 @@ class FlutterOpencvBindings {
         ffi.NativeFunction<ffi.Pointer<ffi.Uint8> Function(ffi.Pointer<CvMat>)>
       >('cv_mat_data');
   late final _cv_mat_data = _cv_mat_dataPtr
-      .asFunction<ffi.Pointer<ffi.Uint8> Function(ffi.Pointer<CvMat>)>();
+      .asFunction<
+        ffi.Pointer<ffi.Uint8> Function(ffi.Pointer<CvMat>)
+      >(isLeaf: true);
 
   int cv_mat_data_len(ffi.Pointer<CvMat> mat) {
     return _cv_mat_data_len(mat);
@@ -893,7 +3230,137 @@ class FlutterOpencvBindings {
         'cv_mat_data_len',
       );
   late final _cv_mat_data_len = _cv_mat_data_lenPtr
-      .asFunction<int Function(ffi.Pointer<CvMat>)>();
+      .asFunction<int Function(ffi.Pointer<CvMat>)>(isLeaf: true);
+
+  /// 크기/타입/행 간격/연속성을 out 에 채움. mat 이 nullptr 이면 0
+  int cv_mat_info(ffi.Pointer<CvMat> mat, ffi.Pointer<CvMatInfo> out) {
+    return _cv_mat_info(mat, out);
+  }
+
+  late final _cv_mat_infoPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int Function(ffi.Pointer<CvMat>, ffi.Pointer<CvMatInfo>)
+        >
+      >('cv_mat_info');
+  late final _cv_mat_info = _cv_mat_infoPtr
+      .asFunction<
+        int Function(ffi.Pointer<CvMat>, ffi.Pointer<CvMatInfo>)
+      >(isLeaf: true);
+
+  /// 계측 켜기/끄기 (꺼져 있으면 호출당 원자 변수 한 번 읽는 비용만 남음)
+  void cv_stats_enable(int enabled) {
+    return _cv_stats_enable(enabled);
+  }
+
+  late final _cv_stats_enablePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int)>>(
+        'cv_stats_enable',
+      );
+  late final _cv_stats_enable = _cv_stats_enablePtr
+      .asFunction<void Function(int)>();
+
+  int cv_stats_enabled() {
+    return _cv_stats_enabled();
+  }
+
+  late final _cv_stats_enabledPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function()>>(
+        'cv_stats_enabled',
+      );
+  late final _cv_stats_enabled = _cv_stats_enabledPtr
+      .asFunction<int Function()>(isLeaf: true);
+
+  /// 모든 스레드의 통계를 합쳐 총 시간 내림차순으로 out 에 기록. out 이 nullptr 이면 항목 수만 반환
+  int cv_stats_snapshot(ffi.Pointer<CvCallStats> out, int maxEntries) {
+    return _cv_stats_snapshot(out, maxEntries);
+  }
+
+  late final _cv_stats_snapshotPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int Function(ffi.Pointer<CvCallStats>, ffi.Int)>
+      >('cv_stats_snapshot');
+  late final _cv_stats_snapshot = _cv_stats_snapshotPtr
+      .asFunction<int Function(ffi.Pointer<CvCallStats>, int)>();
+
+  /// 같은 내용을 JSON 으로 반환 (cv_free_bytes 로 해제)
+  BytesResult cv_stats_json() {
+    return _cv_stats_json();
+  }
+
+  late final _cv_stats_jsonPtr =
+      _lookup<ffi.NativeFunction<BytesResult Function()>>(
+        'cv_stats_json',
+      );
+  late final _cv_stats_json = _cv_stats_jsonPtr
+      .asFunction<BytesResult Function()>();
+
+  void cv_stats_reset() {
+    return _cv_stats_reset();
+  }
+
+  late final _cv_stats_resetPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>(
+        'cv_stats_reset',
+      );
+  late final _cv_stats_reset = _cv_stats_resetPtr.asFunction<void Function()>();
+
+  /// trace span 기록 켜기/끄기. 모든 cv_* 호출 (leaf 접근자 제외) 과 캡처/기록 파이프라인 단계, 내부 parallel_for_ 조각이 스레드별 링 버퍼 (최근 4096 개) 에 기록됨
+  void cv_trace_enable(int enabled) {
+    return _cv_trace_enable(enabled);
+  }
+
+  late final _cv_trace_enablePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int)>>(
+        'cv_trace_enable',
+      );
+  late final _cv_trace_enable = _cv_trace_enablePtr
+      .asFunction<void Function(int)>();
+
+  int cv_trace_enabled() {
+    return _cv_trace_enabled();
+  }
+
+  late final _cv_trace_enabledPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function()>>(
+        'cv_trace_enabled',
+      );
+  late final _cv_trace_enabled = _cv_trace_enabledPtr
+      .asFunction<int Function()>(isLeaf: true);
+
+  /// 호출 스레드의 trace 이름 (예: "dart_ui")
+  void cv_trace_set_thread_name(ffi.Pointer<ffi.Char> name) {
+    return _cv_trace_set_thread_name(name);
+  }
+
+  late final _cv_trace_set_thread_namePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Char>)>>(
+        'cv_trace_set_thread_name',
+      );
+  late final _cv_trace_set_thread_name = _cv_trace_set_thread_namePtr
+      .asFunction<void Function(ffi.Pointer<ffi.Char>)>();
+
+  /// Chrome trace-event JSON 으로 내보내기 (Perfetto 에서 열 수 있음, cv_free_bytes 로 해제). 시각은 cv_monotonic_ns 기준
+  BytesResult cv_trace_export() {
+    return _cv_trace_export();
+  }
+
+  late final _cv_trace_exportPtr =
+      _lookup<ffi.NativeFunction<BytesResult Function()>>(
+        'cv_trace_export',
+      );
+  late final _cv_trace_export = _cv_trace_exportPtr
+      .asFunction<BytesResult Function()>();
+
+  void cv_trace_reset() {
+    return _cv_trace_reset();
+  }
+
+  late final _cv_trace_resetPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>(
+        'cv_trace_reset',
+      );
+  late final _cv_trace_reset = _cv_trace_resetPtr.asFunction<void Function()>();
 
   late final addresses = _SymbolAddresses(this);
 }
@@ -907,6 +3374,38 @@ class _SymbolAddresses {
     ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoCapture>)>
   >
   get cv_videocapture_release => _library._cv_videocapture_releasePtr;
+  ffi.Pointer<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvTemporalDenoiser>)>
+  >
+  get cv_temporal_denoiser_release => _library._cv_temporal_denoiser_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvKernel>)>>
+  get cv_kernel_release => _library._cv_kernel_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvIntegral>)>>
+  get cv_integral_release => _library._cv_integral_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvRemapCache>)>>
+  get cv_remap_cache_release => _library._cv_remap_cache_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvCalibration>)>>
+  get cv_calibration_release => _library._cv_calibration_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvPyramid>)>>
+  get cv_pyramid_release => _library._cv_pyramid_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvClahe>)>>
+  get cv_clahe_release => _library._cv_clahe_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvLut>)>>
+  get cv_lut_release => _library._cv_lut_releasePtr;
+  ffi.Pointer<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvFrameStatsCollector>)>
+  >
+  get cv_frame_stats_release => _library._cv_frame_stats_releasePtr;
+  ffi.Pointer<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvMotionDetector>)>
+  >
+  get cv_motion_detector_release => _library._cv_motion_detector_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvFlowTracker>)>>
+  get cv_flow_tracker_release => _library._cv_flow_tracker_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvStabilizer>)>>
+  get cv_stabilizer_release => _library._cv_stabilizer_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<CvVideoWriter>)>>
+  get cv_videowriter_release => _library._cv_videowriter_releasePtr;
 }
 
 /// cv::Mat 포인터
@@ -920,6 +3419,38 @@ final class BytesResult extends ffi.Struct {
   external int len;
 }
 
+/// 리맵 캐시 포인터. 반복되는 기하 변환을 고정소수점 테이블로 한 번만 계산해 재사용
+typedef CvRemapCache = ffi.Void;
+typedef DartCvRemapCache = void;
+
+/// 카메라 보정 포인터 (체스보드 관측값과 내부 파라미터 / 왜곡 계수)
+typedef CvCalibration = ffi.Void;
+typedef DartCvCalibration = void;
+
+/// 영상 피라미드 포인터. 레벨은 처음 접근할 때 바로 아래 레벨에서 계산되어 캐시됨
+typedef CvPyramid = ffi.Void;
+typedef DartCvPyramid = void;
+
+/// 커널 포인터 (shape: 0=사각형, 1=십자형, 2=타원형). 한 번 만들어 여러 호출에 재사용
+typedef CvKernel = ffi.Void;
+typedef DartCvKernel = void;
+
+/// 적분 영상 포인터. flags: 1=제곱합, 2=기울어진(45도) 합 추가 계산
+typedef CvIntegral = ffi.Void;
+typedef DartCvIntegral = void;
+
+/// CLAHE 포인터 (프레임 간 재사용)
+typedef CvClahe = ffi.Void;
+typedef DartCvClahe = void;
+
+/// 룩업 테이블 포인터. 톤 연산을 순서대로 합성해 한 번의 패스로 적용
+typedef CvLut = ffi.Void;
+typedef DartCvLut = void;
+
+/// 옵티컬 플로우 추적기 포인터. 이전 프레임의 피라미드를 보관해 재사용
+typedef CvFlowTracker = ffi.Void;
+typedef DartCvFlowTracker = void;
+
 /// 컨투어 관련
 final class ContoursResult extends ffi.Struct {
   external ffi.Pointer<ffi.Pointer<ffi.Int>> contours;
@@ -933,3 +3464,157 @@ final class ContoursResult extends ffi.Struct {
 /// cv::VideoCapture 포인터
 typedef CvVideoCapture = ffi.Void;
 typedef DartCvVideoCapture = void;
+
+/// 프레임 시각 (cv_monotonic_ns 기준 ns). capture: grab 완료, dequeue: read 가 받은 시점, processed: 부착 단계 처리 완료
+final class CvFrameTiming extends ffi.Struct {
+  @ffi.Int64()
+  external int frameIndex;
+
+  @ffi.Int64()
+  external int captureNs;
+
+  @ffi.Int64()
+  external int dequeueNs;
+
+  @ffi.Int64()
+  external int processedNs;
+}
+
+final class CvLatencyStats extends ffi.Struct {
+  @ffi.Int64()
+  external int count;
+
+  @ffi.Double()
+  external double meanMs;
+
+  @ffi.Double()
+  external double p50Ms;
+
+  @ffi.Double()
+  external double p95Ms;
+
+  @ffi.Double()
+  external double p99Ms;
+
+  @ffi.Double()
+  external double maxMs;
+}
+
+/// 시간적 노이즈 제거기 포인터 (mode: 0=움직임 적응형 재귀 평균, 1=멀티 프레임 NL-Means)
+typedef CvTemporalDenoiser = ffi.Void;
+typedef DartCvTemporalDenoiser = void;
+
+/// 프레임 통계 (자동 노출 / 화이트 밸런스용). 수집기 안에 있으며 매 프레임 덮어씀
+final class CvFrameStats extends ffi.Struct {
+  /// 밝기 히스토그램 (샘플 수 기준)
+  @ffi.Array.multi([256])
+  external ffi.Array<ffi.Uint32> histogram;
+
+  @ffi.Uint32()
+  external int samples;
+
+  @ffi.Uint32()
+  external int frameCount;
+
+  @ffi.Float()
+  external double meanLuma;
+
+  /// lowClip 이하 / highClip 이상인 샘플 비율 (0~1)
+  @ffi.Float()
+  external double clipLow;
+
+  @ffi.Float()
+  external double clipHigh;
+
+  /// B, G, R, A 채널 평균
+  @ffi.Array.multi([4])
+  external ffi.Array<ffi.Float> channelMeans;
+
+  /// Gray-world 화이트 밸런스 게인 (B, G, R)
+  @ffi.Array.multi([3])
+  external ffi.Array<ffi.Float> grayWorldGains;
+}
+
+/// 프레임 통계 수집기 포인터
+typedef CvFrameStatsCollector = ffi.Void;
+typedef DartCvFrameStatsCollector = void;
+
+/// 움직임 검출기 포인터 (축소한 그레이 프레임에서 배경 차분)
+typedef CvMotionDetector = ffi.Void;
+typedef DartCvMotionDetector = void;
+
+/// 영상 안정화기 포인터. 출력은 radius 프레임 지연됨
+typedef CvStabilizer = ffi.Void;
+typedef DartCvStabilizer = void;
+
+/// 비동기 동영상 기록기 포인터 (쓰기 스레드 + 크기 제한 프레임 큐)
+typedef CvVideoWriter = ffi.Void;
+typedef DartCvVideoWriter = void;
+
+/// Mat 속성을 한 번의 호출로 조회 (cv_mat_info)
+final class CvMatInfo extends ffi.Struct {
+  @ffi.Int32()
+  external int width;
+
+  @ffi.Int32()
+  external int height;
+
+  @ffi.Int32()
+  external int channels;
+
+  /// OpenCV 타입 (CV_8UC3 등) 과 깊이 (CV_8U 등)
+  @ffi.Int32()
+  external int type;
+
+  @ffi.Int32()
+  external int depth;
+
+  /// 픽셀당 바이트
+  @ffi.Int32()
+  external int elemSize;
+
+  /// 행 간격 (바이트)
+  @ffi.Int64()
+  external int step;
+
+  /// total * elemSize (바이트)
+  @ffi.Int64()
+  external int dataLen;
+
+  /// 행 사이에 여백이 없으면 1 (data 를 하나의 버퍼로 읽을 수 있음)
+  @ffi.Int32()
+  external int continuous;
+
+  @ffi.Int32()
+  external int empty;
+}
+
+/// 함수별 호출 통계 (cv_stats_enable(1) 이후의 호출만 기록)
+final class CvCallStats extends ffi.Struct {
+  @ffi.Array.multi([64])
+  external ffi.Array<ffi.Char> name;
+
+  @ffi.Int64()
+  external int calls;
+
+  @ffi.Int64()
+  external int totalNs;
+
+  @ffi.Int64()
+  external int minNs;
+
+  @ffi.Int64()
+  external int maxNs;
+
+  @ffi.Int64()
+  external int bytesAllocated;
+
+  @ffi.Int64()
+  external int pixels;
+
+  @ffi.Int32()
+  external int lastWidth;
+
+  @ffi.Int32()
+  external int lastHeight;
+}
@@ -0,0 +1,176 @@
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 체스보드 기반 카메라 보정
+///
+/// [addFrame]으로 여러 자세의 체스보드 영상을 모은 뒤 [calibrate]를 호출하고,
+/// [createUndistorter]로 만든 [CvRemapCache]를 캡처 스트림에 부착하면
+/// 프레임이 왜곡 보정된 상태로 들어옵니다.
+class CvCameraCalibration implements ffi.Finalizable {
+  /// C++ CameraCalibration 포인터
+  final ffi.Pointer<gen.CvCalibration> _ptr;
+
+  /// 체스보드 내부 코너 개수
+  final int patternCols;
+  final int patternRows;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_calibration_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvCameraCalibration._(this._ptr, this.patternCols, this.patternRows) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 보정 객체 생성
+  ///
+  /// [patternCols] x [patternRows] - 체스보드 내부 코너 개수 (예: 9 x 6)
+  /// [squareSize] - 칸 한 변의 실제 길이 (결과의 단위가 됨)
+  factory CvCameraCalibration(
+    int patternCols,
+    int patternRows, {
+    double squareSize = 1,
+  }) {
+    final ptr = bindings.cv_calibration_create(
+      patternCols,
+      patternRows,
+      squareSize,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create camera calibration');
+    }
+    return CvCameraCalibration._(ptr, patternCols, patternRows);
+  }
+
+  /// 저장된 보정 파일 로드 (.yml / .xml / .json). 실패하면 null
+  static CvCameraCalibration? load(String path) {
+    final pathC = path.toNativeUtf8();
+    try {
+      final ptr = bindings.cv_calibration_load(pathC.cast());
+      if (ptr == ffi.nullptr) {
+        return null;
+      }
+      return CvCameraCalibration._(ptr, 0, 0);
+    } finally {
+      malloc.free(pathC);
+    }
+  }
+
+  /// 체스보드를 찾으면 관측값에 추가하고 코너 좌표 `(x, y, ...)`를 반환
+  ///
+  /// 찾지 못하면 null을 반환합니다.
+  Float32List? addFrame(CvImage image) {
+    final count = patternCols * patternRows * 2;
+    final cornersC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * count,
+    );
+    try {
+      final found = bindings.cv_calibration_add_frame(
+        _ptr,
+        image.pointer,
+        cornersC,
+      );
+      if (found == 0) return null;
+      return Float32List.fromList(cornersC.asTypedList(count));
+    } finally {
+      malloc.free(cornersC);
+    }
+  }
+
+  /// 지금까지 추가된 관측 프레임 수
+  int get frameCount => bindings.cv_calibration_frame_count(_ptr);
+
+  /// 보정 수행 후 재투영 RMS 오차(픽셀) 반환
+  ///
+  /// 서로 다른 자세의 프레임이 3장 이상 필요합니다.
+  double calibrate() {
+    final rms = bindings.cv_calibration_calibrate(_ptr);
+    if (rms < 0) {
+      throw Exception('Failed to calibrate camera');
+    }
+    return rms;
+  }
+
+  /// 보정 결과 (카메라 행렬 3x3 행 우선, 왜곡 계수 k1 k2 p1 p2 k3, 영상 크기)
+  ({Float64List cameraMatrix, Float64List distCoeffs, int width, int height})?
+  get params {
+    final camC = malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * 9);
+    final distC = malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * 5);
+    final sizeC = malloc.allocate<ffi.Int>(ffi.sizeOf<ffi.Int>() * 2);
+    try {
+      if (bindings.cv_calibration_get_params(_ptr, camC, distC, sizeC) == 0) {
+        return null;
+      }
+      final size = sizeC.cast<ffi.Int32>();
+      return (
+        cameraMatrix: Float64List.fromList(camC.asTypedList(9)),
+        distCoeffs: Float64List.fromList(distC.asTypedList(5)),
+        width: size[0],
+        height: size[1],
+      );
+    } finally {
+      malloc.free(camC);
+      malloc.free(distC);
+      malloc.free(sizeC);
+    }
+  }
+
+  /// 알고 있는 파라미터를 직접 설정
+  void setParams(
+    List<double> cameraMatrix,
+    List<double> distCoeffs,
+    int width,
+    int height,
+  ) {
+    if (cameraMatrix.length != 9 || distCoeffs.length != 5) {
+      throw ArgumentError('Expected 9 camera matrix and 5 distortion values');
+    }
+    final camC = malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * 9);
+    final distC = malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * 5);
+    try {
+      camC.asTypedList(9).setAll(0, cameraMatrix);
+      distC.asTypedList(5).setAll(0, distCoeffs);
+      bindings.cv_calibration_set_params(_ptr, camC, distC, width, height);
+    } finally {
+      malloc.free(camC);
+      malloc.free(distC);
+    }
+  }
+
+  /// 보정 결과를 파일로 저장 (.yml / .xml / .json)
+  void save(String path) {
+    final pathC = path.toNativeUtf8();
+    try {
+      if (bindings.cv_calibration_save(_ptr, pathC.cast()) == 0) {
+        throw Exception('Failed to save camera calibration');
+      }
+    } finally {
+      malloc.free(pathC);
+    }
+  }
+
+  /// 왜곡 보정용 리맵 캐시 생성
+  ///
+  /// 보정 맵은 여기서 한 번만 만들어지며, 이후 프레임마다 고정소수점
+  /// 테이블 조회만 수행합니다. [CvVideoCapture.attachRemap]으로 부착하세요.
+  ///
+  /// [alpha] - 0: 유효 픽셀만 남도록 확대, 1: 원본 픽셀을 모두 유지
+  CvRemapCache createUndistorter({double alpha = 0, int interpolation = 1}) {
+    final ptr = bindings.cv_undistorter_create(_ptr, alpha, interpolation);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create undistorter');
+    }
+    return CvRemapCache.wrap(ptr);
+  }
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_calibration_release(_ptr);
+  }
+}
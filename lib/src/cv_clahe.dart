@@ -0,0 +1,53 @@
+import 'dart:ffi' as ffi;
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// CLAHE (Contrast Limited Adaptive Histogram Equalization)
+///
+/// 한 번 생성해 프레임마다 [apply]를 호출하면 내부 버퍼를 재사용합니다.
+/// 컬러 영상은 밝기에만 적용되며 채널 분리/병합 없이 처리됩니다.
+class CvClahe implements ffi.Finalizable {
+  /// C++ ClaheContext 포인터
+  final ffi.Pointer<gen.CvClahe> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_clahe_release.cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvClahe._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// CLAHE 생성
+  ///
+  /// [clipLimit] - 대비 제한 (클수록 대비가 강해짐)
+  /// [tilesX], [tilesY] - 타일 격자 크기
+  factory CvClahe({double clipLimit = 2.0, int tilesX = 8, int tilesY = 8}) {
+    final ptr = bindings.cv_clahe_create(clipLimit, tilesX, tilesY);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create CLAHE');
+    }
+    return CvClahe._(ptr);
+  }
+
+  /// 파라미터 변경 (객체와 버퍼는 유지)
+  void configure({double clipLimit = 2.0, int tilesX = 8, int tilesY = 8}) {
+    bindings.cv_clahe_set(_ptr, clipLimit, tilesX, tilesY);
+  }
+
+  /// CLAHE 적용
+  CvImage apply(CvImage image) {
+    final ptr = bindings.cv_clahe_apply(_ptr, image.pointer);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to apply CLAHE');
+    }
+    return CvImage.wrap(ptr);
+  }
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_clahe_release(_ptr);
+  }
+}
@@ -0,0 +1,104 @@
+import 'dart:ffi' as ffi;
+import 'dart:math' as math;
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+
+/// 검출된 문서 사각형
+///
+/// [corners]는 좌상, 우상, 우하, 좌하 순서이며 원본 영상 좌표입니다.
+class CvDocumentQuad {
+  final List<math.Point<double>> corners;
+
+  /// 0~1 신뢰도 (변의 엣지 지지율, 직각도, 면적 비율 가중합)
+  final double confidence;
+
+  const CvDocumentQuad(this.corners, this.confidence);
+
+  @override
+  String toString() => 'CvDocumentQuad($corners, confidence: $confidence)';
+}
+
+/// 문서 스캐너 엔진
+///
+/// 라이브 미리보기에서는 축소 영상으로 [detect]만 카메라 속도로 호출하고,
+/// 촬영 시점에만 전체 해상도에서 [refine]과 [warp]를 수행합니다.
+class CvDocumentScanner {
+  CvDocumentScanner._();
+
+  /// 문서 사각형 검출. 찾지 못하면 null
+  ///
+  /// [maxSide] - 검출에 사용할 축소 영상의 긴 변 길이
+  static CvDocumentQuad? detect(CvImage image, {int maxSide = 500}) {
+    final quadC = malloc.allocate<ffi.Float>(ffi.sizeOf<ffi.Float>() * 8);
+    try {
+      final confidence = bindings.cv_document_detect(
+        image.pointer,
+        maxSide,
+        quadC,
+      );
+      if (confidence <= 0) return null;
+      return CvDocumentQuad(_readCorners(quadC), confidence);
+    } finally {
+      malloc.free(quadC);
+    }
+  }
+
+  /// 전체 해상도 영상에서 꼭짓점을 서브픽셀 단위로 보정
+  ///
+  /// 각 꼭짓점 주변 [searchRadius] 범위만 처리하므로 고해상도에서도 가볍습니다.
+  static CvDocumentQuad refine(
+    CvImage image,
+    CvDocumentQuad quad, {
+    int searchRadius = 15,
+  }) {
+    final quadC = _allocQuad(quad);
+    try {
+      if (bindings.cv_document_refine(image.pointer, quadC, searchRadius) ==
+          0) {
+        throw Exception('Failed to refine document quad');
+      }
+      return CvDocumentQuad(_readCorners(quadC), quad.confidence);
+    } finally {
+      malloc.free(quadC);
+    }
+  }
+
+  /// 사각형 영역을 정면으로 펴서 잘라냄
+  ///
+  /// [width], [height]가 0이면 사각형 변 길이로 자동 결정합니다.
+  static CvImage warp(
+    CvImage image,
+    CvDocumentQuad quad, {
+    int width = 0,
+    int height = 0,
+  }) {
+    final quadC = _allocQuad(quad);
+    try {
+      final ptr = bindings.cv_document_warp(
+        image.pointer,
+        quadC,
+        width,
+        height,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to warp document');
+      }
+      return CvImage.wrap(ptr);
+    } finally {
+      malloc.free(quadC);
+    }
+  }
+
+  static ffi.Pointer<ffi.Float> _allocQuad(CvDocumentQuad quad) {
+    final ptr = malloc.allocate<ffi.Float>(ffi.sizeOf<ffi.Float>() * 8);
+    for (var i = 0; i < 4; i++) {
+      ptr[i * 2] = quad.corners[i].x;
+      ptr[i * 2 + 1] = quad.corners[i].y;
+    }
+    return ptr;
+  }
+
+  static List<math.Point<double>> _readCorners(ffi.Pointer<ffi.Float> ptr) {
+    return List.generate(4, (i) => math.Point(ptr[i * 2], ptr[i * 2 + 1]));
+  }
+}
@@ -0,0 +1,117 @@
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 점 추적 결과
+///
+/// [points]는 `(x, y, ...)` 좌표, [status]는 점마다 1(성공) 또는 0(실패),
+/// [errors]는 점마다 추적 오차입니다.
+typedef CvFlowResult = ({
+  Float32List points,
+  Uint8List status,
+  Float32List errors,
+});
+
+/// Lucas-Kanade 점 추적기
+///
+/// 이전 프레임의 피라미드를 네이티브에 보관해 다음 프레임에서 다시 만들지 않으며,
+/// 수백 개의 점도 프레임당 FFI 호출 한 번으로 추적합니다.
+class CvFlowTracker implements ffi.Finalizable {
+  /// C++ FlowTracker 포인터
+  final ffi.Pointer<gen.CvFlowTracker> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_flow_tracker_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvFlowTracker._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 추적기 생성
+  ///
+  /// [winSize] - 탐색 창 크기, [maxLevel] - 피라미드 최대 레벨
+  factory CvFlowTracker({int winSize = 21, int maxLevel = 3}) {
+    final ptr = bindings.cv_flow_tracker_create(winSize, maxLevel);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create flow tracker');
+    }
+    return CvFlowTracker._(ptr);
+  }
+
+  /// 새 프레임을 넣고 이전 프레임의 [points]를 추적
+  ///
+  /// 첫 프레임이거나 해상도가 바뀐 경우에는 프레임만 저장하고 null을 반환합니다.
+  CvFlowResult? track(CvImage frame, Float32List points) {
+    final count = points.length ~/ 2;
+    final pointsC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * (count * 2 + 1),
+    );
+    final outC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * (count * 2 + 1),
+    );
+    final statusC = malloc.allocate<ffi.Uint8>(count + 1);
+    final errorC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * (count + 1),
+    );
+    try {
+      pointsC.asTypedList(count * 2).setAll(0, points.take(count * 2));
+      final tracked = bindings.cv_flow_tracker_track(
+        _ptr,
+        frame.pointer,
+        pointsC,
+        count,
+        outC,
+        statusC,
+        errorC,
+      );
+      if (tracked == 0) return null;
+      return (
+        points: Float32List.fromList(outC.asTypedList(count * 2)),
+        status: Uint8List.fromList(statusC.asTypedList(count)),
+        errors: Float32List.fromList(errorC.asTypedList(count)),
+      );
+    } finally {
+      malloc.free(pointsC);
+      malloc.free(outC);
+      malloc.free(statusC);
+      malloc.free(errorC);
+    }
+  }
+
+  /// 마지막 프레임에서 추적하기 좋은 코너 검출 (`(x, y, ...)`)
+  Float32List detect({
+    int maxCorners = 200,
+    double quality = 0.01,
+    double minDistance = 10,
+  }) {
+    final outC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * maxCorners * 2,
+    );
+    try {
+      final count = bindings.cv_flow_tracker_detect(
+        _ptr,
+        maxCorners,
+        quality,
+        minDistance,
+        outC,
+      );
+      return Float32List.fromList(outC.asTypedList(count * 2));
+    } finally {
+      malloc.free(outC);
+    }
+  }
+
+  /// 저장된 이전 프레임 제거
+  void reset() => bindings.cv_flow_tracker_reset(_ptr);
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_flow_tracker_release(_ptr);
+  }
+}
@@ -0,0 +1,89 @@
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 프레임 통계 수집기 (자동 노출 / 화이트 밸런스용)
+///
+/// [CvVideoCapture.attachFrameStats]로 부착하면 캡처 read 중에
+/// 부분 샘플링 격자에서 밝기 히스토그램, 평균, 클리핑 비율, 채널 평균을
+/// 계산합니다. 결과는 네이티브 구조체를 복사 없이 읽습니다.
+class CvFrameStatsCollector implements ffi.Finalizable {
+  /// C++ FrameStatsCollector 포인터
+  final ffi.Pointer<gen.CvFrameStatsCollector> _ptr;
+
+  /// 수집기 내부 통계 구조체 (주소 고정)
+  final ffi.Pointer<gen.CvFrameStats> _stats;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_frame_stats_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvFrameStatsCollector._(this._ptr)
+    : _stats = bindings.cv_frame_stats_get(_ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 수집기 생성
+  ///
+  /// [step] - 샘플링 격자 간격 (4이면 픽셀의 1/16만 읽음)
+  /// [lowClip], [highClip] - 클리핑으로 볼 밝기 경계
+  factory CvFrameStatsCollector({
+    int step = 4,
+    int lowClip = 2,
+    int highClip = 253,
+  }) {
+    final ptr = bindings.cv_frame_stats_create(step, lowClip, highClip);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create frame stats collector');
+    }
+    return CvFrameStatsCollector._(ptr);
+  }
+
+  /// 네이티브 포인터 (캡처 스트림 부착용)
+  ffi.Pointer<gen.CvFrameStatsCollector> get pointer => _ptr;
+
+  /// 캡처 없이 영상 한 장의 통계 계산
+  void compute(CvImage image) {
+    if (bindings.cv_frame_stats_compute(_ptr, image.pointer) == 0) {
+      throw Exception('Failed to compute frame stats');
+    }
+  }
+
+  /// 네이티브 통계 구조체 (다음 프레임에서 덮어씀)
+  gen.CvFrameStats get stats => _stats.ref;
+
+  /// 밝기 히스토그램 256단계 (네이티브 메모리 뷰, 다음 프레임에서 갱신됨)
+  Uint32List get histogram => _stats.cast<ffi.Uint32>().asTypedList(256);
+
+  /// 통계를 계산한 프레임 수
+  int get frameCount => _stats.ref.frameCount;
+
+  /// 샘플 수
+  int get samples => _stats.ref.samples;
+
+  /// 평균 밝기 (0~255)
+  double get meanLuma => _stats.ref.meanLuma;
+
+  /// 어두운 쪽 클리핑 비율 (0~1)
+  double get clipLow => _stats.ref.clipLow;
+
+  /// 밝은 쪽 클리핑 비율 (0~1)
+  double get clipHigh => _stats.ref.clipHigh;
+
+  /// B, G, R, A 채널 평균
+  List<double> get channelMeans =>
+      List.generate(4, (i) => _stats.ref.channelMeans[i]);
+
+  /// Gray-world 화이트 밸런스 게인 (B, G, R)
+  List<double> get grayWorldGains =>
+      List.generate(3, (i) => _stats.ref.grayWorldGains[i]);
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_frame_stats_release(_ptr);
+  }
+}
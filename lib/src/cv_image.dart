@@ -2,7 +2,25 @@ import 'dart:ffi' as ffi;
 import 'dart:typed_data';
 import 'package:ffi/ffi.dart';
 import 'package:flutter_opencv/flutter_opencv.dart';
-import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart'
+    show CvMat, CvMatInfo;
+
+/// Mat 속성 ([CvImage.info])
+///
+/// [type]/[depth] 는 OpenCV 값 (`CV_8UC3`, `CV_8U` 등), [step] 은 행 간격 바이트,
+/// [isContinuous] 가 true 면 행 사이 여백 없이 [dataLen] 바이트가 연속으로 놓입니다.
+typedef CvImageInfo = ({
+  int width,
+  int height,
+  int channels,
+  int type,
+  int depth,
+  int elemSize,
+  int step,
+  int dataLen,
+  bool isContinuous,
+  bool isEmpty,
+});
 
 /// OpenCV Mat 객체 래퍼
 class CvImage implements ffi.Finalizable {
@@ -27,6 +45,9 @@ class CvImage implements ffi.Finalizable {
     return CvImage._(ptr, dylib);
   }
 
+  /// 네이티브 cv::Mat 포인터 (다른 래퍼 클래스에서 FFI 호출 시 사용)
+  ffi.Pointer<CvMat> get pointer => _ptr;
+
   /// 파일에서 로드
   static CvImage? fromFile(String path) {
     final pathC = path.toNativeUtf8();
@@ -115,7 +136,11 @@ class CvImage implements ffi.Finalizable {
   }
 
   /// 리사이즈
-  CvImage resize(int width, int height, {int interpolation = 1}) {
+  ///
+  /// [interpolation] - -1: 자동 (축소 INTER_AREA, 확대 INTER_LINEAR),
+  /// 0: NEAREST, 1: LINEAR, 2: CUBIC, 3: AREA, 4: LANCZOS4.
+  /// 8비트 영상을 2배 이상 AREA 축소하면 정수 배율 박스 축소 경로를 사용합니다.
+  CvImage resize(int width, int height, {int interpolation = -1}) {
     final ptr = bindings.cv_resize(_ptr, width, height, interpolation);
     if (ptr == ffi.nullptr) {
       throw Exception('Failed to resize image');
@@ -141,6 +166,91 @@ class CvImage implements ffi.Finalizable {
     return CvImage._(ptr, _dylib);
   }
 
+  /// 어파인 변환 ([m]: 행 우선 2x3 행렬)
+  ///
+  /// [width], [height]가 0이면 입력 크기를 사용합니다.
+  /// 같은 변환을 매 프레임 반복한다면 [CvRemapCache]를 사용하세요.
+  CvImage warpAffine(
+    List<double> m, {
+    int width = 0,
+    int height = 0,
+    int interpolation = 1,
+    int borderMode = 0,
+  }) {
+    if (m.length != 6) {
+      throw ArgumentError('Affine matrix must have 6 elements');
+    }
+    final mC = _allocDoubles(m);
+    try {
+      final ptr = bindings.cv_warp_affine(
+        _ptr,
+        mC,
+        width,
+        height,
+        interpolation,
+        borderMode,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to warp affine');
+      }
+      return CvImage._(ptr, _dylib);
+    } finally {
+      malloc.free(mC);
+    }
+  }
+
+  /// 원근 변환 ([m]: 행 우선 3x3 행렬)
+  ///
+  /// [width], [height]가 0이면 입력 크기를 사용합니다.
+  CvImage warpPerspective(
+    List<double> m, {
+    int width = 0,
+    int height = 0,
+    int interpolation = 1,
+    int borderMode = 0,
+  }) {
+    if (m.length != 9) {
+      throw ArgumentError('Perspective matrix must have 9 elements');
+    }
+    final mC = _allocDoubles(m);
+    try {
+      final ptr = bindings.cv_warp_perspective(
+        _ptr,
+        mC,
+        width,
+        height,
+        interpolation,
+        borderMode,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to warp perspective');
+      }
+      return CvImage._(ptr, _dylib);
+    } finally {
+      malloc.free(mC);
+    }
+  }
+
+  /// 좌표 맵으로 리맵 ([mapX], [mapY]: 출력 크기의 CV_32FC1 영상)
+  CvImage remap(
+    CvImage mapX,
+    CvImage mapY, {
+    int interpolation = 1,
+    int borderMode = 0,
+  }) {
+    final ptr = bindings.cv_remap(
+      _ptr,
+      mapX._ptr,
+      mapY._ptr,
+      interpolation,
+      borderMode,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to remap image');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
   /// Applies Gaussian Blur to the image.
   ///
   /// [kernelSize] must be odd. [sigma] is standard deviation.
@@ -223,6 +333,99 @@ class CvImage implements ffi.Finalizable {
     return CvImage._(ptr, _dylib);
   }
 
+  /// Convolves the image with a user [kernel] of [width] x [height]
+  /// coefficients in row-major order.
+  ///
+  /// Separable kernels are detected automatically and applied as two 1D
+  /// passes; 8-bit images use an integer fixed-point path when the kernel
+  /// can be represented exactly enough.
+  /// [anchorX], [anchorY] - kernel anchor (-1 = center)
+  /// [borderType] - 0: CONSTANT, 1: REPLICATE, 2: REFLECT, 4: REFLECT_101 (default)
+  CvImage filter2D(
+    List<double> kernel,
+    int width,
+    int height, {
+    int anchorX = -1,
+    int anchorY = -1,
+    double delta = 0,
+    int borderType = 4,
+  }) {
+    if (kernel.length != width * height) {
+      throw ArgumentError('kernel length must be width * height');
+    }
+    final kernelC = _allocFloats(kernel);
+    try {
+      final ptr = bindings.cv_filter2d(
+        _ptr,
+        kernelC,
+        width,
+        height,
+        anchorX,
+        anchorY,
+        delta,
+        borderType,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to apply filter2D');
+      }
+      return CvImage._(ptr, _dylib);
+    } finally {
+      malloc.free(kernelC);
+    }
+  }
+
+  /// Applies a separable filter: [kernelX] along rows, then [kernelY] along
+  /// columns.
+  CvImage sepFilter2D(
+    List<double> kernelX,
+    List<double> kernelY, {
+    int anchorX = -1,
+    int anchorY = -1,
+    double delta = 0,
+    int borderType = 4,
+  }) {
+    final kernelXC = _allocFloats(kernelX);
+    final kernelYC = _allocFloats(kernelY);
+    try {
+      final ptr = bindings.cv_sep_filter2d(
+        _ptr,
+        kernelXC,
+        kernelX.length,
+        kernelYC,
+        kernelY.length,
+        anchorX,
+        anchorY,
+        delta,
+        borderType,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to apply separable filter');
+      }
+      return CvImage._(ptr, _dylib);
+    } finally {
+      malloc.free(kernelXC);
+      malloc.free(kernelYC);
+    }
+  }
+
+  /// Sharpens the image with an unsharp mask in a single fused pass.
+  ///
+  /// [sigma] - Gaussian blur sigma
+  /// [amount] - strength (`src + amount * (src - blur)`)
+  /// [threshold] - pixels whose difference from the blur is below this are
+  /// left unchanged
+  CvImage unsharpMask({
+    double sigma = 1.0,
+    double amount = 1.0,
+    int threshold = 0,
+  }) {
+    final ptr = bindings.cv_unsharp_mask(_ptr, sigma, amount, threshold);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to apply unsharp mask');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
   // --- Morphological Operations ---
 
   /// Erodes the image (makes objects thinner).
@@ -261,6 +464,63 @@ class CvImage implements ffi.Finalizable {
     return CvImage._(ptr, _dylib);
   }
 
+  /// Erodes the image with a prebuilt [kernel].
+  CvImage erodeWithKernel(CvKernel kernel, {int iterations = 1}) {
+    final ptr = bindings.cv_erode_kernel(_ptr, kernel.pointer, iterations);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to erode image');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
+  /// Dilates the image with a prebuilt [kernel].
+  CvImage dilateWithKernel(CvKernel kernel, {int iterations = 1}) {
+    final ptr = bindings.cv_dilate_kernel(_ptr, kernel.pointer, iterations);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to dilate image');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
+  /// Applies morphological operation [op] (see [morphologyEx]) with a
+  /// prebuilt [kernel].
+  CvImage morphologyExWithKernel(
+    int op,
+    CvKernel kernel, {
+    int iterations = 1,
+  }) {
+    final ptr = bindings.cv_morphology_ex_kernel(
+      _ptr,
+      op,
+      kernel.pointer,
+      iterations,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to apply morphology');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
+  /// Convolves the image with a prebuilt [kernel].
+  ///
+  /// [borderType] - 0: CONSTANT, 1: REPLICATE, 2: REFLECT, 4: REFLECT_101 (default)
+  CvImage filter2DWithKernel(
+    CvKernel kernel, {
+    double delta = 0,
+    int borderType = 4,
+  }) {
+    final ptr = bindings.cv_filter2d_kernel(
+      _ptr,
+      kernel.pointer,
+      delta,
+      borderType,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to apply filter2D');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
   // --- Thresholding ---
 
   /// Applies fixed-level threshold.
@@ -304,9 +564,96 @@ class CvImage implements ffi.Finalizable {
     return CvImage._(ptr, _dylib);
   }
 
+  /// Binarizes a document image with a local-statistics threshold.
+  ///
+  /// Window mean and standard deviation come from integral images, so the
+  /// cost per pixel does not depend on [windowSize]. Text becomes 0 and
+  /// background 255. Color input is converted to grayscale internally.
+  ///
+  /// [method] - 0: Sauvola, 1: Wolf, 2: Niblack (use a negative [k], e.g. -0.2)
+  /// [k] - sensitivity (Sauvola 0.2-0.5, Wolf 0.5)
+  /// [r] - dynamic range of the standard deviation (Sauvola only)
+  /// [scales] - when > 1, low-contrast pixels fall back to windows 2x, 4x, ...
+  ///   larger, which keeps shadowed or blank regions from turning into noise
+  CvImage binarizeDocument({
+    int method = 0,
+    int windowSize = 25,
+    double k = 0.2,
+    double r = 128,
+    int scales = 2,
+  }) {
+    final ptr = bindings.cv_binarize_document(
+      _ptr,
+      method,
+      windowSize,
+      k,
+      r,
+      scales,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to binarize document');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
+  // --- Optical Flow ---
+
+  /// Computes dense optical flow from this frame to [next].
+  ///
+  /// Returns a CV_32FC2 image of per-pixel (dx, dy) displacements.
+  ///
+  /// [method] - 0: DIS (fast), 1: Farneback
+  /// [preset] - DIS preset (0: ultrafast, 1: fast, 2: medium)
+  CvImage denseFlow(CvImage next, {int method = 0, int preset = 1}) {
+    final ptr = bindings.cv_optical_flow_dense(_ptr, next._ptr, method, preset);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to compute optical flow');
+    }
+    return CvImage._(ptr, _dylib);
+  }
+
   // --- Histogram ---
 
+  /// Computes a histogram and returns it as a flat array.
+  ///
+  /// With [channel] = -1 every channel is computed and the result holds
+  /// `channels * bins` values, channel by channel. 8-bit images are counted
+  /// in a single parallel pass regardless of [bins] and the range.
+  ///
+  /// [mask] - optional 8-bit single-channel mask of the same size
+  Float32List calcHist({
+    int channel = -1,
+    int bins = 256,
+    double rangeMin = 0,
+    double rangeMax = 256,
+    CvImage? mask,
+  }) {
+    final count = (channel < 0 ? channels : 1) * bins;
+    final outC = malloc.allocate<ffi.Float>(ffi.sizeOf<ffi.Float>() * count);
+    try {
+      final ok = bindings.cv_calc_hist(
+        _ptr,
+        channel,
+        bins,
+        rangeMin,
+        rangeMax,
+        mask?._ptr ?? ffi.nullptr,
+        outC,
+      );
+      if (ok == 0) {
+        throw Exception('Failed to calculate histogram');
+      }
+      return Float32List.fromList(outC.asTypedList(count));
+    } finally {
+      malloc.free(outC);
+    }
+  }
+
   /// Equalizes the histogram of a grayscale or color image.
+  ///
+  /// Color images are equalized on luminance only, without splitting channels.
+  /// BGRA input keeps its alpha channel. Only 8-bit images with 1, 3 or 4
+  /// channels are supported.
   CvImage equalizeHist() {
     final ptr = bindings.cv_equalize_hist(_ptr);
     if (ptr == ffi.nullptr) {
@@ -415,6 +762,29 @@ class CvImage implements ffi.Finalizable {
   int get height => bindings.cv_mat_height(_ptr);
   int get channels => bindings.cv_mat_channels(_ptr);
 
+  /// [info] 결과를 받는 버퍼 (isolate 마다 하나를 재사용하며 해제하지 않음)
+  static final ffi.Pointer<CvMatInfo> _infoC = calloc<CvMatInfo>();
+
+  /// 크기, 타입, 행 간격, 연속성을 한 번의 leaf 호출로 조회
+  ///
+  /// 여러 속성을 함께 읽을 때는 [width]/[height]/[channels] 를 각각 호출하는 것보다 저렴합니다.
+  CvImageInfo get info {
+    bindings.cv_mat_info(_ptr, _infoC);
+    final i = _infoC.ref;
+    return (
+      width: i.width,
+      height: i.height,
+      channels: i.channels,
+      type: i.type,
+      depth: i.depth,
+      elemSize: i.elemSize,
+      step: i.step,
+      dataLen: i.dataLen,
+      isContinuous: i.continuous != 0,
+      isEmpty: i.empty != 0,
+    );
+  }
+
   /// Encodes the image to bytes with the specified extension (e.g., ".png", ".jpg").
   List<int> encode({String ext = ".png"}) {
     final extC = ext.toNativeUtf8();
@@ -430,4 +800,21 @@ class CvImage implements ffi.Finalizable {
       malloc.free(extC);
     }
   }
+
+  /// Copies [values] into a native float array. Caller frees it.
+  static ffi.Pointer<ffi.Float> _allocFloats(List<double> values) {
+    final ptr = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * values.length,
+    );
+    ptr.asTypedList(values.length).setAll(0, values);
+    return ptr;
+  }
+
+  static ffi.Pointer<ffi.Double> _allocDoubles(List<double> values) {
+    final ptr = malloc.allocate<ffi.Double>(
+      ffi.sizeOf<ffi.Double>() * values.length,
+    );
+    ptr.asTypedList(values.length).setAll(0, values);
+    return ptr;
+  }
 }
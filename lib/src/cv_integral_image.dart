@@ -0,0 +1,154 @@
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 적분 영상 (합, 제곱합, 45도 기울어진 합)
+///
+/// 프레임마다 [compute]로 한 번 계산한 뒤, 사각형 영역의 합/평균/분산을
+/// 영역 크기와 무관하게 O(1)로 조회합니다.
+/// 여러 사각형을 한 번의 FFI 호출로 처리할 수 있습니다.
+class CvIntegralImage implements ffi.Finalizable {
+  /// C++ IntegralImage 포인터
+  final ffi.Pointer<gen.CvIntegral> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_integral_release.cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  /// 마지막 [compute]에서 제곱합을 계산했는지 (분산 조회 가능 여부)
+  bool _hasSquared = false;
+
+  CvIntegralImage._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 빈 적분 영상 생성 (버퍼는 첫 [compute]에서 할당되고 이후 재사용)
+  factory CvIntegralImage() {
+    final ptr = bindings.cv_integral_create();
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create integral image');
+    }
+    return CvIntegralImage._(ptr);
+  }
+
+  /// [image]의 적분 영상 계산
+  ///
+  /// [squared] - 분산 조회용 제곱합 계산
+  /// [tilted] - [tiltedSums] 조회용 기울어진 합 계산 (제곱합 포함)
+  void compute(CvImage image, {bool squared = true, bool tilted = false}) {
+    final flags = (squared ? 1 : 0) | (tilted ? 2 : 0);
+    if (bindings.cv_integral_compute(_ptr, image.pointer, flags) == 0) {
+      throw Exception('Failed to compute integral image');
+    }
+    _hasSquared = squared || tilted;
+  }
+
+  /// 사각형 영역들의 합
+  ///
+  /// [rects] - `(x, y, width, height)`가 연속으로 들어 있는 배열.
+  /// 영상 밖 부분은 잘라내고 계산합니다.
+  Float64List rectSums(Int32List rects, {int channel = 0}) {
+    final count = rects.length ~/ 4;
+    final rectsC = _copyRects(rects);
+    final outC = malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * count);
+    try {
+      final n = bindings.cv_integral_rect_sums(
+        _ptr,
+        rectsC,
+        count,
+        channel,
+        outC,
+      );
+      if (n != count) {
+        throw Exception('Failed to query rect sums');
+      }
+      return Float64List.fromList(outC.asTypedList(count));
+    } finally {
+      malloc.free(rectsC);
+      malloc.free(outC);
+    }
+  }
+
+  /// 사각형 영역들의 평균과 분산
+  ///
+  /// 제곱합 없이 (`squared: false`, `tilted: false`) 계산했으면 [variances]는 null입니다.
+  ({Float64List means, Float64List? variances}) rectStats(
+    Int32List rects, {
+    int channel = 0,
+  }) {
+    final count = rects.length ~/ 4;
+    final rectsC = _copyRects(rects);
+    final meansC = malloc.allocate<ffi.Double>(
+      ffi.sizeOf<ffi.Double>() * count,
+    );
+    final varsC = _hasSquared
+        ? malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * count)
+        : ffi.nullptr.cast<ffi.Double>();
+    try {
+      final n = bindings.cv_integral_rect_stats(
+        _ptr,
+        rectsC,
+        count,
+        channel,
+        meansC,
+        varsC,
+      );
+      if (n != count) {
+        throw Exception('Failed to query rect statistics');
+      }
+      return (
+        means: Float64List.fromList(meansC.asTypedList(count)),
+        variances: _hasSquared
+            ? Float64List.fromList(varsC.asTypedList(count))
+            : null,
+      );
+    } finally {
+      malloc.free(rectsC);
+      malloc.free(meansC);
+      if (_hasSquared) {
+        malloc.free(varsC);
+      }
+    }
+  }
+
+  /// 45도 기울어진 사각형 영역들의 합 (`tilted: true`로 계산한 경우에만 유효)
+  ///
+  /// [rects] - 위쪽 꼭짓점 `(x, y)`와 기울어진 변의 길이 `(width, height)`.
+  /// 영상 밖으로 나가는 사각형은 0을 반환합니다.
+  Float64List tiltedSums(Int32List rects, {int channel = 0}) {
+    final count = rects.length ~/ 4;
+    final rectsC = _copyRects(rects);
+    final outC = malloc.allocate<ffi.Double>(ffi.sizeOf<ffi.Double>() * count);
+    try {
+      final n = bindings.cv_integral_tilted_sums(
+        _ptr,
+        rectsC,
+        count,
+        channel,
+        outC,
+      );
+      if (n != count) {
+        throw Exception('Failed to query tilted sums');
+      }
+      return Float64List.fromList(outC.asTypedList(count));
+    } finally {
+      malloc.free(rectsC);
+      malloc.free(outC);
+    }
+  }
+
+  static ffi.Pointer<ffi.Int> _copyRects(Int32List rects) {
+    final ptr = malloc.allocate<ffi.Int>(ffi.sizeOf<ffi.Int>() * rects.length);
+    ptr.cast<ffi.Int32>().asTypedList(rects.length).setAll(0, rects);
+    return ptr;
+  }
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_integral_release(_ptr);
+  }
+}
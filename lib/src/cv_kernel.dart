@@ -0,0 +1,81 @@
+import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 재사용 가능한 구조 요소 / 필터 커널
+///
+/// 한 번 생성해 형태학 연산과 filter2D 호출에 반복 사용하므로
+/// 호출마다 커널을 다시 만들지 않습니다.
+/// 큰 사각형 커널은 van Herk/Gil-Werman 경로로 처리되어 비용이 커널 크기와 무관합니다.
+class CvKernel implements ffi.Finalizable {
+  /// C++ Kernel 포인터
+  final ffi.Pointer<gen.CvKernel> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_kernel_release.cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvKernel._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 도형 커널 생성
+  ///
+  /// [shape] - 0: MORPH_RECT, 1: MORPH_CROSS, 2: MORPH_ELLIPSE
+  ///
+  /// filter2D에 사용하면 계수의 합이 1이 되도록 정규화된 평균 필터로 동작합니다.
+  static CvKernel create(int shape, int width, int height) {
+    final ptr = bindings.cv_kernel_create(shape, width, height);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create kernel');
+    }
+    return CvKernel._(ptr);
+  }
+
+  /// 사용자 정의 커널 생성
+  ///
+  /// [data] - 행 우선 순서의 `width * height` 계수.
+  /// 형태학 연산에서는 0이 아닌 원소가 구조 요소가 됩니다.
+  /// [anchorX], [anchorY] - 기준점 (-1이면 중앙)
+  static CvKernel custom(
+    List<double> data,
+    int width,
+    int height, {
+    int anchorX = -1,
+    int anchorY = -1,
+  }) {
+    if (data.length != width * height) {
+      throw ArgumentError('data length must be width * height');
+    }
+    final dataC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * data.length,
+    );
+    try {
+      dataC.asTypedList(data.length).setAll(0, data);
+      final ptr = bindings.cv_kernel_create_custom(
+        dataC,
+        width,
+        height,
+        anchorX,
+        anchorY,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to create custom kernel');
+      }
+      return CvKernel._(ptr);
+    } finally {
+      malloc.free(dataC);
+    }
+  }
+
+  /// 네이티브 포인터 ([CvImage]의 커널 기반 연산에서 사용)
+  ffi.Pointer<gen.CvKernel> get pointer => _ptr;
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_kernel_release(_ptr);
+  }
+}
@@ -0,0 +1,141 @@
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 톤 보정 룩업 테이블
+///
+/// 밝기, 대비, 감마, 레벨, 커브 등의 연산을 호출 순서대로 하나의
+/// 256단계 테이블(필요하면 3D 색보정 격자)로 합성합니다.
+/// 연산을 몇 개 쌓든 [apply]는 프레임당 메모리 패스 한 번이며,
+/// 합성된 테이블은 연산이 바뀔 때까지 프레임 간 재사용됩니다.
+///
+/// [channel] - -1: 색상 채널 전체 (알파 제외), 0~3: 해당 채널 (BGR(A) 순서)
+class CvLut implements ffi.Finalizable {
+  /// C++ ToneLut 포인터
+  final ffi.Pointer<gen.CvLut> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_lut_release.cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvLut._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 항등 테이블로 생성
+  factory CvLut() {
+    final ptr = bindings.cv_lut_create();
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create LUT');
+    }
+    return CvLut._(ptr);
+  }
+
+  /// 항등 테이블로 되돌림 (3D 격자도 제거)
+  CvLut reset() {
+    bindings.cv_lut_reset(_ptr);
+    return this;
+  }
+
+  /// 밝기 ([delta]: -255~255)
+  CvLut brightness(double delta, {int channel = -1}) {
+    bindings.cv_lut_brightness(_ptr, channel, delta);
+    return this;
+  }
+
+  /// 대비 ([factor]: 1이면 변화 없음, [pivot] 기준으로 늘리거나 줄임)
+  CvLut contrast(double factor, {double pivot = 128, int channel = -1}) {
+    bindings.cv_lut_contrast(_ptr, channel, factor, pivot);
+    return this;
+  }
+
+  /// 감마 보정 ([gamma] > 1이면 밝아짐)
+  CvLut gamma(double gamma, {int channel = -1}) {
+    bindings.cv_lut_gamma(_ptr, channel, gamma);
+    return this;
+  }
+
+  /// 레벨 조정 ([inBlack]~[inWhite] 구간을 [outBlack]~[outWhite]로 매핑)
+  CvLut levels({
+    double inBlack = 0,
+    double inWhite = 255,
+    double outBlack = 0,
+    double outWhite = 255,
+    int channel = -1,
+  }) {
+    bindings.cv_lut_levels(_ptr, channel, inBlack, inWhite, outBlack, outWhite);
+    return this;
+  }
+
+  /// 톤 커브 ([points]: 제어점 `(x, y, x, y, ...)`, 0~255, 구간 선형 보간)
+  CvLut curve(List<double> points, {int channel = -1}) {
+    final count = points.length ~/ 2;
+    final pointsC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * count * 2,
+    );
+    try {
+      pointsC.asTypedList(count * 2).setAll(0, points.take(count * 2));
+      bindings.cv_lut_curve(_ptr, channel, pointsC, count);
+    } finally {
+      malloc.free(pointsC);
+    }
+    return this;
+  }
+
+  /// 임의의 256단계 테이블을 현재 결과 뒤에 합성
+  CvLut table(Uint8List table, {int channel = -1}) {
+    if (table.length != 256) {
+      throw ArgumentError('LUT table must have 256 entries');
+    }
+    final tableC = malloc.allocate<ffi.Uint8>(256);
+    try {
+      tableC.asTypedList(256).setAll(0, table);
+      bindings.cv_lut_table(_ptr, channel, tableC);
+    } finally {
+      malloc.free(tableC);
+    }
+    return this;
+  }
+
+  /// 3D 색보정 격자 설정 (null이면 제거)
+  ///
+  /// [data]는 .cube 파일과 같은 순서(R이 가장 빠르게 변함)의
+  /// `size^3 * 3`개 RGB 값(0~1)입니다. 1D 연산 뒤에 삼선형 보간으로 적용됩니다.
+  CvLut grade3D(Float32List? data, int size) {
+    if (data == null) {
+      bindings.cv_lut_set_3d(_ptr, ffi.nullptr, 0);
+      return this;
+    }
+    if (data.length != size * size * size * 3) {
+      throw ArgumentError('3D LUT must have size^3 * 3 values');
+    }
+    final dataC = malloc.allocate<ffi.Float>(
+      ffi.sizeOf<ffi.Float>() * data.length,
+    );
+    try {
+      dataC.asTypedList(data.length).setAll(0, data);
+      bindings.cv_lut_set_3d(_ptr, dataC, size);
+    } finally {
+      malloc.free(dataC);
+    }
+    return this;
+  }
+
+  /// 8비트 영상에 적용
+  CvImage apply(CvImage image) {
+    final ptr = bindings.cv_lut_apply(_ptr, image.pointer);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to apply LUT');
+    }
+    return CvImage.wrap(ptr);
+  }
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_lut_release(_ptr);
+  }
+}
@@ -0,0 +1,98 @@
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 움직임 검출기 (배경 차분)
+///
+/// 축소한 그레이 프레임에서 동작하므로 비용이 작습니다.
+/// [activity]가 낮은 정지 프레임에서는 이후의 무거운 처리를 건너뛸 수 있습니다.
+class CvMotionDetector implements ffi.Finalizable {
+  /// C++ MotionDetector 포인터
+  final ffi.Pointer<gen.CvMotionDetector> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_motion_detector_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvMotionDetector._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 움직임 검출기 생성
+  ///
+  /// [method] - 0: 이동 평균 배경 차분 (가장 빠름), 1: MOG2, 2: KNN
+  /// [maxSide] - 처리 해상도의 긴 변
+  /// [learningRate] - 배경 갱신 비율 (MOG2/KNN은 -1이면 자동)
+  /// [threshold] - 이동 평균 방식의 밝기 차이 임계값
+  /// [minArea] - 축소 해상도 기준 최소 영역 넓이
+  factory CvMotionDetector({
+    int method = 0,
+    int maxSide = 320,
+    double learningRate = 0.05,
+    int threshold = 25,
+    int minArea = 20,
+  }) {
+    final ptr = bindings.cv_motion_detector_create(
+      method,
+      maxSide,
+      learningRate,
+      threshold,
+      minArea,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create motion detector');
+    }
+    return CvMotionDetector._(ptr);
+  }
+
+  /// 네이티브 포인터 (캡처 스트림 부착용)
+  ffi.Pointer<gen.CvMotionDetector> get pointer => _ptr;
+
+  /// 프레임 한 장 처리 (캡처에 부착한 경우 자동으로 호출됨)
+  void process(CvImage image) {
+    if (bindings.cv_motion_detector_process(_ptr, image.pointer) == 0) {
+      throw Exception('Failed to process motion');
+    }
+  }
+
+  /// 배경 모델 초기화
+  void reset() => bindings.cv_motion_detector_reset(_ptr);
+
+  /// 마지막 프레임에서 움직인 픽셀 비율 (0~1)
+  double get activity => bindings.cv_motion_detector_activity(_ptr);
+
+  /// [activity]가 [threshold]를 넘는지 여부
+  bool isMoving({double threshold = 0.01}) => activity > threshold;
+
+  /// 움직임 영역 `(x, y, width, height)` 배열 (원본 좌표)
+  Int32List get boxes {
+    final count = bindings.cv_motion_detector_boxes(_ptr, ffi.nullptr, 0);
+    if (count == 0) return Int32List(0);
+    final boxesC = malloc.allocate<ffi.Int>(ffi.sizeOf<ffi.Int>() * count * 4);
+    try {
+      final written = bindings.cv_motion_detector_boxes(_ptr, boxesC, count);
+      return Int32List.fromList(
+        boxesC.cast<ffi.Int32>().asTypedList(written * 4),
+      );
+    } finally {
+      malloc.free(boxesC);
+    }
+  }
+
+  /// 마지막 움직임 마스크 (축소 해상도). 아직 처리한 프레임이 없으면 null
+  CvImage? get mask {
+    final ptr = bindings.cv_motion_detector_mask(_ptr);
+    if (ptr == ffi.nullptr) return null;
+    return CvImage.wrap(ptr);
+  }
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_motion_detector_release(_ptr);
+  }
+}
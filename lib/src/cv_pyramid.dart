@@ -0,0 +1,64 @@
+import 'dart:ffi' as ffi;
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 영상 피라미드 (Gaussian / Laplacian)
+///
+/// 각 레벨은 처음 접근할 때 바로 아래 레벨에서 계산되어 캐시되므로,
+/// N번째 레벨의 비용은 아직 계산되지 않은 레벨들의 작업뿐입니다.
+/// 원본을 반복해서 [CvImage.resize]하는 것보다 훨씬 적은 메모리를 읽습니다.
+class CvPyramid implements ffi.Finalizable {
+  /// C++ ImagePyramid 포인터
+  final ffi.Pointer<gen.CvPyramid> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_pyramid_release.cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvPyramid._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// [image]로 피라미드 생성 (레벨 계산은 접근 시점까지 미룸)
+  ///
+  /// [levels] - 0이면 짧은 변이 16픽셀 이상인 최대 레벨 수
+  factory CvPyramid(CvImage image, {int levels = 0}) {
+    final ptr = bindings.cv_pyramid_create(image.pointer, levels);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create pyramid');
+    }
+    return CvPyramid._(ptr);
+  }
+
+  /// 가장 작은 레벨 번호 (레벨 0은 원본)
+  int get levels => bindings.cv_pyramid_levels(_ptr);
+
+  /// Gaussian 레벨 (0: 원본, 1: 1/2, 2: 1/4, ...)
+  ///
+  /// 반환된 영상은 피라미드의 공유 버퍼를 가리키는 뷰입니다.
+  CvImage gaussian(int level) {
+    final ptr = bindings.cv_pyramid_gaussian(_ptr, level);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to get pyramid level $level');
+    }
+    return CvImage.wrap(ptr);
+  }
+
+  /// Laplacian 레벨 (8비트 입력은 CV_16S, 그 외는 CV_32F)
+  ///
+  /// [level]이 [levels]이면 가장 작은 Gaussian 레벨을 반환합니다.
+  CvImage laplacian(int level) {
+    final ptr = bindings.cv_pyramid_laplacian(_ptr, level);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to get laplacian level $level');
+    }
+    return CvImage.wrap(ptr);
+  }
+
+  /// 메모리 수동 해제 (이미 반환된 레벨 영상은 계속 유효)
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_pyramid_release(_ptr);
+  }
+}
@@ -0,0 +1,129 @@
+import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 리맵 캐시
+///
+/// 고정된 기하 변환(렌즈 왜곡 보정, 고정 카메라의 평면 보정 등)의
+/// 좌표 테이블을 생성 시 한 번만 고정소수점으로 계산해 두고,
+/// 프레임마다 테이블 조회만으로 변환합니다.
+class CvRemapCache implements ffi.Finalizable {
+  /// C++ RemapCache 포인터
+  final ffi.Pointer<gen.CvRemapCache> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_remap_cache_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvRemapCache._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 네이티브 포인터로부터 생성 (소유권을 가져옴)
+  factory CvRemapCache.wrap(ffi.Pointer<gen.CvRemapCache> ptr) {
+    return CvRemapCache._(ptr);
+  }
+
+  /// 네이티브 포인터 (캡처 스트림 부착용)
+  ffi.Pointer<gen.CvRemapCache> get pointer => _ptr;
+
+  /// 어파인 변환 캐시 ([m]: 행 우선 2x3 행렬, 출력 크기 [width] x [height])
+  factory CvRemapCache.affine(
+    List<double> m,
+    int width,
+    int height, {
+    int interpolation = 1,
+    int borderMode = 0,
+  }) {
+    if (m.length != 6) {
+      throw ArgumentError('Affine matrix must have 6 elements');
+    }
+    return _fromMatrix(m, (mC) {
+      return bindings.cv_remap_cache_create_affine(
+        mC,
+        width,
+        height,
+        interpolation,
+        borderMode,
+      );
+    });
+  }
+
+  /// 원근 변환 캐시 ([m]: 행 우선 3x3 행렬, 출력 크기 [width] x [height])
+  factory CvRemapCache.perspective(
+    List<double> m,
+    int width,
+    int height, {
+    int interpolation = 1,
+    int borderMode = 0,
+  }) {
+    if (m.length != 9) {
+      throw ArgumentError('Perspective matrix must have 9 elements');
+    }
+    return _fromMatrix(m, (mC) {
+      return bindings.cv_remap_cache_create_perspective(
+        mC,
+        width,
+        height,
+        interpolation,
+        borderMode,
+      );
+    });
+  }
+
+  /// 좌표 맵으로부터 캐시 생성 ([mapX], [mapY]: CV_32FC1 영상)
+  factory CvRemapCache.fromMaps(
+    CvImage mapX,
+    CvImage mapY, {
+    int interpolation = 1,
+    int borderMode = 0,
+  }) {
+    final ptr = bindings.cv_remap_cache_create_maps(
+      mapX.pointer,
+      mapY.pointer,
+      interpolation,
+      borderMode,
+    );
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create remap cache');
+    }
+    return CvRemapCache._(ptr);
+  }
+
+  static CvRemapCache _fromMatrix(
+    List<double> m,
+    ffi.Pointer<gen.CvRemapCache> Function(ffi.Pointer<ffi.Double>) create,
+  ) {
+    final mC = malloc.allocate<ffi.Double>(
+      ffi.sizeOf<ffi.Double>() * m.length,
+    );
+    try {
+      mC.asTypedList(m.length).setAll(0, m);
+      final ptr = create(mC);
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to create remap cache');
+      }
+      return CvRemapCache._(ptr);
+    } finally {
+      malloc.free(mC);
+    }
+  }
+
+  /// 캐시된 변환 적용
+  CvImage apply(CvImage image) {
+    final ptr = bindings.cv_remap_cache_apply(_ptr, image.pointer);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to apply remap cache');
+    }
+    return CvImage.wrap(ptr);
+  }
+
+  /// 메모리 수동 해제
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_remap_cache_release(_ptr);
+  }
+}
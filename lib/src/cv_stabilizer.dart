@@ -0,0 +1,77 @@
+import 'dart:ffi' as ffi;
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 실시간 영상 안정화기
+///
+/// 연속 프레임 간 움직임을 축소 해상도에서 추적하고, 누적 궤적을
+/// 앞뒤 [delayFrames] 프레임 이동 평균으로 평활화해 흔들림만 보정합니다.
+/// 출력은 [delayFrames] 프레임만큼 지연됩니다.
+class CvVideoStabilizer implements ffi.Finalizable {
+  /// C++ VideoStabilizer 포인터
+  final ffi.Pointer<gen.CvStabilizer> _ptr;
+
+  /// 메모리 자동 해제
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_stabilizer_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvVideoStabilizer._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 안정화기 생성
+  ///
+  /// [radius] - 궤적 평활화 반경 (클수록 부드럽지만 지연이 늘어남)
+  /// [zoom] - 보정으로 드러나는 가장자리를 가리기 위한 확대 비율 (1 이상)
+  /// [maxSide] - 움직임 추정 해상도의 긴 변
+  factory CvVideoStabilizer({
+    int radius = 15,
+    double zoom = 1.04,
+    int maxSide = 640,
+  }) {
+    final ptr = bindings.cv_stabilizer_create(radius, zoom, maxSide);
+    if (ptr == ffi.nullptr) {
+      throw Exception('Failed to create video stabilizer');
+    }
+    return CvVideoStabilizer._(ptr);
+  }
+
+  /// 네이티브 포인터 ([CvVideoCapture.attachStabilizer]에서 사용)
+  ffi.Pointer<gen.CvStabilizer> get pointer => _ptr;
+
+  /// 프레임 한 장을 넣고 보정된 프레임을 반환
+  ///
+  /// 처음 [delayFrames] 프레임 동안은 출력할 프레임이 없어 null을 반환합니다.
+  CvImage? process(CvImage frame) {
+    final matPtr = bindings.cv_mat_create();
+    final int result = bindings.cv_stabilizer_process(
+      _ptr,
+      frame.pointer,
+      matPtr,
+    );
+    if (result == 0) {
+      bindings.cv_mat_release(matPtr);
+      return null;
+    }
+    return CvImage.wrap(matPtr);
+  }
+
+  /// 궤적과 프레임 버퍼 초기화 (장면 전환 시 사용)
+  void reset() => bindings.cv_stabilizer_reset(_ptr);
+
+  /// 마지막 프레임의 처리 시간 (ms)
+  double get latencyMs => bindings.cv_stabilizer_latency_ms(_ptr);
+
+  /// 출력 지연 프레임 수
+  int get delayFrames => bindings.cv_stabilizer_delay_frames(_ptr);
+
+  /// 메모리 수동 해제
+  ///
+  /// 캡처 스트림에 부착된 상태라면 먼저 `attachStabilizer(null)`로 분리해야 합니다.
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_stabilizer_release(_ptr);
+  }
+}
@@ -0,0 +1,75 @@
+import 'dart:convert';
+import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 네이티브 함수 하나의 누적 호출 통계
+typedef CvCallStatsEntry = ({
+  String name,
+  int calls,
+  Duration total,
+  Duration min,
+  Duration max,
+  int bytesAllocated,
+  int pixels,
+  int lastWidth,
+  int lastHeight,
+});
+
+/// 네이티브 호출 통계 (모든 `cv_*` 함수의 호출 수, 시간, 할당량, 입력 크기)
+///
+/// 기본적으로 꺼져 있으며, 꺼져 있을 때의 비용은 호출당 원자 변수 읽기 한 번입니다.
+class CvStats {
+  CvStats._();
+
+  /// 계측 켜기/끄기
+  static set enabled(bool value) => bindings.cv_stats_enable(value ? 1 : 0);
+
+  /// 계측 활성 여부
+  static bool get enabled => bindings.cv_stats_enabled() != 0;
+
+  /// 모든 스레드의 통계를 함수별로 합친 목록 (총 시간 내림차순)
+  static List<CvCallStatsEntry> snapshot() {
+    final count = bindings.cv_stats_snapshot(ffi.nullptr, 0);
+    if (count == 0) return [];
+    final statsC = calloc<gen.CvCallStats>(count);
+    try {
+      final written = bindings.cv_stats_snapshot(statsC, count);
+      return List.generate(written, (i) {
+        final s = statsC[i];
+        final nameBytes = <int>[];
+        for (var j = 0; j < 64 && s.name[j] != 0; j++) {
+          nameBytes.add(s.name[j]);
+        }
+        return (
+          name: String.fromCharCodes(nameBytes),
+          calls: s.calls,
+          total: Duration(microseconds: s.totalNs ~/ 1000),
+          min: Duration(microseconds: s.minNs ~/ 1000),
+          max: Duration(microseconds: s.maxNs ~/ 1000),
+          bytesAllocated: s.bytesAllocated,
+          pixels: s.pixels,
+          lastWidth: s.lastWidth,
+          lastHeight: s.lastHeight,
+        );
+      });
+    } finally {
+      calloc.free(statsC);
+    }
+  }
+
+  /// [snapshot]과 같은 내용을 JSON 문자열로 반환
+  static String json() {
+    final result = bindings.cv_stats_json();
+    if (result.data == ffi.nullptr) return '{}';
+    try {
+      return utf8.decode(result.data.asTypedList(result.len));
+    } finally {
+      bindings.cv_free_bytes(result);
+    }
+  }
+
+  /// 누적 통계 초기화
+  static void reset() => bindings.cv_stats_reset();
+}
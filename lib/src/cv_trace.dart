@@ -0,0 +1,45 @@
+import 'dart:convert';
+import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+
+/// 네이티브 trace span 기록 (Chrome trace-event / Perfetto)
+///
+/// 켜져 있으면 모든 `cv_*` 호출, 캡처/기록 스레드의 파이프라인 단계,
+/// 내부 `parallel_for_` 조각이 스레드별 링 버퍼에 기록됩니다.
+/// 시각은 단조 시계 기준이므로 Flutter 타임라인과 함께 열어 볼 수 있습니다.
+class CvTrace {
+  CvTrace._();
+
+  /// 기록 켜기/끄기
+  static set enabled(bool value) => bindings.cv_trace_enable(value ? 1 : 0);
+
+  /// 기록 활성 여부
+  static bool get enabled => bindings.cv_trace_enabled() != 0;
+
+  /// 현재 스레드의 trace 이름 지정 (예: 'dart_ui')
+  static void setThreadName(String name) {
+    final nameC = name.toNativeUtf8();
+    try {
+      bindings.cv_trace_set_thread_name(nameC.cast());
+    } finally {
+      malloc.free(nameC);
+    }
+  }
+
+  /// 링 버퍼에 남은 span을 Chrome trace-event JSON 문자열로 반환
+  ///
+  /// 파일로 저장해 `ui.perfetto.dev`나 `chrome://tracing`에서 열 수 있습니다.
+  static String export() {
+    final result = bindings.cv_trace_export();
+    if (result.data == ffi.nullptr) return '{"traceEvents":[]}';
+    try {
+      return utf8.decode(result.data.asTypedList(result.len));
+    } finally {
+      bindings.cv_free_bytes(result);
+    }
+  }
+
+  /// 기록된 span 비우기
+  static void reset() => bindings.cv_trace_reset();
+}
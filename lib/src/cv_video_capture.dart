@@ -1,7 +1,46 @@
 import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart';
 import 'package:flutter_opencv/flutter_opencv.dart';
 import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
 
+/// 지연 통계 구간
+enum CvLatencyStage {
+  /// grab 완료 -> read가 받은 시점 (디코드 큐 대기)
+  queue(0),
+
+  /// read가 받은 시점 -> 부착된 단계 처리 완료
+  process(1),
+
+  /// grab 완료 -> 부착된 단계 처리 완료
+  captureToProcessed(2),
+
+  /// grab 완료 -> [CvVideoCapture.markDone] (표시/인코딩까지)
+  endToEnd(3);
+
+  const CvLatencyStage(this.value);
+
+  /// 네이티브 구간 번호 (`CV_LATENCY_*`)
+  final int value;
+}
+
+/// 프레임 시각 ([CvVideoCapture.nowNs] 기준 ns)
+typedef CvFrameTimingInfo = ({
+  int frameIndex,
+  int captureNs,
+  int dequeueNs,
+  int processedNs,
+});
+
+/// 구간 지연 통계 (ms)
+typedef CvLatencySummary = ({
+  int count,
+  double meanMs,
+  double p50Ms,
+  double p95Ms,
+  double p99Ms,
+  double maxMs,
+});
+
 /// OpenCV VideoCapture 래퍼
 class CvVideoCapture implements ffi.Finalizable {
   /// C++ cv::VideoCapture 포인터
@@ -17,6 +56,26 @@ class CvVideoCapture implements ffi.Finalizable {
         .cast<ffi.NativeFinalizerFunction>(),
   );
 
+  /// 부착된 노이즈 제거기 (네이티브 쪽 참조가 유효하도록 유지)
+  // ignore: unused_field
+  CvTemporalDenoiser? _denoiser;
+
+  /// 부착된 리맵 캐시
+  // ignore: unused_field
+  CvRemapCache? _remap;
+
+  /// 부착된 프레임 통계 수집기
+  // ignore: unused_field
+  CvFrameStatsCollector? _frameStats;
+
+  /// 부착된 움직임 검출기
+  // ignore: unused_field
+  CvMotionDetector? _motion;
+
+  /// 부착된 영상 안정화기
+  // ignore: unused_field
+  CvVideoStabilizer? _stabilizer;
+
   CvVideoCapture._(this._ptr, this._dylib) {
     _finalizer.attach(this, _ptr.cast(), detach: this);
   }
@@ -30,6 +89,34 @@ class CvVideoCapture implements ffi.Finalizable {
     return CvVideoCapture._(ptr, dylib);
   }
 
+  /// 동영상 파일 또는 스트림 URL 열기
+  ///
+  /// [api] - 백엔드 (`cv::CAP_*`, 0이면 자동 선택)
+  /// [queueSize] - 백그라운드 스레드가 미리 디코드해 둘 프레임 수 (0이면 동기 디코드)
+  /// [stride] - N 프레임마다 한 장만 디코드 (나머지는 grab으로 건너뜀)
+  static CvVideoCapture? open(
+    String path, {
+    int api = 0,
+    int queueSize = 8,
+    int stride = 1,
+  }) {
+    final pathC = path.toNativeUtf8();
+    try {
+      final ptr = bindings.cv_videocapture_open(
+        pathC.cast(),
+        api,
+        queueSize,
+        stride,
+      );
+      if (ptr == ffi.nullptr) {
+        return null;
+      }
+      return CvVideoCapture._(ptr, dylib);
+    } finally {
+      malloc.free(pathC);
+    }
+  }
+
   /// 프레임 읽기
   CvImage? read() {
     final matPtr = bindings.cv_mat_create();
@@ -55,6 +142,120 @@ class CvVideoCapture implements ffi.Finalizable {
     bindings.cv_videocapture_set(_ptr, propId, value);
   }
 
+  /// [frameIndex] 프레임으로 이동 (미리 디코드된 프레임은 버려짐)
+  ///
+  /// 부착된 안정화기와 디노이저의 프레임 이력도 초기화되므로 seek 직후
+  /// [read]는 다시 지연 프레임만큼 읽은 뒤 목표 프레임을 반환합니다.
+  ///
+  /// 재생 위치는 `set(CAP_PROP_POS_FRAMES)` 대신 이 함수로 바꿔야
+  /// 디코드 큐와 [position]이 맞게 유지됩니다.
+  bool seek(int frameIndex) =>
+      bindings.cv_videocapture_seek(_ptr, frameIndex) != 0;
+
+  /// 마지막 [read]로 반환된 프레임 번호 (아직 없으면 -1)
+  int get position => bindings.cv_videocapture_position(_ptr);
+
+  /// 네이티브 프레임 시각과 같은 기준의 현재 시각 (ns)
+  static int get nowNs => bindings.cv_monotonic_ns();
+
+  /// 마지막 [read]로 반환된 프레임의 시각. 아직 없으면 null
+  CvFrameTimingInfo? get timing {
+    final timingC = calloc<gen.CvFrameTiming>();
+    try {
+      if (bindings.cv_videocapture_timing(_ptr, timingC) == 0) return null;
+      final t = timingC.ref;
+      return (
+        frameIndex: t.frameIndex,
+        captureNs: t.captureNs,
+        dequeueNs: t.dequeueNs,
+        processedNs: t.processedNs,
+      );
+    } finally {
+      calloc.free(timingC);
+    }
+  }
+
+  /// 마지막 프레임의 표시/인코딩이 끝났음을 기록
+  ///
+  /// [CvLatencyStage.endToEnd] 통계에 캡처부터 지금까지의 시간이 추가됩니다.
+  void markDone() => bindings.cv_videocapture_mark_done(_ptr);
+
+  /// [stage] 구간의 누적 지연 통계 (p50/p95/p99)
+  CvLatencySummary latency(CvLatencyStage stage) {
+    final statsC = calloc<gen.CvLatencyStats>();
+    try {
+      bindings.cv_videocapture_latency(_ptr, stage.value, statsC);
+      final s = statsC.ref;
+      return (
+        count: s.count,
+        meanMs: s.meanMs,
+        p50Ms: s.p50Ms,
+        p95Ms: s.p95Ms,
+        p99Ms: s.p99Ms,
+        maxMs: s.maxMs,
+      );
+    } finally {
+      calloc.free(statsC);
+    }
+  }
+
+  /// 지연 통계 초기화
+  void resetLatency() => bindings.cv_videocapture_latency_reset(_ptr);
+
+  /// 시간적 노이즈 제거기 부착 (null이면 분리)
+  ///
+  /// 부착하면 [read]가 디노이즈된 프레임을 반환합니다.
+  void attachDenoiser(CvTemporalDenoiser? denoiser) {
+    bindings.cv_videocapture_set_denoiser(
+      _ptr,
+      denoiser?.pointer ?? ffi.nullptr,
+    );
+    _denoiser = denoiser;
+  }
+
+  /// 리맵 캐시 부착 (null이면 분리)
+  ///
+  /// 부착하면 [read]가 변환된 프레임을 반환합니다.
+  /// 노이즈 제거기가 함께 부착되어 있으면 리맵이 먼저 적용됩니다.
+  void attachRemap(CvRemapCache? cache) {
+    bindings.cv_videocapture_set_remap(_ptr, cache?.pointer ?? ffi.nullptr);
+    _remap = cache;
+  }
+
+  /// 프레임 통계 수집기 부착 (null이면 분리)
+  ///
+  /// 부착하면 [read]마다 최종 프레임의 통계가 갱신됩니다.
+  void attachFrameStats(CvFrameStatsCollector? collector) {
+    bindings.cv_videocapture_set_frame_stats(
+      _ptr,
+      collector?.pointer ?? ffi.nullptr,
+    );
+    _frameStats = collector;
+  }
+
+  /// 움직임 검출기 부착 (null이면 분리)
+  ///
+  /// 부착하면 [read]마다 최종 프레임으로 움직임 정보가 갱신됩니다.
+  void attachMotionDetector(CvMotionDetector? detector) {
+    bindings.cv_videocapture_set_motion_detector(
+      _ptr,
+      detector?.pointer ?? ffi.nullptr,
+    );
+    _motion = detector;
+  }
+
+  /// 영상 안정화기 부착 (null이면 분리)
+  ///
+  /// 부착하면 [read]가 안정화된 프레임을 반환합니다.
+  /// 리맵 뒤, 노이즈 제거 앞에 적용되며 첫 [read]는 지연 프레임만큼 더 읽습니다.
+  void attachStabilizer(CvVideoStabilizer? stabilizer) {
+    bindings.cv_videocapture_set_stabilizer(
+      _ptr,
+      stabilizer?.pointer ?? ffi.nullptr,
+    );
+    _stabilizer = stabilizer;
+  }
+
   /// 메모리 수동 해제
   void dispose() {
     _finalizer.detach(this);
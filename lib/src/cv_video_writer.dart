@@ -0,0 +1,89 @@
+import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart';
+import 'package:flutter_opencv/flutter_opencv.dart';
+import 'package:flutter_opencv/flutter_opencv_bindings_generated.dart' as gen;
+
+/// 비동기 동영상 기록기 (cv::VideoWriter 래퍼)
+///
+/// 프레임은 복사 없이 큐로 이동되고 별도 스레드에서 인코딩되므로
+/// [write]가 처리 루프를 오래 막지 않습니다.
+class CvVideoWriter implements ffi.Finalizable {
+  /// C++ AsyncVideoWriter 포인터
+  final ffi.Pointer<gen.CvVideoWriter> _ptr;
+
+  /// 메모리 자동 해제 (남은 프레임을 기록한 뒤 닫음)
+  static final ffi.NativeFinalizer _finalizer = ffi.NativeFinalizer(
+    bindings.addresses.cv_videowriter_release
+        .cast<ffi.NativeFinalizerFunction>(),
+  );
+
+  CvVideoWriter._(this._ptr) {
+    _finalizer.attach(this, _ptr.cast(), detach: this);
+  }
+
+  /// 동영상 파일 열기
+  ///
+  /// [fourcc] - 코덱 4 글자 (예: 'mp4v', 'MJPG', 'avc1')
+  /// [isColor] - false면 그레이 영상으로 기록
+  /// [queueSize] - 인코딩을 기다릴 수 있는 프레임 수
+  /// [dropWhenFull] - true면 큐가 가득 찼을 때 새 프레임을 버리고,
+  /// false면 빈자리가 날 때까지 [write]가 대기
+  factory CvVideoWriter.open(
+    String path, {
+    required int width,
+    required int height,
+    double fps = 30,
+    String fourcc = 'mp4v',
+    bool isColor = true,
+    int queueSize = 8,
+    bool dropWhenFull = true,
+  }) {
+    final pathC = path.toNativeUtf8();
+    final fourccC = fourcc.toNativeUtf8();
+    try {
+      final ptr = bindings.cv_videowriter_open(
+        pathC.cast(),
+        fourccC.cast(),
+        fps,
+        width,
+        height,
+        isColor ? 1 : 0,
+        queueSize,
+        dropWhenFull ? 1 : 0,
+      );
+      if (ptr == ffi.nullptr) {
+        throw Exception('Failed to open video writer');
+      }
+      return CvVideoWriter._(ptr);
+    } finally {
+      malloc.free(pathC);
+      malloc.free(fourccC);
+    }
+  }
+
+  /// 프레임을 기록 큐에 넣음
+  ///
+  /// 성공하면 [frame]의 데이터가 기록기로 이동되어 [frame]은 빈 이미지가 됩니다.
+  /// 큐가 가득 차 버려졌으면 false를 반환하고 [frame]은 그대로 남습니다.
+  /// 크기와 채널이 다르면 쓰기 스레드에서 맞춰 기록됩니다.
+  bool write(CvImage frame) =>
+      bindings.cv_videowriter_write(_ptr, frame.pointer) != 0;
+
+  /// 인코딩을 기다리는 프레임 수
+  int get pending => bindings.cv_videowriter_pending(_ptr);
+
+  /// 기록된 프레임 수
+  int get written => bindings.cv_videowriter_written(_ptr);
+
+  /// 버려지거나 기록하지 못한 프레임 수
+  int get dropped => bindings.cv_videowriter_dropped(_ptr);
+
+  /// 남은 프레임을 모두 기록하고 파일을 닫음
+  void close() => bindings.cv_videowriter_close(_ptr);
+
+  /// 메모리 수동 해제 (남은 프레임을 기록한 뒤 닫음)
+  void dispose() {
+    _finalizer.detach(this);
+    bindings.cv_videowriter_release(_ptr);
+  }
+}
@@ -0,0 +1,280 @@
+// 입력 Mat 하나로 결과를 만드는 C ABI 함수 측정
+#include "bench_util.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+const double kRotate15[6] = {0.966, -0.259, 120.0, 0.259, 0.966, -80.0};
+const double kPerspective[9] = {1.0, 0.08, -20.0, 0.05, 1.0, -10.0, 0.00004, 0.00006, 1.0};
+const float kSharpenKernel[9] = {0, -1, 0, -1, 5, -1, 0, -1, 0};
+const float kGaussian5[5] = {1 / 16.f, 4 / 16.f, 6 / 16.f, 4 / 16.f, 1 / 16.f};
+
+} // namespace
+
+// 색상 변환
+BENCH_MAT(cv_cvtColor_bgr2gray, Color, cv_cvtColor_bgr2gray(src));
+BENCH_MAT(cv_cvtColor_bgr2rgb, Color, cv_cvtColor_bgr2rgb(src));
+BENCH_MAT(cv_cvtColor_bgr2hsv, Color, cv_cvtColor_bgr2hsv(src));
+BENCH_MAT(cv_cvtColor_hsv2bgr, Color, cv_cvtColor_hsv2bgr(src));
+BENCH_MAT(cv_cvtColor_bgr2lab, Color, cv_cvtColor_bgr2lab(src));
+BENCH_MAT(cv_cvtColor_lab2bgr, Color, cv_cvtColor_lab2bgr(src));
+
+// 기하 변환
+BENCH_MAT(cv_resize_half, AnyChannels, cv_resize(src, input.image.cols / 2, input.image.rows / 2, -1));
+BENCH_MAT(cv_resize_up2x_linear, GraySmall, cv_resize(src, input.image.cols * 2, input.image.rows * 2, cv::INTER_LINEAR));
+BENCH_MAT(cv_flip, AnyChannels, cv_flip(src, 1));
+BENCH_MAT(cv_rotate, AnyChannels, cv_rotate(src, 0));
+BENCH_MAT(cv_warp_affine, AnyChannels, cv_warp_affine(src, kRotate15, input.image.cols, input.image.rows, cv::INTER_LINEAR, cv::BORDER_CONSTANT));
+BENCH_MAT(cv_warp_perspective, AnyChannels, cv_warp_perspective(src, kPerspective, input.image.cols, input.image.rows, cv::INTER_LINEAR, cv::BORDER_CONSTANT));
+
+// 고배율 축소: 12MP 컬러에서 2x ~ 32x (자동 보간: 정수 배율 박스 축소 경로)
+static void BM_cv_resize_reduce(benchmark::State& state) {
+    const cv::Mat image = bench::make_scene(4000, 3000, 3);
+    const int factor = (int)state.range(0);
+    const int interpolation = (int)state.range(1);
+    for (auto _ : state) {
+        CvMat* out = cv_resize((CvMat*)&image, image.cols / factor, image.rows / factor, interpolation);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, image);
+}
+BENCHMARK(BM_cv_resize_reduce)
+    ->ArgNames({"factor", "interp"})
+    ->ArgsProduct({{2, 4, 8, 16, 32}, {-1, cv::INTER_AREA, cv::INTER_LINEAR}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_cv_remap(benchmark::State& state) {
+    bench::Input input(state);
+    cv::Mat mapX(input.image.size(), CV_32FC1), mapY(input.image.size(), CV_32FC1);
+    for (int y = 0; y < mapX.rows; y++) {
+        for (int x = 0; x < mapX.cols; x++) {
+            mapX.at<float>(y, x) = x + 3.0f * std::sin(y * 0.02f);
+            mapY.at<float>(y, x) = y + 3.0f * std::cos(x * 0.02f);
+        }
+    }
+    for (auto _ : state) {
+        CvMat* out = cv_remap(input.mat, (CvMat*)&mapX, (CvMat*)&mapY, cv::INTER_LINEAR, cv::BORDER_REFLECT);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_remap)->Apply(bench::AnyChannels);
+
+// 블러 / 에지
+BENCH_MAT(cv_gaussian_blur, AnyChannels, cv_gaussian_blur(src, 5, 0));
+BENCH_MAT(cv_gaussian_blur_k15, Color, cv_gaussian_blur(src, 15, 0));
+BENCH_MAT(cv_median_blur, AnyChannels, cv_median_blur(src, 5));
+BENCH_MAT(cv_bilateral_filter, ColorSmall, cv_bilateral_filter(src, 9, 75, 75));
+BENCH_MAT(cv_canny, Gray, cv_canny(src, 50, 150));
+BENCH_MAT(cv_sobel, AnyChannels, cv_sobel(src, 1, 0, 3));
+BENCH_MAT(cv_laplacian, AnyChannels, cv_laplacian(src, 3));
+BENCH_MAT(cv_sharpen, AnyChannels, cv_sharpen(src));
+
+// 형태학 / 필터
+BENCH_MAT(cv_erode, AnyChannels, cv_erode(src, 5, 1));
+BENCH_MAT(cv_dilate, AnyChannels, cv_dilate(src, 5, 1));
+BENCH_MAT(cv_morphology_ex_open, AnyChannels, cv_morphology_ex(src, cv::MORPH_OPEN, 5));
+BENCH_MAT(cv_morphology_ex_gradient_k15, Gray, cv_morphology_ex(src, cv::MORPH_GRADIENT, 15));
+BENCH_MAT(cv_filter2d, AnyChannels, cv_filter2d(src, kSharpenKernel, 3, 3, -1, -1, 0, cv::BORDER_DEFAULT));
+BENCH_MAT(cv_sep_filter2d, AnyChannels, cv_sep_filter2d(src, kGaussian5, 5, kGaussian5, 5, -1, -1, 0, cv::BORDER_DEFAULT));
+BENCH_MAT(cv_unsharp_mask, AnyChannels, cv_unsharp_mask(src, 2.0, 1.0, 0));
+
+// 임계값 / 이진화
+BENCH_MAT(cv_threshold, Gray, cv_threshold(src, 127, 255, cv::THRESH_BINARY));
+BENCH_MAT(cv_threshold_otsu, Gray, cv_threshold(src, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU));
+BENCH_MAT(cv_adaptive_threshold, Gray, cv_adaptive_threshold(src, 255, cv::ADAPTIVE_THRESH_GAUSSIAN_C, cv::THRESH_BINARY, 11, 2));
+BENCH_MAT(cv_adaptive_threshold_mean_w25, Gray, cv_adaptive_threshold(src, 255, cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY, 25, 10));
+BENCH_MAT(cv_binarize_document_sauvola, Gray, cv_binarize_document(src, 0, 25, 0.2, 128, 1));
+BENCH_MAT(cv_binarize_document_sauvola_ms2, Gray, cv_binarize_document(src, 0, 25, 0.2, 128, 2));
+BENCH_MAT(cv_binarize_document_wolf, Gray, cv_binarize_document(src, 1, 25, 0.5, 128, 1));
+BENCH_MAT(cv_binarize_document_niblack, Gray, cv_binarize_document(src, 2, 25, -0.2, 128, 1));
+
+// 히스토그램
+BENCH_MAT(cv_equalize_hist, AnyChannels, cv_equalize_hist(src));
+
+static void BM_cv_calc_hist(benchmark::State& state) {
+    bench::Input input(state);
+    std::vector<float> hist(256 * 4);
+    for (auto _ : state) {
+        const int written = cv_calc_hist(input.mat, -1, 256, 0, 256, nullptr, hist.data());
+        benchmark::DoNotOptimize(written);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_calc_hist)->Apply(bench::AnyChannels);
+
+// 노이즈 제거 (느려서 FHD 까지)
+BENCH_MAT(cv_fast_nl_means_denoising, GraySmall, cv_fast_nl_means_denoising(src, 10, 7, 21));
+BENCH_MAT(cv_fast_nl_means_denoising_colored, ColorSmall, cv_fast_nl_means_denoising_colored(src, 10, 10, 7, 21));
+
+// 조밀 옵티컬 플로우 (다음 프레임은 3 픽셀 평행 이동)
+static void BM_cv_optical_flow_dense(benchmark::State& state) {
+    bench::Input input(state);
+    cv::Mat next;
+    const cv::Mat shift = (cv::Mat_<double>(2, 3) << 1, 0, 3, 0, 1, 2);
+    cv::warpAffine(input.image, next, shift, input.image.size(), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    const int method = (int)state.range(3);
+    for (auto _ : state) {
+        CvMat* out = cv_optical_flow_dense(input.mat, (CvMat*)&next, method, 1);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_optical_flow_dense)
+    ->ArgNames({"w", "h", "ch", "method"})
+    ->Args({640, 480, 1, 0})
+    ->Args({1280, 720, 1, 0})
+    ->Args({1920, 1080, 1, 0})
+    ->Args({640, 480, 1, 1})
+    ->Args({1280, 720, 1, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// 문서 스캐너 단계
+static void BM_cv_document_detect(benchmark::State& state) {
+    const cv::Mat doc = bench::make_document((int)state.range(0), (int)state.range(1));
+    float quad[8];
+    for (auto _ : state) {
+        const double confidence = cv_document_detect((CvMat*)&doc, 640, quad);
+        benchmark::DoNotOptimize(confidence);
+    }
+    bench::set_throughput(state, doc);
+}
+BENCHMARK(BM_cv_document_detect)->Apply(bench::Color);
+
+static void BM_cv_document_refine_warp(benchmark::State& state) {
+    const cv::Mat doc = bench::make_document((int)state.range(0), (int)state.range(1));
+    float detected[8];
+    if (cv_document_detect((CvMat*)&doc, 640, detected) <= 0) {
+        state.SkipWithError("document not detected");
+        return;
+    }
+    for (auto _ : state) {
+        float quad[8];
+        std::copy(detected, detected + 8, quad);
+        cv_document_refine((CvMat*)&doc, quad, 12);
+        CvMat* out = cv_document_warp((CvMat*)&doc, quad, 0, 0);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, doc);
+}
+BENCHMARK(BM_cv_document_refine_warp)->Apply(bench::Color);
+
+// 입출력
+static void BM_cv_imencode(benchmark::State& state) {
+    bench::Input input(state);
+    const char* ext = state.range(3) == 0 ? ".jpg" : ".png";
+    for (auto _ : state) {
+        struct BytesResult bytes = cv_imencode(ext, input.mat);
+        benchmark::DoNotOptimize(bytes.data);
+        cv_free_bytes(bytes);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_imencode)
+    ->ArgNames({"w", "h", "ch", "png"})
+    ->Args({640, 480, 3, 0})
+    ->Args({1920, 1080, 3, 0})
+    ->Args({4000, 3000, 3, 0})
+    ->Args({640, 480, 3, 1})
+    ->Args({1920, 1080, 3, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_cv_imdecode(benchmark::State& state) {
+    bench::Input input(state);
+    std::vector<uint8_t> jpeg;
+    cv::imencode(".jpg", input.image, jpeg);
+    for (auto _ : state) {
+        CvMat* out = cv_imdecode(jpeg.data(), (int)jpeg.size());
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_imdecode)->Apply(bench::Color);
+
+static void BM_cv_imwrite_imread(benchmark::State& state) {
+    bench::Input input(state);
+    const std::string path = "/tmp/flutter_opencv_bench_" + std::to_string(input.image.cols) + ".jpg";
+    for (auto _ : state) {
+        cv_imwrite(path.c_str(), input.mat);
+        CvMat* out = cv_imread(path.c_str());
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_imwrite_imread)->Apply(bench::ColorSmall);
+
+// 윤곽선 (결과 배열은 malloc 으로 할당되어 cv_free_contours 로 해제)
+static void BM_cv_find_contours(benchmark::State& state) {
+    bench::Input input(state);
+    cv::Mat edges;
+    cv::Canny(input.image, edges, 50, 150);
+    for (auto _ : state) {
+        struct ContoursResult contours = cv_find_contours((CvMat*)&edges, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+        benchmark::DoNotOptimize(contours.num_contours);
+        cv_free_contours(contours);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_find_contours)->Apply(bench::Gray);
+
+static void BM_cv_draw_contours(benchmark::State& state) {
+    bench::Input input(state);
+    cv::Mat edges;
+    cv::Canny(input.image, edges, 50, 150);
+    struct ContoursResult contours = cv_find_contours((CvMat*)&edges, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+    cv::Mat canvas(input.image.size(), CV_8UC3, cv::Scalar(0, 0, 0));
+    for (auto _ : state) {
+        cv_draw_contours((CvMat*)&canvas, contours, -1, 0, 255, 0, 2);
+    }
+    cv_free_contours(contours);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_draw_contours)->Apply(bench::Gray);
+
+// 그리기 (제자리 수정)
+static void BM_cv_draw(benchmark::State& state) {
+    bench::Input input(state);
+    const int w = input.image.cols, h = input.image.rows;
+    for (auto _ : state) {
+        cv_rectangle(input.mat, w / 8, h / 8, w / 2, h / 2, 255, 0, 0, 3);
+        cv_circle(input.mat, w / 2, h / 2, h / 4, 0, 255, 0, 3);
+        cv_line(input.mat, 0, 0, w - 1, h - 1, 0, 0, 255, 3);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_draw)->Apply(bench::Color);
+
+// Mat 생성/접근자 (FFI 호출 한 번당 고정 비용)
+static void BM_cv_mat_accessors(benchmark::State& state) {
+    bench::Input input(state);
+    for (auto _ : state) {
+        CvMat* empty = cv_mat_create();
+        int sum = cv_mat_width(input.mat) + cv_mat_height(input.mat) + cv_mat_channels(input.mat) + cv_mat_data_len(input.mat);
+        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(cv_mat_data(input.mat));
+        cv_mat_release(empty);
+    }
+}
+BENCHMARK(BM_cv_mat_accessors)->Args({640, 480, 3});
+
+// 같은 속성을 cv_mat_info 한 번으로 조회
+static void BM_cv_mat_info(benchmark::State& state) {
+    bench::Input input(state);
+    struct CvMatInfo info;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cv_mat_info(input.mat, &info));
+        benchmark::DoNotOptimize(info);
+    }
+}
+BENCHMARK(BM_cv_mat_info)->Args({640, 480, 3});
@@ -0,0 +1,473 @@
+// 재사용 객체 (커널, CLAHE, LUT, 적분 영상, 피라미드, 리맵 캐시, 스트림 단계) 와 계측 오버헤드 측정
+#include "bench_util.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static void BM_cv_kernel_ops(benchmark::State& state) {
+    bench::Input input(state);
+    CvKernel* kernel = cv_kernel_create(2, 7, 7);
+    for (auto _ : state) {
+        CvMat* eroded = cv_erode_kernel(input.mat, kernel, 1);
+        CvMat* dilated = cv_dilate_kernel(input.mat, kernel, 1);
+        CvMat* closed = cv_morphology_ex_kernel(input.mat, cv::MORPH_CLOSE, kernel, 1);
+        benchmark::DoNotOptimize(closed);
+        cv_mat_release(eroded);
+        cv_mat_release(dilated);
+        cv_mat_release(closed);
+    }
+    cv_kernel_release(kernel);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_kernel_ops)->Apply(bench::AnyChannels);
+
+static void BM_cv_filter2d_kernel(benchmark::State& state) {
+    bench::Input input(state);
+    std::vector<float> box(9 * 9, 1.0f / 81.0f);
+    CvKernel* kernel = cv_kernel_create_custom(box.data(), 9, 9, -1, -1);
+    for (auto _ : state) {
+        CvMat* out = cv_filter2d_kernel(input.mat, kernel, 0, cv::BORDER_DEFAULT);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    cv_kernel_release(kernel);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_filter2d_kernel)->Apply(bench::AnyChannels);
+
+static void BM_cv_clahe_apply(benchmark::State& state) {
+    bench::Input input(state);
+    CvClahe* clahe = cv_clahe_create(2.0, 8, 8);
+    for (auto _ : state) {
+        CvMat* out = cv_clahe_apply(clahe, input.mat);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    cv_clahe_set(clahe, 3.0, 4, 4);
+    cv_clahe_release(clahe);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_clahe_apply)->Apply(bench::AnyChannels);
+
+// range(3): 0=1D 톤 테이블, 1=17^3 3D 격자 추가
+static void BM_cv_lut_apply(benchmark::State& state) {
+    bench::Input input(state);
+    CvLut* lut = cv_lut_create();
+    cv_lut_brightness(lut, -1, 10);
+    cv_lut_contrast(lut, -1, 1.2, 128);
+    cv_lut_gamma(lut, -1, 0.9);
+    cv_lut_levels(lut, -1, 8, 248, 0, 255);
+    const float curve[6] = {0, 0, 128, 140, 255, 255};
+    cv_lut_curve(lut, -1, curve, 3);
+    std::vector<uint8_t> invert(256);
+    for (int i = 0; i < 256; i++) invert[i] = (uint8_t)(255 - i);
+    cv_lut_table(lut, 0, invert.data());
+    if (state.range(3) != 0) {
+        const int size = 17;
+        std::vector<float> grid(size * size * size * 3);
+        for (int b = 0, i = 0; b < size; b++) {
+            for (int g = 0; g < size; g++) {
+                for (int r = 0; r < size; r++, i += 3) {
+                    grid[i] = r / (float)(size - 1);
+                    grid[i + 1] = g / (float)(size - 1) * 0.95f;
+                    grid[i + 2] = b / (float)(size - 1);
+                }
+            }
+        }
+        cv_lut_set_3d(lut, grid.data(), size);
+    }
+    for (auto _ : state) {
+        CvMat* out = cv_lut_apply(lut, input.mat);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    cv_lut_reset(lut);
+    cv_lut_release(lut);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_lut_apply)
+    ->ArgNames({"w", "h", "ch", "grid3d"})
+    ->ArgsProduct({{640, 1920, 4000}, {480, 1080, 3000}, {3}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_cv_integral(benchmark::State& state) {
+    bench::Input input(state);
+    CvIntegral* integral = cv_integral_create();
+    // 1000 개의 32x32 창 평균/분산 (템플릿 매칭, 적응형 처리 패턴)
+    std::vector<int> rects;
+    cv::RNG rng(7);
+    for (int i = 0; i < 1000; i++) {
+        rects.insert(rects.end(), {rng.uniform(0, input.image.cols - 32), rng.uniform(0, input.image.rows - 32), 32, 32});
+    }
+    std::vector<double> sums(1000), means(1000), variances(1000);
+    for (auto _ : state) {
+        cv_integral_compute(integral, input.mat, 1 | 2);
+        cv_integral_rect_sums(integral, rects.data(), 1000, 0, sums.data());
+        cv_integral_rect_stats(integral, rects.data(), 1000, 0, means.data(), variances.data());
+        cv_integral_tilted_sums(integral, rects.data(), 1000, 0, sums.data());
+        benchmark::DoNotOptimize(variances.data());
+    }
+    cv_integral_release(integral);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_integral)->Apply(bench::Gray);
+
+static void BM_cv_pyramid(benchmark::State& state) {
+    bench::Input input(state);
+    for (auto _ : state) {
+        CvPyramid* pyramid = cv_pyramid_create(input.mat, 5);
+        const int levels = cv_pyramid_levels(pyramid);
+        for (int level = 0; level < levels; level++) {
+            CvMat* gaussian = cv_pyramid_gaussian(pyramid, level);
+            CvMat* laplacian = cv_pyramid_laplacian(pyramid, level);
+            benchmark::DoNotOptimize(laplacian);
+            cv_mat_release(gaussian);
+            cv_mat_release(laplacian);
+        }
+        cv_pyramid_release(pyramid);
+    }
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_pyramid)->Apply(bench::AnyChannels);
+
+// 캐시 생성은 한 번, 적용만 반복 (cv_warp_affine 과 비교)
+static void BM_cv_remap_cache_apply(benchmark::State& state) {
+    bench::Input input(state);
+    const double m[6] = {0.966, -0.259, 120.0, 0.259, 0.966, -80.0};
+    CvRemapCache* cache = cv_remap_cache_create_affine(m, input.image.cols, input.image.rows, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    for (auto _ : state) {
+        CvMat* out = cv_remap_cache_apply(cache, input.mat);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    cv_remap_cache_release(cache);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_remap_cache_apply)->Apply(bench::AnyChannels);
+
+static void BM_cv_remap_cache_create(benchmark::State& state) {
+    const int width = (int)state.range(0), height = (int)state.range(1);
+    const double h[9] = {1.0, 0.08, -20.0, 0.05, 1.0, -10.0, 0.00004, 0.00006, 1.0};
+    cv::Mat mapX(height, width, CV_32FC1, cv::Scalar(10)), mapY(height, width, CV_32FC1, cv::Scalar(10));
+    for (auto _ : state) {
+        CvRemapCache* perspective = cv_remap_cache_create_perspective(h, width, height, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+        CvRemapCache* maps = cv_remap_cache_create_maps((CvMat*)&mapX, (CvMat*)&mapY, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+        benchmark::DoNotOptimize(maps);
+        cv_remap_cache_release(perspective);
+        cv_remap_cache_release(maps);
+    }
+}
+BENCHMARK(BM_cv_remap_cache_create)->Apply(bench::Gray);
+
+// 보정 파라미터를 직접 지정해 왜곡 보정 캐시 생성 + 적용 (보정 자체는 실제 촬영 세트가 필요해 제외)
+static void BM_cv_undistorter(benchmark::State& state) {
+    bench::Input input(state);
+    const double w = input.image.cols, h = input.image.rows;
+    const double camera[9] = {w * 0.8, 0, w / 2, 0, w * 0.8, h / 2, 0, 0, 1};
+    const double dist[5] = {-0.28, 0.07, 0.0005, -0.0003, 0};
+    CvCalibration* calib = cv_calibration_create(9, 6, 1.0f);
+    cv_calibration_set_params(calib, camera, dist, input.image.cols, input.image.rows);
+    CvRemapCache* undistorter = cv_undistorter_create(calib, 0.0, cv::INTER_LINEAR);
+    double cameraOut[9], distOut[5];
+    int sizeOut[2];
+    cv_calibration_get_params(calib, cameraOut, distOut, sizeOut);
+    for (auto _ : state) {
+        CvMat* out = cv_remap_cache_apply(undistorter, input.mat);
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    cv_remap_cache_release(undistorter);
+    cv_calibration_release(calib);
+    bench::set_throughput(state, input.image);
+}
+BENCHMARK(BM_cv_undistorter)->Apply(bench::Color);
+
+// 체스보드 검출 (cv_calibration_add_frame)
+static void BM_cv_calibration_add_frame(benchmark::State& state) {
+    const int square = (int)state.range(0) / 14;
+    cv::Mat board((int)state.range(1), (int)state.range(0), CV_8UC1, cv::Scalar(255));
+    for (int y = 0; y < 7; y++) {
+        for (int x = 0; x < 10; x++) {
+            if ((x + y) % 2 == 0) cv::rectangle(board, cv::Rect((x + 2) * square, (y + 1) * square, square, square), cv::Scalar(0), -1);
+        }
+    }
+    CvCalibration* calib = cv_calibration_create(9, 6, 1.0f);
+    std::vector<float> corners(9 * 6 * 2);
+    for (auto _ : state) {
+        const int found = cv_calibration_add_frame(calib, (CvMat*)&board, corners.data());
+        benchmark::DoNotOptimize(found);
+    }
+    benchmark::DoNotOptimize(cv_calibration_frame_count(calib));
+    cv_calibration_release(calib);
+    bench::set_throughput(state, board);
+}
+BENCHMARK(BM_cv_calibration_add_frame)->Apply(bench::GraySmall);
+
+// 원근 왜곡한 체스보드 10 장으로 보정 + 저장/불러오기
+static void BM_cv_calibration_calibrate(benchmark::State& state) {
+    const int width = (int)state.range(0), height = (int)state.range(1);
+    const int square = width / 14;
+    cv::Mat board(height, width, CV_8UC1, cv::Scalar(255));
+    for (int y = 0; y < 7; y++) {
+        for (int x = 0; x < 10; x++) {
+            if ((x + y) % 2 == 0) cv::rectangle(board, cv::Rect((x + 2) * square, (y + 1) * square, square, square), cv::Scalar(0), -1);
+        }
+    }
+    CvCalibration* calib = cv_calibration_create(9, 6, 1.0f);
+    for (int view = 0; view < 10; view++) {
+        const double tilt = (view - 5) * 0.00004;
+        const double h[9] = {1.0, 0.02 * (view % 3), 0.0, 0.01 * (view % 2), 1.0, 0.0, tilt, -tilt * 0.5, 1.0};
+        cv::Mat warped;
+        cv::warpPerspective(board, warped, cv::Mat(3, 3, CV_64FC1, (void*)h), board.size(), cv::INTER_LINEAR, cv::BORDER_CONSTANT, cv::Scalar(255));
+        cv_calibration_add_frame(calib, (CvMat*)&warped, nullptr);
+    }
+    if (cv_calibration_frame_count(calib) < 3) {
+        cv_calibration_release(calib);
+        state.SkipWithError("not enough chessboard views detected");
+        return;
+    }
+    const std::string path = "/tmp/flutter_opencv_bench_calibration.yml";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cv_calibration_calibrate(calib));
+        cv_calibration_save(calib, path.c_str());
+        CvCalibration* loaded = cv_calibration_load(path.c_str());
+        benchmark::DoNotOptimize(loaded);
+        cv_calibration_release(loaded);
+    }
+    cv_calibration_release(calib);
+}
+BENCHMARK(BM_cv_calibration_calibrate)->Args({1280, 720, 1})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// 프레임마다 300 점 추적 (피라미드 재사용)
+static void BM_cv_flow_tracker(benchmark::State& state) {
+    bench::Input input(state);
+    cv::Mat frames[2];
+    frames[0] = input.image;
+    const cv::Mat shift = (cv::Mat_<double>(2, 3) << 1, 0, 2, 0, 1, 1);
+    cv::warpAffine(input.image, frames[1], shift, input.image.size(), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    CvFlowTracker* tracker = cv_flow_tracker_create(21, 3);
+    cv_flow_tracker_track(tracker, (CvMat*)&frames[0], nullptr, 0, nullptr, nullptr, nullptr);
+    std::vector<float> points(300 * 2), tracked(300 * 2), errors(300);
+    std::vector<uint8_t> status(300);
+    const int count = cv_flow_tracker_detect(tracker, 300, 0.01, 10, points.data());
+    int i = 1;
+    for (auto _ : state) {
+        const int ok = cv_flow_tracker_track(tracker, (CvMat*)&frames[i], points.data(), count, tracked.data(), status.data(), errors.data());
+        benchmark::DoNotOptimize(ok);
+        i ^= 1;
+    }
+    cv_flow_tracker_reset(tracker);
+    cv_flow_tracker_release(tracker);
+    bench::set_throughput(state, input.image);
+    state.counters["points"] = count;
+}
+BENCHMARK(BM_cv_flow_tracker)->Apply(bench::Gray);
+
+// 스트림 단계: 같은 해상도의 두 프레임을 번갈아 넣음
+struct FramePair {
+    cv::Mat frames[2];
+    int next = 0;
+
+    explicit FramePair(const benchmark::State& state) {
+        frames[0] = bench::make_scene((int)state.range(0), (int)state.range(1), (int)state.range(2), 1);
+        frames[1] = bench::make_scene((int)state.range(0), (int)state.range(1), (int)state.range(2), 2);
+    }
+
+    CvMat* take() {
+        CvMat* mat = (CvMat*)&frames[next];
+        next ^= 1;
+        return mat;
+    }
+};
+
+static void BM_cv_frame_stats(benchmark::State& state) {
+    FramePair frames(state);
+    CvFrameStatsCollector* collector = cv_frame_stats_create(4, 2, 253);
+    for (auto _ : state) {
+        cv_frame_stats_compute(collector, frames.take());
+        benchmark::DoNotOptimize(cv_frame_stats_get(collector));
+    }
+    cv_frame_stats_release(collector);
+    bench::set_throughput(state, frames.frames[0]);
+}
+BENCHMARK(BM_cv_frame_stats)->Apply(bench::AnyChannels);
+
+// range(3): 0=이동 평균, 1=MOG2, 2=KNN
+static void BM_cv_motion_detector(benchmark::State& state) {
+    FramePair frames(state);
+    CvMotionDetector* detector = cv_motion_detector_create((int)state.range(3), 320, 0.05, 25, 20);
+    std::vector<int> boxes(64 * 4);
+    for (auto _ : state) {
+        cv_motion_detector_process(detector, frames.take());
+        benchmark::DoNotOptimize(cv_motion_detector_activity(detector));
+        benchmark::DoNotOptimize(cv_motion_detector_boxes(detector, boxes.data(), 64));
+    }
+    CvMat* mask = cv_motion_detector_mask(detector);
+    cv_mat_release(mask);
+    cv_motion_detector_reset(detector);
+    cv_motion_detector_release(detector);
+    bench::set_throughput(state, frames.frames[0]);
+}
+BENCHMARK(BM_cv_motion_detector)
+    ->ArgNames({"w", "h", "ch", "method"})
+    ->ArgsProduct({{1280}, {720}, {3}, {0, 1, 2}})
+    ->Args({4000, 3000, 3, 0})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_cv_stabilizer(benchmark::State& state) {
+    FramePair frames(state);
+    CvStabilizer* stabilizer = cv_stabilizer_create(15, 1.04, 640);
+    cv::Mat out;
+    for (auto _ : state) {
+        const int emitted = cv_stabilizer_process(stabilizer, frames.take(), (CvMat*)&out);
+        benchmark::DoNotOptimize(emitted);
+    }
+    state.counters["latency_ms"] = cv_stabilizer_latency_ms(stabilizer);
+    state.counters["delay"] = cv_stabilizer_delay_frames(stabilizer);
+    cv_stabilizer_reset(stabilizer);
+    cv_stabilizer_release(stabilizer);
+    bench::set_throughput(state, frames.frames[0]);
+}
+BENCHMARK(BM_cv_stabilizer)->Apply(bench::Color);
+
+// range(3): 0=재귀 평균, 1=멀티 프레임 NL-Means (느려서 VGA/HD)
+static void BM_cv_temporal_denoiser(benchmark::State& state) {
+    FramePair frames(state);
+    CvTemporalDenoiser* denoiser = cv_temporal_denoiser_create((int)state.range(3), 3, 10, 0.25f, 24);
+    cv::Mat out;
+    for (auto _ : state) {
+        const int ok = cv_temporal_denoiser_process(denoiser, frames.take(), (CvMat*)&out);
+        benchmark::DoNotOptimize(ok);
+    }
+    cv_temporal_denoiser_reset(denoiser);
+    cv_temporal_denoiser_release(denoiser);
+    bench::set_throughput(state, frames.frames[0]);
+}
+BENCHMARK(BM_cv_temporal_denoiser)
+    ->ArgNames({"w", "h", "ch", "mode"})
+    ->Args({640, 480, 3, 0})
+    ->Args({1920, 1080, 3, 0})
+    ->Args({4000, 3000, 3, 0})
+    ->Args({640, 480, 3, 1})
+    ->Args({1280, 720, 3, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// 동영상 기록 -> 같은 파일을 디코드 스레드로 다시 읽기
+static std::string bench_video_path(int width, int height) {
+    return "/tmp/flutter_opencv_bench_" + std::to_string(width) + "x" + std::to_string(height) + ".avi";
+}
+
+static void BM_cv_videowriter(benchmark::State& state) {
+    FramePair frames(state);
+    const int width = (int)state.range(0), height = (int)state.range(1);
+    const std::string path = bench_video_path(width, height);
+    CvVideoWriter* writer = cv_videowriter_open(path.c_str(), "MJPG", 30, width, height, 1, 8, 0);
+    if (writer == nullptr) {
+        state.SkipWithError("MJPG writer not available");
+        return;
+    }
+    for (auto _ : state) {
+        cv::Mat frame = frames.frames[frames.next].clone(); // write 가 Mat 을 가져감
+        frames.next ^= 1;
+        benchmark::DoNotOptimize(cv_videowriter_write(writer, (CvMat*)&frame));
+    }
+    state.counters["pending"] = cv_videowriter_pending(writer);
+    cv_videowriter_close(writer);
+    state.counters["written"] = cv_videowriter_written(writer);
+    state.counters["dropped"] = cv_videowriter_dropped(writer);
+    cv_videowriter_release(writer);
+    bench::set_throughput(state, frames.frames[0]);
+}
+BENCHMARK(BM_cv_videowriter)->Args({1280, 720, 3})->Args({1920, 1080, 3})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// range(3): 디코드 큐 크기 (0=동기), range(4): stride, range(5): 1 이면 리맵/통계/움직임/안정화/노이즈 제거 단계 부착
+// (웹캠 cv_videocapture_create 는 장치에 따라 달라 측정하지 않음)
+static void BM_cv_videocapture_file(benchmark::State& state) {
+    const int width = (int)state.range(0), height = (int)state.range(1);
+    const std::string path = bench_video_path(width, height);
+    CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, (int)state.range(3), (int)state.range(4));
+    if (cap == nullptr) {
+        state.SkipWithError("run BM_cv_videowriter first to create the input file");
+        return;
+    }
+    const bool stages = state.range(5) != 0;
+    const double m[6] = {0.966, -0.259, 120.0, 0.259, 0.966, -80.0};
+    CvRemapCache* remap = stages ? cv_remap_cache_create_affine(m, width, height, cv::INTER_LINEAR, cv::BORDER_CONSTANT) : nullptr;
+    CvFrameStatsCollector* collector = stages ? cv_frame_stats_create(4, 2, 253) : nullptr;
+    CvMotionDetector* detector = stages ? cv_motion_detector_create(0, 320, 0.05, 25, 20) : nullptr;
+    CvStabilizer* stabilizer = stages ? cv_stabilizer_create(15, 1.04, 640) : nullptr;
+    CvTemporalDenoiser* denoiser = stages ? cv_temporal_denoiser_create(0, 3, 10, 0.25f, 24) : nullptr;
+    cv_videocapture_set_remap(cap, remap);
+    cv_videocapture_set_frame_stats(cap, collector);
+    cv_videocapture_set_motion_detector(cap, detector);
+    cv_videocapture_set_stabilizer(cap, stabilizer);
+    cv_videocapture_set_denoiser(cap, denoiser);
+    const int frameCount = (int)cv_videocapture_get(cap, cv::CAP_PROP_FRAME_COUNT);
+    cv::Mat frame;
+    for (auto _ : state) {
+        if (!cv_videocapture_read(cap, (CvMat*)&frame)) {
+            state.PauseTiming();
+            cv_videocapture_seek(cap, 0);
+            state.ResumeTiming();
+        }
+        benchmark::DoNotOptimize(cv_videocapture_position(cap));
+    }
+    struct CvLatencyStats latency;
+    if (cv_videocapture_latency(cap, CV_LATENCY_QUEUE, &latency)) {
+        state.counters["queue_p95_ms"] = latency.p95Ms;
+    }
+    struct CvFrameTiming timing;
+    cv_videocapture_timing(cap, &timing);
+    cv_videocapture_mark_done(cap);
+    cv_videocapture_latency_reset(cap);
+    cv_videocapture_set(cap, cv::CAP_PROP_POS_MSEC, 0);
+    state.counters["frames"] = frameCount;
+    cv_videocapture_release(cap);
+    if (stages) {
+        cv_temporal_denoiser_release(denoiser);
+        cv_stabilizer_release(stabilizer);
+        cv_motion_detector_release(detector);
+        cv_frame_stats_release(collector);
+        cv_remap_cache_release(remap);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_cv_videocapture_file)
+    ->ArgNames({"w", "h", "ch", "queue", "stride", "stages"})
+    ->Args({1280, 720, 3, 0, 1, 0})
+    ->Args({1280, 720, 3, 8, 1, 0})
+    ->Args({1280, 720, 3, 8, 4, 0})
+    ->Args({1280, 720, 3, 8, 1, 1})
+    ->Args({1920, 1080, 3, 8, 1, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// 계측 오버헤드: 꺼짐 / 호출 통계 / trace. 빈 Mat 생성/해제 (계측 스코프 2 개) 로 고정 비용만 측정
+// leaf 접근자 (cv_mat_width 등) 는 계측하지 않으므로 사용하지 않음
+static void BM_instrumentation_overhead(benchmark::State& state) {
+    const int mode = (int)state.range(0);
+    cv_stats_enable(mode == 1);
+    cv_trace_enable(mode == 2);
+    cv_trace_set_thread_name("bench");
+    for (auto _ : state) {
+        CvMat* mat = cv_mat_create();
+        benchmark::DoNotOptimize(mat);
+        cv_mat_release(mat);
+    }
+    cv_stats_enable(0);
+    cv_trace_enable(0);
+    state.counters["stats_enabled"] = cv_stats_enabled();
+    state.counters["trace_enabled"] = cv_trace_enabled();
+    std::vector<struct CvCallStats> stats(cv_stats_snapshot(nullptr, 0));
+    cv_stats_snapshot(stats.data(), (int)stats.size());
+    cv_free_bytes(cv_stats_json());
+    cv_free_bytes(cv_trace_export());
+    cv_stats_reset();
+    cv_trace_reset();
+    benchmark::DoNotOptimize(cv_monotonic_ns());
+}
+BENCHMARK(BM_instrumentation_overhead)->ArgNames({"mode"})->DenseRange(0, 2);
@@ -0,0 +1,159 @@
+// 예제 앱 파이프라인 (image_processing_service.dart 와 같은 호출 순서)
+#include "bench_util.h"
+
+#include <vector>
+
+namespace {
+
+// processDocumentScanner: 검출 -> 보정 -> 워프 -> 그레이 -> Sauvola 2 스케일
+CvMat* document_scanner(CvMat* src) {
+    float quad[8];
+    CvMat* page = nullptr;
+    if (cv_document_detect(src, 640, quad) >= 0.5) {
+        cv_document_refine(src, quad, 12);
+        page = cv_document_warp(src, quad, 0, 0);
+    }
+    CvMat* gray = cv_cvtColor_bgr2gray(page != nullptr ? page : src);
+    if (page != nullptr) cv_mat_release(page);
+    CvMat* result = cv_binarize_document(gray, 0, 25, 0.2, 128, 2);
+    cv_mat_release(gray);
+    return result;
+}
+
+// processPhotoEnhancement: 컬러 NL-Means -> 샤프닝
+CvMat* photo_enhancement(CvMat* src) {
+    CvMat* denoised = cv_fast_nl_means_denoising_colored(src, 10, 10, 7, 21);
+    CvMat* sharpened = cv_sharpen(denoised);
+    cv_mat_release(denoised);
+    return sharpened;
+}
+
+// 이전 processDocumentScanner 이진화: 블러 -> 가우시안 적응형 임계값 (블록 11) -> 3x3 열림
+CvMat* legacy_binarize(CvMat* src) {
+    CvMat* blurred = cv_gaussian_blur(src, 5, 0);
+    CvMat* binary = cv_adaptive_threshold(blurred, 255, cv::ADAPTIVE_THRESH_GAUSSIAN_C, cv::THRESH_BINARY, 11, 2);
+    cv_mat_release(blurred);
+    CvMat* opened = cv_morphology_ex(binary, cv::MORPH_OPEN, 3);
+    cv_mat_release(binary);
+    return opened;
+}
+
+CvMat* sauvola_binarize(CvMat* src) { return cv_binarize_document(src, 0, 25, 0.2, 128, 1); }
+CvMat* sauvola_binarize_ms2(CvMat* src) { return cv_binarize_document(src, 0, 25, 0.2, 128, 2); }
+CvMat* wolf_binarize(CvMat* src) { return cv_binarize_document(src, 1, 25, 0.5, 128, 1); }
+
+// processColorDetection: HSV 변환
+CvMat* color_detection(CvMat* src) { return cv_cvtColor_bgr2hsv(src); }
+
+typedef CvMat* (*Pipeline)(CvMat*);
+
+void run_pipeline(benchmark::State& state, const cv::Mat& image, Pipeline pipeline) {
+    for (auto _ : state) {
+        CvMat* out = pipeline((CvMat*)&image);
+        if (out == nullptr) {
+            state.SkipWithError("pipeline returned nullptr");
+            break;
+        }
+        benchmark::DoNotOptimize(out);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, image);
+}
+
+// 앱의 실제 왕복: JPEG 디코드 -> 파이프라인 -> JPEG 인코드
+void run_round_trip(benchmark::State& state, const cv::Mat& image, Pipeline pipeline) {
+    std::vector<uint8_t> jpeg;
+    cv::imencode(".jpg", image, jpeg);
+    for (auto _ : state) {
+        CvMat* decoded = cv_imdecode(jpeg.data(), (int)jpeg.size());
+        CvMat* out = pipeline(decoded);
+        cv_mat_release(decoded);
+        if (out == nullptr) {
+            state.SkipWithError("pipeline returned nullptr");
+            break;
+        }
+        struct BytesResult bytes = cv_imencode(".jpg", out);
+        benchmark::DoNotOptimize(bytes.data);
+        cv_free_bytes(bytes);
+        cv_mat_release(out);
+    }
+    bench::set_throughput(state, image);
+}
+
+// 그림자 문서 이진화: 처리량과 정답 글자 마스크 대비 픽셀 오류율 (error_pct, 낮을수록 좋음)
+void run_binarize_quality(benchmark::State& state, Pipeline pipeline) {
+    cv::Mat mask;
+    const cv::Mat page = bench::make_shadowed_page((int)state.range(0), (int)state.range(1), &mask);
+    run_pipeline(state, page, pipeline);
+    CvMat* out = pipeline((CvMat*)&page);
+    if (out != nullptr) {
+        state.counters["error_pct"] = 100.0 * bench::binarization_error(*(cv::Mat*)out, mask);
+        cv_mat_release(out);
+    }
+}
+
+} // namespace
+
+static void BM_pipeline_document_scanner(benchmark::State& state) {
+    run_pipeline(state, bench::make_document((int)state.range(0), (int)state.range(1)), document_scanner);
+}
+BENCHMARK(BM_pipeline_document_scanner)->Apply(bench::Color);
+
+static void BM_pipeline_document_scanner_round_trip(benchmark::State& state) {
+    run_round_trip(state, bench::make_document((int)state.range(0), (int)state.range(1)), document_scanner);
+}
+BENCHMARK(BM_pipeline_document_scanner_round_trip)->Apply(bench::Color);
+
+static void BM_pipeline_photo_enhancement(benchmark::State& state) {
+    bench::Input input(state);
+    run_pipeline(state, input.image, photo_enhancement);
+}
+BENCHMARK(BM_pipeline_photo_enhancement)->Apply(bench::ColorSmall);
+
+static void BM_pipeline_color_detection(benchmark::State& state) {
+    bench::Input input(state);
+    run_pipeline(state, input.image, color_detection);
+}
+BENCHMARK(BM_pipeline_color_detection)->Apply(bench::Color);
+
+static void BM_pipeline_color_detection_round_trip(benchmark::State& state) {
+    bench::Input input(state);
+    run_round_trip(state, input.image, color_detection);
+}
+BENCHMARK(BM_pipeline_color_detection_round_trip)->Apply(bench::Color);
+
+static void BM_binarize_shadowed_page_legacy(benchmark::State& state) { run_binarize_quality(state, legacy_binarize); }
+BENCHMARK(BM_binarize_shadowed_page_legacy)->Apply(bench::Gray);
+
+static void BM_binarize_shadowed_page_sauvola(benchmark::State& state) { run_binarize_quality(state, sauvola_binarize); }
+BENCHMARK(BM_binarize_shadowed_page_sauvola)->Apply(bench::Gray);
+
+static void BM_binarize_shadowed_page_sauvola_ms2(benchmark::State& state) { run_binarize_quality(state, sauvola_binarize_ms2); }
+BENCHMARK(BM_binarize_shadowed_page_sauvola_ms2)->Apply(bench::Gray);
+
+static void BM_binarize_shadowed_page_wolf(benchmark::State& state) { run_binarize_quality(state, wolf_binarize); }
+BENCHMARK(BM_binarize_shadowed_page_wolf)->Apply(bench::Gray);
+
+// 카메라 프레임 분석: 통계 + 움직임 감지 (camera_service 의 프레임당 작업)
+static void BM_pipeline_capture_analysis(benchmark::State& state) {
+    const cv::Mat frames[2] = {
+        bench::make_scene((int)state.range(0), (int)state.range(1), 3, 1),
+        bench::make_scene((int)state.range(0), (int)state.range(1), 3, 2),
+    };
+    CvFrameStatsCollector* collector = cv_frame_stats_create(4, 2, 253);
+    CvMotionDetector* detector = cv_motion_detector_create(0, 320, 0.05, 25, 20);
+    int i = 0;
+    for (auto _ : state) {
+        CvMat* frame = (CvMat*)&frames[i];
+        cv_frame_stats_compute(collector, frame);
+        cv_motion_detector_process(detector, frame);
+        benchmark::DoNotOptimize(cv_motion_detector_activity(detector));
+        i ^= 1;
+    }
+    cv_motion_detector_release(detector);
+    cv_frame_stats_release(collector);
+    bench::set_throughput(state, frames[0]);
+}
+BENCHMARK(BM_pipeline_capture_analysis)->Apply(bench::Color);
+
+BENCHMARK_MAIN();
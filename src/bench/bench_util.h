@@ -0,0 +1,87 @@
+// flutter_opencv_bench 공용 입력 생성 / 인자 행렬
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <opencv2/opencv.hpp>
+
+#include "flutter_opencv.h"
+#include "testing/scenes.h"
+
+namespace bench {
+
+// 해상도 행렬 (VGA -> 12MP)
+struct Resolution {
+    int width;
+    int height;
+};
+
+constexpr Resolution kResolutions[] = {
+    {640, 480},   // VGA
+    {1280, 720},  // HD
+    {1920, 1080}, // FHD
+    {3840, 2160}, // 4K
+    {4000, 3000}, // 12MP
+};
+constexpr int kResolutionCount = sizeof(kResolutions) / sizeof(kResolutions[0]);
+// 무거운 함수는 FHD 까지만 측정
+constexpr int kSmallResolutionCount = 3;
+
+// 인자: {width, height, channels}
+inline void add_matrix(benchmark::internal::Benchmark* b, std::initializer_list<int> channels, int resolutions) {
+    b->ArgNames({"w", "h", "ch"});
+    for (int i = 0; i < resolutions; i++) {
+        for (int c : channels) b->Args({kResolutions[i].width, kResolutions[i].height, c});
+    }
+    b->Unit(benchmark::kMillisecond);
+    b->UseRealTime(); // 내부 parallel_for_ 가 있어 벽시계 기준
+}
+
+inline void Gray(benchmark::internal::Benchmark* b) { add_matrix(b, {1}, kResolutionCount); }
+inline void Color(benchmark::internal::Benchmark* b) { add_matrix(b, {3}, kResolutionCount); }
+inline void AnyChannels(benchmark::internal::Benchmark* b) { add_matrix(b, {1, 3, 4}, kResolutionCount); }
+inline void GraySmall(benchmark::internal::Benchmark* b) { add_matrix(b, {1}, kSmallResolutionCount); }
+inline void ColorSmall(benchmark::internal::Benchmark* b) { add_matrix(b, {3}, kSmallResolutionCount); }
+
+// 합성 입력은 테스트와 공유 (testing/scenes.h)
+using scenes::make_document;
+using scenes::make_scene;
+using scenes::make_shadowed_page;
+using scenes::binarization_error;
+
+// state 인자로 만든 입력 Mat (C ABI 로 넘기기 위한 래퍼)
+struct Input {
+    cv::Mat image;
+    CvMat* mat;
+
+    explicit Input(const benchmark::State& state)
+        : image(make_scene((int)state.range(0), (int)state.range(1), (int)state.range(2))), mat((CvMat*)&image) {}
+    Input(const Input&) = delete;
+    Input& operator=(const Input&) = delete;
+};
+
+// 픽셀/바이트 처리량 카운터
+inline void set_throughput(benchmark::State& state, const cv::Mat& image) {
+    state.SetItemsProcessed((int64_t)state.iterations() * image.cols * image.rows);
+    state.SetBytesProcessed((int64_t)state.iterations() * (int64_t)(image.total() * image.elemSize()));
+    state.counters["MP"] = image.cols * image.rows / 1e6;
+}
+
+// CvMat* 를 반환하는 함수 측정 (결과는 매 반복 해제)
+#define BENCH_MAT(name, matrix, expr)                                   \
+    static void BM_##name(benchmark::State& state) {                    \
+        bench::Input input(state);                                      \
+        CvMat* src = input.mat;                                         \
+        for (auto _ : state) {                                          \
+            CvMat* out = (expr);                                        \
+            if (out == nullptr) {                                       \
+                state.SkipWithError(#name " returned nullptr");         \
+                break;                                                  \
+            }                                                           \
+            benchmark::DoNotOptimize(out);                              \
+            cv_mat_release(out);                                        \
+        }                                                               \
+        bench::set_throughput(state, input.image);                      \
+    }                                                                   \
+    BENCHMARK(BM_##name)->Apply(bench::matrix)
+
+} // namespace bench
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""flutter_opencv_bench JSON 결과 두 개를 비교해 회귀를 찾는다.
+
+사용법:
+    python3 compare.py baseline.json current.json [--threshold 0.10] [--filter REGEX]
+
+--benchmark_repetitions 로 실행한 결과는 median 집계를, 아니면 각 실행의
+real_time 을 사용한다. current 가 baseline 보다 threshold 이상 느린 항목이
+하나라도 있으면 종료 코드 1 을 반환한다 (CI 게이트용).
+"""
+
+import argparse
+import json
+import re
+import sys
+
+_UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    """벤치마크 이름 -> real_time(ns). median 집계가 있으면 그 값을 우선한다."""
+    with open(path) as f:
+        data = json.load(f)
+    iterations = {}
+    medians = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("error_occurred"):
+            continue
+        name = bench.get("run_name", bench["name"])
+        time_ns = bench["real_time"] * _UNIT_TO_NS[bench.get("time_unit", "ns")]
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[name] = time_ns
+        else:
+            # 반복 실행 시 같은 이름이 여러 번 나오므로 최솟값 유지
+            iterations[name] = min(time_ns, iterations.get(name, time_ns))
+    iterations.update(medians)
+    return iterations, data.get("context", {})
+
+
+def format_time(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.2f %s" % (ns / scale, unit)
+    return "%.0f ns" % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10, help="회귀로 판단할 상대 증가율 (기본 0.10 = 10%%)")
+    parser.add_argument("--filter", default=None, help="이름이 일치하는 벤치마크만 비교 (정규식)")
+    parser.add_argument("--all", action="store_true", help="변화가 threshold 이내인 항목도 출력")
+    args = parser.parse_args()
+
+    baseline, baseline_context = load(args.baseline)
+    current, current_context = load(args.current)
+    pattern = re.compile(args.filter) if args.filter else None
+
+    if baseline_context.get("num_cpus") != current_context.get("num_cpus"):
+        print("warning: CPU 수가 다름 (%s -> %s), 결과를 직접 비교하기 어려움"
+              % (baseline_context.get("num_cpus"), current_context.get("num_cpus")), file=sys.stderr)
+    if current_context.get("library_build_type") == "debug":
+        print("warning: current 가 디버그 빌드의 Google Benchmark 로 측정됨", file=sys.stderr)
+
+    names = sorted(n for n in baseline.keys() & current.keys() if pattern is None or pattern.search(n))
+    regressions = []
+    improvements = []
+    rows = []
+    for name in names:
+        before, after = baseline[name], current[name]
+        change = (after - before) / before if before > 0 else 0.0
+        if change > args.threshold:
+            regressions.append(name)
+            status = "REGRESSION"
+        elif change < -args.threshold:
+            improvements.append(name)
+            status = "faster"
+        else:
+            status = ""
+        if status or args.all:
+            rows.append((name, format_time(before), format_time(after), "%+.1f%%" % (change * 100), status))
+
+    if rows:
+        widths = [max(len(row[i]) for row in rows + [("benchmark", "baseline", "current", "change", "")]) for i in range(5)]
+        header = ("benchmark", "baseline", "current", "change", "")
+        for row in [header] + rows:
+            print("  ".join(cell.ljust(widths[i]) if i == 0 else cell.rjust(widths[i]) for i, cell in enumerate(row)).rstrip())
+
+    only_baseline = sorted(baseline.keys() - current.keys())
+    only_current = sorted(current.keys() - baseline.keys())
+    if only_baseline:
+        print("\nbaseline 에만 있음: %d 개" % len(only_baseline))
+    if only_current:
+        print("current 에만 있음: %d 개" % len(only_current))
+
+    print("\n%d 개 비교, 회귀 %d 개, 개선 %d 개 (threshold %.0f%%)"
+          % (len(names), len(regressions), len(improvements), args.threshold * 100))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
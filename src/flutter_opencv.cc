@@ -1,6 +1,323 @@
 #include "flutter_opencv.h"
 #include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+// 단조 증가 시계 (ns). 프레임 시각과 Dart 쪽 측정이 같은 기준을 쓰도록 export 함
+int64_t monotonic_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+// 호출 통계와 trace span (cv_stats_enable / cv_trace_enable 로 켰을 때만 기록).
+// FLUTTER_OPENCV_NO_PROFILING 으로 빌드하면 계측 코드 자체가 빠짐
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+namespace {
+
+// 스레드별 함수 통계 표 크기 (내보낸 함수 수보다 충분히 큰 2 의 거듭제곱)
+constexpr int kProfileSlots = 512;
+
+// 각 스레드는 자기 표에만 쓰고 스냅샷은 읽기만 하므로 relaxed 원자 연산으로 충분
+struct ProfileSlot {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<int64_t> calls{0};
+    std::atomic<int64_t> totalNs{0};
+    std::atomic<int64_t> minNs{0};
+    std::atomic<int64_t> maxNs{0};
+    std::atomic<int64_t> bytes{0};
+    std::atomic<int64_t> pixels{0};
+    std::atomic<int32_t> lastWidth{0};
+    std::atomic<int32_t> lastHeight{0};
+};
+
+struct ThreadProfile {
+    ProfileSlot slots[kProfileSlots];
+};
+
+// 켜진 계측 종류 (비트 조합)
+constexpr int kInstrumentStats = 1;
+constexpr int kInstrumentTrace = 2;
+std::atomic<int> g_instrument{0};
+std::mutex g_profileLock; // 스레드 표/링 등록/해제와 스냅샷만 보호
+std::vector<ThreadProfile*> g_profiles;
+ThreadProfile g_retiredProfile; // 종료된 스레드의 누적값
+
+// 함수 이름은 __func__ 포인터로 구분 (같은 함수면 같은 주소)
+ProfileSlot* profile_slot(ThreadProfile* p, const char* name) {
+    size_t i = ((uintptr_t)name >> 3) & (kProfileSlots - 1);
+    for (int probe = 0; probe < kProfileSlots; probe++, i = (i + 1) & (kProfileSlots - 1)) {
+        const char* current = p->slots[i].name.load(std::memory_order_relaxed);
+        if (current == name) return &p->slots[i];
+        if (current == nullptr) {
+            p->slots[i].name.store(name, std::memory_order_release);
+            return &p->slots[i];
+        }
+    }
+    return nullptr;
+}
+
+void profile_add(ProfileSlot* slot, int64_t calls, int64_t totalNs, int64_t minNs, int64_t maxNs, int64_t bytes, int64_t pixels, int32_t width, int32_t height) {
+    const std::memory_order relaxed = std::memory_order_relaxed;
+    slot->calls.store(slot->calls.load(relaxed) + calls, relaxed);
+    slot->totalNs.store(slot->totalNs.load(relaxed) + totalNs, relaxed);
+    const int64_t currentMin = slot->minNs.load(relaxed);
+    if (currentMin == 0 || (minNs > 0 && minNs < currentMin)) slot->minNs.store(minNs, relaxed);
+    if (maxNs > slot->maxNs.load(relaxed)) slot->maxNs.store(maxNs, relaxed);
+    slot->bytes.store(slot->bytes.load(relaxed) + bytes, relaxed);
+    slot->pixels.store(slot->pixels.load(relaxed) + pixels, relaxed);
+    if (width > 0) {
+        slot->lastWidth.store(width, relaxed);
+        slot->lastHeight.store(height, relaxed);
+    }
+}
+
+// 종료되는 스레드의 값을 g_retiredProfile 로 합침
+void profile_retire(ThreadProfile* p) {
+    std::lock_guard<std::mutex> lock(g_profileLock);
+    for (ProfileSlot& slot : p->slots) {
+        const char* name = slot.name.load(std::memory_order_relaxed);
+        if (name == nullptr) continue;
+        ProfileSlot* dst = profile_slot(&g_retiredProfile, name);
+        if (dst == nullptr) continue;
+        profile_add(dst, slot.calls.load(), slot.totalNs.load(), slot.minNs.load(), slot.maxNs.load(), slot.bytes.load(), slot.pixels.load(), slot.lastWidth.load(), slot.lastHeight.load());
+    }
+    g_profiles.erase(std::remove(g_profiles.begin(), g_profiles.end(), p), g_profiles.end());
+    delete p;
+}
+
+struct ThreadProfileHandle {
+    ThreadProfile* profile = nullptr;
+    ~ThreadProfileHandle() {
+        if (profile != nullptr) profile_retire(profile);
+    }
+};
+
+ThreadProfile* thread_profile() {
+    thread_local ThreadProfileHandle handle;
+    if (handle.profile == nullptr) {
+        handle.profile = new ThreadProfile();
+        std::lock_guard<std::mutex> lock(g_profileLock);
+        g_profiles.push_back(handle.profile);
+    }
+    return handle.profile;
+}
+
+// 현재 스레드에서 Mat 이 할당한 바이트 (계측 중에만 증가)
+thread_local int64_t t_allocatedBytes = 0;
+
+// 기본 할당기를 감싸 할당량만 세는 할당기. 해제는 기본 할당기가 직접 처리
+#if CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 2)
+typedef cv::AccessFlag ProfileAccessFlag;
+#else
+typedef int ProfileAccessFlag;
+#endif
+
+class CountingMatAllocator : public cv::MatAllocator {
+public:
+    explicit CountingMatAllocator(cv::MatAllocator* base) : base_(base) {}
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step, ProfileAccessFlag flags, cv::UMatUsageFlags usageFlags) const override {
+        cv::UMatData* u = base_->allocate(dims, sizes, type, data, step, flags, usageFlags);
+        if (u != nullptr && data == nullptr) t_allocatedBytes += (int64_t)u->size;
+        return u;
+    }
+
+    bool allocate(cv::UMatData* data, ProfileAccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const override {
+        return base_->allocate(data, accessFlags, usageFlags);
+    }
+
+    void deallocate(cv::UMatData* data) const override {
+        base_->deallocate(data);
+    }
+
+private:
+    cv::MatAllocator* base_;
+};
+
+// 스레드별 trace span 링 버퍼. 가득 차면 가장 오래된 span 부터 덮어씀
+constexpr uint64_t kTraceRingSize = 4096;
+// 종료된 스레드의 링은 내보내기를 위해 이 개수까지 보관
+constexpr size_t kMaxFinishedTraceRings = 16;
+
+struct TraceEvent {
+    const char* name; // __func__ 나 문자열 리터럴 (정적 수명)
+    int64_t startNs;
+    int64_t durationNs;
+};
+
+struct TraceRing {
+    TraceEvent events[kTraceRingSize];
+    std::atomic<uint64_t> head{0}; // 지금까지 기록한 span 수
+    std::atomic<uint64_t> resetAt{0}; // cv_trace_reset 시점의 head (이전 span 은 내보내지 않음)
+    int tid = 0;
+    char threadName[32] = {};
+    bool finished = false; // g_profileLock 보호
+};
+
+std::vector<TraceRing*> g_traceRings;
+int g_nextTraceTid = 1;
+thread_local char t_threadName[32] = {};
+
+// 스레드가 끝나면 링을 종료 표시하고, 오래된 종료 링은 정리
+struct TraceRingHandle {
+    TraceRing* ring = nullptr;
+    ~TraceRingHandle() {
+        if (ring == nullptr) return;
+        std::lock_guard<std::mutex> lock(g_profileLock);
+        ring->finished = true;
+        size_t finished = 0;
+        for (const TraceRing* r : g_traceRings) finished += r->finished ? 1 : 0;
+        for (auto it = g_traceRings.begin(); it != g_traceRings.end() && finished > kMaxFinishedTraceRings;) {
+            if ((*it)->finished) {
+                delete *it;
+                it = g_traceRings.erase(it);
+                finished--;
+            } else {
+                ++it;
+            }
+        }
+    }
+};
+
+thread_local TraceRingHandle t_traceRing;
+
+TraceRing* thread_trace_ring() {
+    if (t_traceRing.ring == nullptr) {
+        TraceRing* ring = new TraceRing();
+        std::lock_guard<std::mutex> lock(g_profileLock);
+        ring->tid = g_nextTraceTid++;
+        if (t_threadName[0] != 0) {
+            memcpy(ring->threadName, t_threadName, sizeof(ring->threadName));
+        } else {
+            snprintf(ring->threadName, sizeof(ring->threadName), "thread %d", ring->tid);
+        }
+        g_traceRings.push_back(ring);
+        t_traceRing.ring = ring;
+    }
+    return t_traceRing.ring;
+}
+
+// 소유 스레드만 쓰므로 칸을 채운 뒤 head 를 release 로 올리면 됨
+void trace_record(const char* name, int64_t startNs, int64_t endNs) {
+    TraceRing* ring = thread_trace_ring();
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    ring->events[head % kTraceRingSize] = TraceEvent{name, startNs, endNs - startNs};
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void trace_set_thread_name(const char* name) {
+    strncpy(t_threadName, name, sizeof(t_threadName) - 1);
+    // 길이 제한으로 잘린 UTF-8 멀티바이트 문자는 통째로 버림 (내보낸 JSON 이 UTF-8 로 디코드되도록)
+    size_t len = strlen(t_threadName);
+    size_t lead = len;
+    while (lead > 0 && ((unsigned char)t_threadName[lead - 1] & 0xC0) == 0x80) lead--;
+    if (lead > 0 && (unsigned char)t_threadName[lead - 1] >= 0xC0) {
+        const unsigned char c = (unsigned char)t_threadName[lead - 1];
+        const size_t expected = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+        if (len - (lead - 1) < expected) t_threadName[lead - 1] = 0;
+    }
+    if (t_traceRing.ring != nullptr) {
+        std::lock_guard<std::mutex> lock(g_profileLock);
+        memcpy(t_traceRing.ring->threadName, t_threadName, sizeof(t_threadName));
+    }
+}
+
+// 파이프라인 단계용 span (호출 통계 없이 trace 만 기록)
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) {
+        if ((g_instrument.load(std::memory_order_relaxed) & kInstrumentTrace) == 0) return;
+        name_ = name;
+        start_ = monotonic_ns();
+    }
+
+    ~TraceScope() {
+        if (name_ != nullptr) trace_record(name_, start_, monotonic_ns());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_ = nullptr;
+    int64_t start_ = 0;
+};
+
+// 함수 하나의 호출을 측정. 꺼져 있으면 원자 변수 한 번 읽고 끝남
+class ProfileScope {
+public:
+    ProfileScope(const char* name, const void* mat) {
+        flags_ = g_instrument.load(std::memory_order_relaxed);
+        if (flags_ == 0) return;
+        name_ = name;
+        if (mat != nullptr) {
+            const cv::Mat* m = (const cv::Mat*)mat;
+            width_ = m->cols;
+            height_ = m->rows;
+        }
+        allocStart_ = t_allocatedBytes;
+        start_ = monotonic_ns();
+    }
+
+    ~ProfileScope() {
+        if (name_ == nullptr) return;
+        const int64_t end = monotonic_ns();
+        if (flags_ & kInstrumentTrace) {
+            trace_record(name_, start_, end);
+        }
+        if ((flags_ & kInstrumentStats) == 0) return;
+        const int64_t elapsed = std::max<int64_t>(1, end - start_);
+        ProfileSlot* slot = profile_slot(thread_profile(), name_);
+        if (slot == nullptr) return;
+        profile_add(slot, 1, elapsed, elapsed, elapsed, t_allocatedBytes - allocStart_, (int64_t)width_ * height_, width_, height_);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_ = nullptr;
+    int flags_ = 0;
+    int64_t start_ = 0;
+    int64_t allocStart_ = 0;
+    int32_t width_ = 0;
+    int32_t height_ = 0;
+};
+
+} // namespace
+
+#define CV_PROFILE() ProfileScope cvProfileScope_(__func__, nullptr)
+#define CV_PROFILE_MAT(mat) ProfileScope cvProfileScope_(__func__, (mat))
+#define CV_TRACE_CONCAT_(a, b) a##b
+#define CV_TRACE_CONCAT(a, b) CV_TRACE_CONCAT_(a, b)
+#define CV_TRACE_SPAN(name) TraceScope CV_TRACE_CONCAT(cvTraceScope_, __LINE__)(name)
+#define CV_TRACE_THREAD_NAME(name) trace_set_thread_name(name)
+#else
+#define CV_PROFILE() ((void)0)
+#define CV_PROFILE_MAT(mat) ((void)0)
+#define CV_TRACE_SPAN(name) ((void)0)
+#define CV_TRACE_THREAD_NAME(name) ((void)0)
+#endif
 
 // A very short-lived native function.
 FFI_PLUGIN_EXPORT const char* opencv_version() {
@@ -8,16 +325,19 @@ FFI_PLUGIN_EXPORT const char* opencv_version() {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_mat_create() {
+    CV_PROFILE();
     return (CvMat*)new cv::Mat();
 }
 
 FFI_PLUGIN_EXPORT void cv_mat_release(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat != nullptr) {
         delete (cv::Mat*)mat;
     }
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_imread(const char* filename) {
+    CV_PROFILE();
     cv::Mat image = cv::imread(filename);
     if (image.empty()) {
         return nullptr;
@@ -26,11 +346,13 @@ FFI_PLUGIN_EXPORT CvMat* cv_imread(const char* filename) {
 }
 
 FFI_PLUGIN_EXPORT int cv_imwrite(const char* filename, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return 0;
     return cv::imwrite(filename, *(cv::Mat*)mat) ? 1 : 0;
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_imdecode(const uint8_t* data, int len) {
+    CV_PROFILE();
     std::vector<uint8_t> buffer(data, data + len);
     cv::Mat image = cv::imdecode(buffer, cv::IMREAD_COLOR);
     if (image.empty()) {
@@ -40,6 +362,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_imdecode(const uint8_t* data, int len) {
 }
 
 FFI_PLUGIN_EXPORT struct BytesResult cv_imencode(const char* ext, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     struct BytesResult result = {nullptr, 0};
     if (mat == nullptr) return result;
 
@@ -53,12 +376,14 @@ FFI_PLUGIN_EXPORT struct BytesResult cv_imencode(const char* ext, CvMat* mat) {
 }
 
 FFI_PLUGIN_EXPORT void cv_free_bytes(struct BytesResult bytes) {
+    CV_PROFILE();
     if (bytes.data != nullptr) {
         free(bytes.data);
     }
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2gray(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat gray;
     cv::cvtColor(*(cv::Mat*)mat, gray, cv::COLOR_BGR2GRAY);
@@ -66,6 +391,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2gray(CvMat* mat) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2rgb(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat rgb;
     cv::cvtColor(*(cv::Mat*)mat, rgb, cv::COLOR_BGR2RGB);
@@ -73,6 +399,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2rgb(CvMat* mat) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2hsv(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat hsv;
     cv::cvtColor(*(cv::Mat*)mat, hsv, cv::COLOR_BGR2HSV);
@@ -80,6 +407,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2hsv(CvMat* mat) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_hsv2bgr(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat bgr;
     cv::cvtColor(*(cv::Mat*)mat, bgr, cv::COLOR_HSV2BGR);
@@ -87,6 +415,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_hsv2bgr(CvMat* mat) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2lab(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat lab;
     cv::cvtColor(*(cv::Mat*)mat, lab, cv::COLOR_BGR2Lab);
@@ -94,20 +423,87 @@ FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2lab(CvMat* mat) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_lab2bgr(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat bgr;
     cv::cvtColor(*(cv::Mat*)mat, bgr, cv::COLOR_Lab2BGR);
     return (CvMat*)new cv::Mat(bgr);
 }
 
+// 리사이즈
+namespace {
+
+// 정수 배율 박스 축소 (8비트). 출력 픽셀은 fx x fy 블록의 평균이며, 나누어떨어지지 않는 가장자리는 버림
+// 세로 누적은 연속 메모리에서 벡터화되도록 행 단위로 수행
+template <typename Acc>
+void box_reduce_8u(const cv::Mat& src, cv::Mat& dst, int fx, int fy) {
+    const int cn = src.channels();
+    dst.create(src.rows / fy, src.cols / fx, src.type());
+    const int used = dst.cols * fx * cn;
+    const uint64_t mul = ((1u << 24) + (fx * fy) / 2) / (uint64_t)(fx * fy);
+    cv::parallel_for_(cv::Range(0, dst.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("box_reduce_8u chunk");
+        std::vector<Acc> acc(used);
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* s = src.ptr<uchar>(y * fy);
+            for (int i = 0; i < used; i++) acc[i] = s[i];
+            for (int k = 1; k < fy; k++) {
+                s = src.ptr<uchar>(y * fy + k);
+                for (int i = 0; i < used; i++) acc[i] += s[i];
+            }
+            uchar* d = dst.ptr<uchar>(y);
+            for (int x = 0; x < dst.cols; x++) {
+                const Acc* a = &acc[(size_t)x * fx * cn];
+                for (int c = 0; c < cn; c++) {
+                    unsigned sum = 0;
+                    for (int k = 0; k < fx; k++) sum += a[k * cn + c];
+                    d[x * cn + c] = (uchar)((sum * mul + (1u << 23)) >> 24);
+                }
+            }
+        }
+    }, dst.rows / 16.0);
+}
+
+// interpolation -1 이면 배율에 따라 선택 (축소: AREA, 확대: LINEAR)
+// 8비트 AREA 축소에서 배율이 2 이상이면 정수 배율 박스 축소 후 남은 소수 배율만 AREA 로 처리
+void resize_image(const cv::Mat& src, cv::Mat& dst, cv::Size size, int interpolation) {
+    const bool downscale = size.width > 0 && size.height > 0 && size.width <= src.cols && size.height <= src.rows && size != src.size();
+    if (interpolation < 0) {
+        interpolation = downscale ? cv::INTER_AREA : cv::INTER_LINEAR;
+    }
+    if (downscale && interpolation == cv::INTER_AREA && src.depth() == CV_8U) {
+        const int fx = src.cols / size.width;
+        const int fy = src.rows / size.height;
+        if (fx >= 2 || fy >= 2) {
+            cv::Mat reduced;
+            if (fy * 255 <= 65535) {
+                box_reduce_8u<ushort>(src, reduced, fx, fy);
+            } else {
+                box_reduce_8u<unsigned>(src, reduced, fx, fy);
+            }
+            if (reduced.size() == size) {
+                dst = reduced;
+            } else {
+                cv::resize(reduced, dst, size, 0, 0, cv::INTER_AREA);
+            }
+            return;
+        }
+    }
+    cv::resize(src, dst, size, 0, 0, interpolation);
+}
+
+} // namespace
+
 FFI_PLUGIN_EXPORT CvMat* cv_resize(CvMat* mat, int width, int height, int interpolation) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::resize(*(cv::Mat*)mat, dst, cv::Size(width, height), 0, 0, interpolation);
+    resize_image(*(cv::Mat*)mat, dst, cv::Size(width, height), interpolation);
     return (CvMat*)new cv::Mat(dst);
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_flip(CvMat* mat, int mode) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     cv::flip(*(cv::Mat*)mat, dst, mode);
@@ -115,13 +511,406 @@ FFI_PLUGIN_EXPORT CvMat* cv_flip(CvMat* mat, int mode) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_rotate(CvMat* mat, int code) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     cv::rotate(*(cv::Mat*)mat, dst, code);
     return (CvMat*)new cv::Mat(dst);
 }
 
+// 워프 / 리맵
+namespace {
+
+// 반복되는 기하 변환의 고정소수점 리맵 테이블 (map1: CV_16SC2 정수 좌표, map2: CV_16UC1 보간 인덱스)
+struct RemapCache {
+    cv::Mat map1;
+    cv::Mat map2;
+    int interpolation;
+    int borderMode;
+};
+
+// 출력 좌표 -> 입력 좌표 역변환 행렬(3x3)로 부동소수점 맵을 만든 뒤 고정소수점으로 변환
+RemapCache* remap_cache_from_inverse(const cv::Matx33d& inv, int width, int height, int interpolation, int borderMode) {
+    cv::Mat map(height, width, CV_32FC2);
+    cv::parallel_for_(cv::Range(0, height), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("remap_cache_from_inverse chunk");
+        for (int y = range.start; y < range.end; y++) {
+            cv::Vec2f* row = map.ptr<cv::Vec2f>(y);
+            for (int x = 0; x < width; x++) {
+                double w = inv(2, 0) * x + inv(2, 1) * y + inv(2, 2);
+                w = w != 0 ? 1.0 / w : 0.0;
+                row[x][0] = (float)((inv(0, 0) * x + inv(0, 1) * y + inv(0, 2)) * w);
+                row[x][1] = (float)((inv(1, 0) * x + inv(1, 1) * y + inv(1, 2)) * w);
+            }
+        }
+    });
+    RemapCache* cache = new RemapCache();
+    cache->interpolation = interpolation;
+    cache->borderMode = borderMode;
+    cv::convertMaps(map, cv::noArray(), cache->map1, cache->map2, CV_16SC2, interpolation == cv::INTER_NEAREST);
+    return cache;
+}
+
+bool remap_cache_apply(const RemapCache* cache, const cv::Mat& src, cv::Mat& dst) {
+    if (src.empty() || cache->map1.empty()) return false;
+    cv::remap(src, dst, cache->map1, cache->map2, cache->interpolation, cache->borderMode);
+    return true;
+}
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvMat* cv_warp_affine(CvMat* mat, const double* m, int width, int height, int interpolation, int borderMode) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || m == nullptr) return nullptr;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (width <= 0) width = src.cols;
+    if (height <= 0) height = src.rows;
+    cv::Mat dst;
+    cv::warpAffine(src, dst, cv::Mat(2, 3, CV_64F, (void*)m), cv::Size(width, height), interpolation, borderMode);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_warp_perspective(CvMat* mat, const double* m, int width, int height, int interpolation, int borderMode) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || m == nullptr) return nullptr;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (width <= 0) width = src.cols;
+    if (height <= 0) height = src.rows;
+    cv::Mat dst;
+    cv::warpPerspective(src, dst, cv::Mat(3, 3, CV_64F, (void*)m), cv::Size(width, height), interpolation, borderMode);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_remap(CvMat* mat, CvMat* mapX, CvMat* mapY, int interpolation, int borderMode) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || mapX == nullptr || mapY == nullptr) return nullptr;
+    cv::Mat dst;
+    cv::remap(*(cv::Mat*)mat, dst, *(cv::Mat*)mapX, *(cv::Mat*)mapY, interpolation, borderMode);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 리맵 캐시
+FFI_PLUGIN_EXPORT CvRemapCache* cv_remap_cache_create_affine(const double* m, int width, int height, int interpolation, int borderMode) {
+    CV_PROFILE();
+    if (m == nullptr || width <= 0 || height <= 0) return nullptr;
+    cv::Matx33d forward(m[0], m[1], m[2], m[3], m[4], m[5], 0, 0, 1);
+    return (CvRemapCache*)remap_cache_from_inverse(forward.inv(), width, height, interpolation, borderMode);
+}
+
+FFI_PLUGIN_EXPORT CvRemapCache* cv_remap_cache_create_perspective(const double* m, int width, int height, int interpolation, int borderMode) {
+    CV_PROFILE();
+    if (m == nullptr || width <= 0 || height <= 0) return nullptr;
+    cv::Matx33d forward(m);
+    return (CvRemapCache*)remap_cache_from_inverse(forward.inv(), width, height, interpolation, borderMode);
+}
+
+FFI_PLUGIN_EXPORT CvRemapCache* cv_remap_cache_create_maps(CvMat* mapX, CvMat* mapY, int interpolation, int borderMode) {
+    CV_PROFILE_MAT(mapX);
+    if (mapX == nullptr || mapY == nullptr) return nullptr;
+    const cv::Mat& mx = *(cv::Mat*)mapX;
+    const cv::Mat& my = *(cv::Mat*)mapY;
+    if (mx.empty() || mx.size() != my.size() || mx.type() != CV_32FC1 || my.type() != CV_32FC1) return nullptr;
+    RemapCache* cache = new RemapCache();
+    cache->interpolation = interpolation;
+    cache->borderMode = borderMode;
+    cv::convertMaps(mx, my, cache->map1, cache->map2, CV_16SC2, interpolation == cv::INTER_NEAREST);
+    return (CvRemapCache*)cache;
+}
+
+FFI_PLUGIN_EXPORT void cv_remap_cache_release(CvRemapCache* cache) {
+    CV_PROFILE();
+    if (cache != nullptr) {
+        delete (RemapCache*)cache;
+    }
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_remap_cache_apply(CvRemapCache* cache, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
+    if (cache == nullptr || mat == nullptr) return nullptr;
+    cv::Mat dst;
+    if (!remap_cache_apply((RemapCache*)cache, *(cv::Mat*)mat, dst)) return nullptr;
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 카메라 보정
+namespace {
+
+// 체스보드 관측값과 보정 결과 (내부 파라미터 + 왜곡 계수)
+struct CameraCalibration {
+    cv::Size patternSize; // 내부 코너 개수
+    float squareSize = 1.0f;
+    cv::Size imageSize;
+    std::vector<std::vector<cv::Point2f>> imagePoints;
+    cv::Mat cameraMatrix; // 3x3 CV_64F
+    cv::Mat distCoeffs; // 1xN CV_64F
+    double rms = -1;
+};
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvCalibration* cv_calibration_create(int patternCols, int patternRows, float squareSize) {
+    CV_PROFILE();
+    if (patternCols < 2 || patternRows < 2) return nullptr;
+    CameraCalibration* calib = new CameraCalibration();
+    calib->patternSize = cv::Size(patternCols, patternRows);
+    calib->squareSize = squareSize > 0 ? squareSize : 1.0f;
+    return (CvCalibration*)calib;
+}
+
+FFI_PLUGIN_EXPORT void cv_calibration_release(CvCalibration* calib) {
+    CV_PROFILE();
+    if (calib != nullptr) {
+        delete (CameraCalibration*)calib;
+    }
+}
+
+FFI_PLUGIN_EXPORT int cv_calibration_add_frame(CvCalibration* calib, CvMat* mat, float* outCorners) {
+    CV_PROFILE_MAT(mat);
+    if (calib == nullptr || mat == nullptr) return 0;
+    CameraCalibration* c = (CameraCalibration*)calib;
+    const cv::Mat& src = *(cv::Mat*)mat;
+    if (src.empty() || src.depth() != CV_8U || c->patternSize.area() == 0) return 0;
+    if (!c->imagePoints.empty() && src.size() != c->imageSize) return 0; // 해상도가 섞이면 보정 불가
+
+    cv::Mat gray;
+    if (src.channels() == 1) {
+        gray = src;
+    } else {
+        cv::cvtColor(src, gray, src.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+    }
+    std::vector<cv::Point2f> corners;
+    int flags = cv::CALIB_CB_ADAPTIVE_THRESH | cv::CALIB_CB_NORMALIZE_IMAGE | cv::CALIB_CB_FAST_CHECK;
+    if (!cv::findChessboardCorners(gray, c->patternSize, corners, flags)) return 0;
+    cv::cornerSubPix(gray, corners, cv::Size(11, 11), cv::Size(-1, -1),
+                     cv::TermCriteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 30, 0.01));
+
+    c->imageSize = src.size();
+    c->imagePoints.push_back(corners);
+    if (outCorners != nullptr) {
+        for (size_t i = 0; i < corners.size(); i++) {
+            outCorners[i * 2] = corners[i].x;
+            outCorners[i * 2 + 1] = corners[i].y;
+        }
+    }
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT int cv_calibration_frame_count(CvCalibration* calib) {
+    CV_PROFILE();
+    if (calib == nullptr) return 0;
+    return (int)((CameraCalibration*)calib)->imagePoints.size();
+}
+
+FFI_PLUGIN_EXPORT double cv_calibration_calibrate(CvCalibration* calib) {
+    CV_PROFILE();
+    if (calib == nullptr) return -1;
+    CameraCalibration* c = (CameraCalibration*)calib;
+    if (c->imagePoints.size() < 3) return -1;
+
+    std::vector<cv::Point3f> board;
+    for (int y = 0; y < c->patternSize.height; y++) {
+        for (int x = 0; x < c->patternSize.width; x++) {
+            board.push_back(cv::Point3f(x * c->squareSize, y * c->squareSize, 0));
+        }
+    }
+    std::vector<std::vector<cv::Point3f>> objectPoints(c->imagePoints.size(), board);
+    std::vector<cv::Mat> rvecs, tvecs;
+    c->cameraMatrix = cv::Mat::eye(3, 3, CV_64F);
+    c->distCoeffs = cv::Mat::zeros(1, 5, CV_64F);
+    // 관측값이 퇴화된 경우(같은 자세 반복 등) 발생하는 예외를 실패로 변환
+    try {
+        c->rms = cv::calibrateCamera(objectPoints, c->imagePoints, c->imageSize, c->cameraMatrix, c->distCoeffs, rvecs, tvecs);
+    } catch (const cv::Exception&) {
+        c->cameraMatrix.release();
+        c->distCoeffs.release();
+        c->rms = -1;
+    }
+    return c->rms;
+}
+
+FFI_PLUGIN_EXPORT int cv_calibration_get_params(CvCalibration* calib, double* outCameraMatrix, double* outDistCoeffs, int* outSize) {
+    CV_PROFILE();
+    if (calib == nullptr) return 0;
+    CameraCalibration* c = (CameraCalibration*)calib;
+    if (c->cameraMatrix.empty()) return 0;
+    if (outCameraMatrix != nullptr) {
+        for (int i = 0; i < 9; i++) outCameraMatrix[i] = c->cameraMatrix.at<double>(i / 3, i % 3);
+    }
+    if (outDistCoeffs != nullptr) {
+        for (int i = 0; i < 5; i++) outDistCoeffs[i] = i < (int)c->distCoeffs.total() ? c->distCoeffs.at<double>(i) : 0.0;
+    }
+    if (outSize != nullptr) {
+        outSize[0] = c->imageSize.width;
+        outSize[1] = c->imageSize.height;
+    }
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT void cv_calibration_set_params(CvCalibration* calib, const double* cameraMatrix, const double* distCoeffs, int width, int height) {
+    CV_PROFILE();
+    if (calib == nullptr || cameraMatrix == nullptr) return;
+    CameraCalibration* c = (CameraCalibration*)calib;
+    cv::Mat(3, 3, CV_64F, (void*)cameraMatrix).copyTo(c->cameraMatrix);
+    if (distCoeffs != nullptr) {
+        cv::Mat(1, 5, CV_64F, (void*)distCoeffs).copyTo(c->distCoeffs);
+    } else {
+        c->distCoeffs = cv::Mat::zeros(1, 5, CV_64F);
+    }
+    c->imageSize = cv::Size(width, height);
+}
+
+FFI_PLUGIN_EXPORT int cv_calibration_save(CvCalibration* calib, const char* path) {
+    CV_PROFILE();
+    if (calib == nullptr || path == nullptr) return 0;
+    CameraCalibration* c = (CameraCalibration*)calib;
+    if (c->cameraMatrix.empty()) return 0;
+    cv::FileStorage fs(path, cv::FileStorage::WRITE);
+    if (!fs.isOpened()) return 0;
+    fs << "image_width" << c->imageSize.width;
+    fs << "image_height" << c->imageSize.height;
+    fs << "camera_matrix" << c->cameraMatrix;
+    fs << "distortion_coefficients" << c->distCoeffs;
+    fs << "rms" << c->rms;
+    fs.release();
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT CvCalibration* cv_calibration_load(const char* path) {
+    CV_PROFILE();
+    if (path == nullptr) return nullptr;
+    // 손상된 파일의 파싱 예외가 FFI 경계를 넘지 않도록 여기서 처리
+    try {
+        cv::FileStorage fs(path, cv::FileStorage::READ);
+        if (!fs.isOpened()) return nullptr;
+        // 파싱 도중 예외가 나도 해제되도록 반환 직전까지 unique_ptr 로 보유
+        std::unique_ptr<CameraCalibration> c(new CameraCalibration());
+        fs["image_width"] >> c->imageSize.width;
+        fs["image_height"] >> c->imageSize.height;
+        fs["camera_matrix"] >> c->cameraMatrix;
+        fs["distortion_coefficients"] >> c->distCoeffs;
+        fs["rms"] >> c->rms;
+        if (c->cameraMatrix.rows != 3 || c->cameraMatrix.cols != 3 || c->imageSize.area() == 0) {
+            return nullptr;
+        }
+        c->cameraMatrix.convertTo(c->cameraMatrix, CV_64F);
+        c->distCoeffs.convertTo(c->distCoeffs, CV_64F);
+        return (CvCalibration*)c.release();
+    } catch (const cv::Exception&) {
+        return nullptr;
+    }
+}
+
+FFI_PLUGIN_EXPORT CvRemapCache* cv_undistorter_create(CvCalibration* calib, double alpha, int interpolation) {
+    CV_PROFILE();
+    if (calib == nullptr) return nullptr;
+    CameraCalibration* c = (CameraCalibration*)calib;
+    if (c->cameraMatrix.empty() || c->imageSize.area() == 0) return nullptr;
+    // alpha 0: 유효 픽셀만 남도록 확대, 1: 원본 픽셀을 모두 유지 (검은 테두리 포함)
+    cv::Mat newCamera = cv::getOptimalNewCameraMatrix(c->cameraMatrix, c->distCoeffs, c->imageSize, alpha, c->imageSize);
+    RemapCache* cache = new RemapCache();
+    cache->interpolation = interpolation;
+    cache->borderMode = cv::BORDER_CONSTANT;
+    // 고정소수점 맵을 바로 생성 (convertMaps 불필요)
+    cv::initUndistortRectifyMap(c->cameraMatrix, c->distCoeffs, cv::Mat(), newCamera, c->imageSize, CV_16SC2, cache->map1, cache->map2);
+    return (CvRemapCache*)cache;
+}
+
+// 영상 피라미드
+namespace {
+
+// 레벨을 처음 접근할 때 바로 아래 레벨에서 계산하는 Gaussian / Laplacian 피라미드
+// 레벨마다 독립된 Mat 을 할당 (한 버퍼를 나눈 ROI 로 넘기면 이후 필터의 기본 경계 처리가 이웃 레벨을 읽음)
+struct ImagePyramid {
+    int levels = 0;
+    std::vector<cv::Size> sizes;   // pyrDown 과 같은 반올림의 레벨별 크기
+    std::vector<cv::Mat> gaussian; // [0] 은 원본 (복사하지 않음)
+    std::vector<cv::Mat> laplacian; // [0, levels) 만 존재
+    cv::Mat upsampled; // pyrUp 임시 버퍼
+};
+
+// 레벨 i 의 크기 (pyrDown 과 동일한 반올림)
+std::vector<cv::Size> pyramid_sizes(cv::Size base, int levels) {
+    std::vector<cv::Size> sizes(levels + 1);
+    sizes[0] = base;
+    for (int i = 1; i <= levels; i++) {
+        sizes[i] = cv::Size((sizes[i - 1].width + 1) / 2, (sizes[i - 1].height + 1) / 2);
+    }
+    return sizes;
+}
+
+const cv::Mat& pyramid_gaussian(ImagePyramid* p, int level) {
+    if (p->gaussian[level].empty()) {
+        const cv::Mat& prev = pyramid_gaussian(p, level - 1);
+        cv::pyrDown(prev, p->gaussian[level], p->sizes[level]);
+    }
+    return p->gaussian[level];
+}
+
+const cv::Mat& pyramid_laplacian(ImagePyramid* p, int level) {
+    if (p->laplacian[level].empty()) {
+        const cv::Mat& cur = pyramid_gaussian(p, level);
+        cv::pyrUp(pyramid_gaussian(p, level + 1), p->upsampled, cur.size());
+        const int depth = cur.depth() == CV_8U ? CV_16S : CV_32F;
+        cv::subtract(cur, p->upsampled, p->laplacian[level], cv::noArray(), depth);
+    }
+    return p->laplacian[level];
+}
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvPyramid* cv_pyramid_create(CvMat* mat, int levels) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return nullptr;
+    const cv::Mat& src = *(cv::Mat*)mat;
+    if (src.empty()) return nullptr;
+    // 0 이하면 짧은 변이 16 픽셀 미만이 되기 직전까지
+    int maxLevels = 0;
+    for (int side = std::min(src.cols, src.rows); side >= 32; side = (side + 1) / 2) maxLevels++;
+    if (levels <= 0 || levels > maxLevels) levels = maxLevels;
+    if (levels == 0) return nullptr;
+
+    ImagePyramid* p = new ImagePyramid();
+    p->levels = levels;
+    p->sizes = pyramid_sizes(src.size(), levels);
+    p->gaussian.resize(levels + 1);
+    p->laplacian.resize(levels);
+    p->gaussian[0] = src; // 각 레벨은 접근할 때 계산
+    return (CvPyramid*)p;
+}
+
+FFI_PLUGIN_EXPORT void cv_pyramid_release(CvPyramid* pyramid) {
+    CV_PROFILE();
+    if (pyramid != nullptr) {
+        delete (ImagePyramid*)pyramid;
+    }
+}
+
+FFI_PLUGIN_EXPORT int cv_pyramid_levels(CvPyramid* pyramid) {
+    CV_PROFILE();
+    if (pyramid == nullptr) return 0;
+    return ((ImagePyramid*)pyramid)->levels;
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_pyramid_gaussian(CvPyramid* pyramid, int level) {
+    CV_PROFILE();
+    if (pyramid == nullptr) return nullptr;
+    ImagePyramid* p = (ImagePyramid*)pyramid;
+    if (level < 0 || level > p->levels) return nullptr;
+    return (CvMat*)new cv::Mat(pyramid_gaussian(p, level));
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_pyramid_laplacian(CvPyramid* pyramid, int level) {
+    CV_PROFILE();
+    if (pyramid == nullptr) return nullptr;
+    ImagePyramid* p = (ImagePyramid*)pyramid;
+    if (level < 0 || level > p->levels) return nullptr;
+    // 가장 작은 레벨의 Laplacian 은 Gaussian 과 같음
+    if (level == p->levels) return (CvMat*)new cv::Mat(pyramid_gaussian(p, level));
+    return (CvMat*)new cv::Mat(pyramid_laplacian(p, level));
+}
+
 FFI_PLUGIN_EXPORT CvMat* cv_gaussian_blur(CvMat* mat, int kernelSize, double sigma) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     if (kernelSize % 2 == 0) kernelSize++; // 홀수로 보정
@@ -130,6 +919,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_gaussian_blur(CvMat* mat, int kernelSize, double sig
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_median_blur(CvMat* mat, int kernelSize) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     if (kernelSize % 2 == 0) kernelSize++; // 홀수로 보정
@@ -138,6 +928,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_median_blur(CvMat* mat, int kernelSize) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_bilateral_filter(CvMat* mat, int d, double sigmaColor, double sigmaSpace) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     cv::bilateralFilter(*(cv::Mat*)mat, dst, d, sigmaColor, sigmaSpace);
@@ -145,6 +936,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_bilateral_filter(CvMat* mat, int d, double sigmaColo
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_canny(CvMat* mat, double threshold1, double threshold2) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     cv::Canny(*(cv::Mat*)mat, dst, threshold1, threshold2);
@@ -152,6 +944,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_canny(CvMat* mat, double threshold1, double threshol
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_sobel(CvMat* mat, int dx, int dy, int ksize) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     cv::Sobel(*(cv::Mat*)mat, dst, CV_8U, dx, dy, ksize);
@@ -159,6 +952,7 @@ FFI_PLUGIN_EXPORT CvMat* cv_sobel(CvMat* mat, int dx, int dy, int ksize) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_laplacian(CvMat* mat, int ksize) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
     cv::Laplacian(*(cv::Mat*)mat, dst, CV_8U, ksize);
@@ -166,9 +960,10 @@ FFI_PLUGIN_EXPORT CvMat* cv_laplacian(CvMat* mat, int ksize) {
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_sharpen(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::Mat kernel = (cv::Mat_<float>(3,3) << 
+    static const cv::Mat kernel = (cv::Mat_<float>(3,3) << 
         0, -1, 0,
         -1, 5, -1,
         0, -1, 0);
@@ -176,211 +971,3020 @@ FFI_PLUGIN_EXPORT CvMat* cv_sharpen(CvMat* mat) {
     return (CvMat*)new cv::Mat(dst);
 }
 
+namespace {
+
+// 계수 행렬의 rank 가 1 이면 ky * kx 로 분해 (kx: 1xN 가로, ky: Mx1 세로, CV_64F)
+bool decompose_separable(const cv::Mat& kernel, cv::Mat& kx, cv::Mat& ky) {
+    cv::Mat k;
+    kernel.convertTo(k, CV_64F);
+    if (k.rows == 1 || k.cols == 1) {
+        kx = k.rows == 1 ? k : cv::Mat::ones(1, 1, CV_64F);
+        ky = k.rows == 1 ? cv::Mat::ones(1, 1, CV_64F) : k;
+        return true;
+    }
+    cv::Mat w, u, vt;
+    cv::SVDecomp(k, w, u, vt);
+    double s0 = w.at<double>(0);
+    if (s0 <= 0 || w.at<double>(1) > s0 * 1e-6) return false;
+    double scale = std::sqrt(s0);
+    kx = vt.row(0) * scale;
+    ky = u.col(0) * scale;
+    return true;
+}
+
+// 계수를 2^bits 배 정수로 양자화. int32 누적이 넘치거나 출력 오차가 0.5 LSB 를 넘으면 false
+bool quantize_separable(const cv::Mat& kx, const cv::Mat& ky, std::vector<int>& qx, std::vector<int>& qy, int& shift) {
+    const double sx = cv::norm(kx, cv::NORM_L1);
+    const double sy = cv::norm(ky, cv::NORM_L1);
+    if (sx <= 0 || sy <= 0) return false;
+    const int budget = (int)std::floor(std::log2(2147483647.0 / (255.0 * sx * sy))) - 1;
+    if (budget < 8) return false;
+    const int bx = std::min(budget / 2, 14);
+    const int by = std::min(budget - bx, 14);
+
+    double ex = 0, ey = 0;
+    const double* px = kx.ptr<double>();
+    const double* py = ky.ptr<double>();
+    qx.resize(kx.total());
+    qy.resize(ky.total());
+    for (size_t i = 0; i < qx.size(); i++) {
+        qx[i] = cvRound(px[i] * (1 << bx));
+        ex += std::abs(px[i] - (double)qx[i] / (1 << bx));
+    }
+    for (size_t i = 0; i < qy.size(); i++) {
+        qy[i] = cvRound(py[i] * (1 << by));
+        ey += std::abs(py[i] - (double)qy[i] / (1 << by));
+    }
+    if (255.0 * (ex * sy + sx * ey + ex * ey) > 0.5) return false;
+    shift = bx + by;
+    return true;
+}
+
+// 8비트 영상의 고정소수점 분리형 필터. 가로 결과를 Row 로 보관한 뒤 세로 누적 값을 post 로 변환
+// rowShift > 0 이면 가로 결과를 반올림해 rowShift 비트 줄여 저장 (Row = uint16_t 로 메모리 대역폭 절반)
+// post(acc, src) 는 정수 누적값과 같은 위치의 원본 픽셀을 받아 출력 픽셀을 반환
+template <typename Row, typename Post>
+void sep_filter_8u_fixed(const cv::Mat& src, cv::Mat& dst, const std::vector<int>& qx, const std::vector<int>& qy,
+                         cv::Point anchor, int borderType, int rowShift, const Post& post) {
+    const int kw = (int)qx.size();
+    const int kh = (int)qy.size();
+    const int cn = src.channels();
+    const int width = src.cols * cn;
+    cv::Mat padded;
+    // BORDER_ISOLATED 는 copyMakeBorder 가 직접 처리 (ROI 바깥 픽셀을 읽지 않음)
+    cv::copyMakeBorder(src, padded, anchor.y, kh - 1 - anchor.y, anchor.x, kw - 1 - anchor.x, borderType);
+    dst.create(src.size(), src.type());
+
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("sep_filter_8u_fixed chunk");
+        const int rows = range.end - range.start + kh - 1;
+        std::vector<Row> rowBuf((size_t)rows * width);
+        std::vector<int> rowAcc(width);
+        std::vector<int> acc(width);
+        for (int r = 0; r < rows; r++) {
+            const uchar* s = padded.ptr<uchar>(range.start + r);
+            Row* b = &rowBuf[(size_t)r * width];
+            // int 로 보관하면서 줄이지 않을 때는 행 버퍼에 바로 누적
+            int* a = rowAcc.data();
+            if constexpr (std::is_same<Row, int>::value) {
+                if (rowShift == 0) a = b;
+            }
+            std::fill(a, a + width, 0);
+            for (int i = 0; i < kw; i++) {
+                const int q = qx[i];
+                if (q == 0) continue;
+                const uchar* si = s + i * cn;
+                for (int x = 0; x < width; x++) a[x] += si[x] * q;
+            }
+            if ((void*)a != (void*)b) {
+                const int half = rowShift > 0 ? 1 << (rowShift - 1) : 0;
+                for (int x = 0; x < width; x++) b[x] = (Row)((a[x] + half) >> rowShift);
+            }
+        }
+        for (int y = range.start; y < range.end; y++) {
+            std::fill(acc.begin(), acc.end(), 0);
+            for (int j = 0; j < kh; j++) {
+                const int q = qy[j];
+                if (q == 0) continue;
+                const Row* b = &rowBuf[(size_t)(y - range.start + j) * width];
+                for (int x = 0; x < width; x++) acc[x] += (int)b[x] * q;
+            }
+            const uchar* s = src.ptr<uchar>(y);
+            uchar* d = dst.ptr<uchar>(y);
+            for (int x = 0; x < width; x++) d[x] = post(acc[x], s[x]);
+        }
+    }, std::max(1.0, src.rows / 32.0));
+}
+
+// 가우시안 계수를 합이 정확히 2^bits 가 되도록 양자화 (평탄한 영역은 블러 후에도 그대로). 양자화 L1 오차를 반환
+double quantize_gaussian(const cv::Mat& g, int bits, std::vector<int>& q) {
+    const double* p = g.ptr<double>();
+    const int n = (int)g.total();
+    q.resize(n);
+    int sum = 0;
+    for (int i = 0; i < n; i++) {
+        q[i] = cvRound(p[i] * (1 << bits));
+        sum += q[i];
+    }
+    q[n / 2] += (1 << bits) - sum;
+    double err = 0;
+    for (int i = 0; i < n; i++) err += std::abs(p[i] - (double)q[i] / (1 << bits));
+    return err;
+}
+
+void filter_separable(const cv::Mat& src, cv::Mat& dst, const cv::Mat& kx, const cv::Mat& ky, cv::Point anchor, double delta, int borderType) {
+    if (anchor.x < 0) anchor.x = (int)kx.total() / 2;
+    if (anchor.y < 0) anchor.y = (int)ky.total() / 2;
+    std::vector<int> qx, qy;
+    int shift = 0;
+    if (src.depth() == CV_8U && quantize_separable(kx, ky, qx, qy, shift)) {
+        const int64_t bias = ((int64_t)1 << (shift - 1)) + (int64_t)std::llround(delta * (double)((int64_t)1 << shift));
+        sep_filter_8u_fixed<int>(src, dst, qx, qy, anchor, borderType, 0, [&](int acc, uchar) {
+            return cv::saturate_cast<uchar>((int)((acc + bias) >> shift));
+        });
+        return;
+    }
+    cv::sepFilter2D(src, dst, -1, kx, ky, anchor, delta, borderType);
+}
+
+void filter_2d(const cv::Mat& src, cv::Mat& dst, const cv::Mat& kernel, cv::Point anchor, double delta, int borderType) {
+    cv::Mat kx, ky;
+    if (decompose_separable(kernel, kx, ky)) {
+        filter_separable(src, dst, kx, ky, anchor, delta, borderType);
+    } else {
+        cv::filter2D(src, dst, -1, kernel, anchor, delta, borderType);
+    }
+}
+
+// 미리 생성해 재사용하는 구조 요소 / 필터 커널
+struct Kernel {
+    int shape;        // 0~2: cv::MORPH_RECT/CROSS/ELLIPSE, 3: 사용자 정의
+    cv::Mat element;  // 형태학 연산용 CV_8U 구조 요소
+    cv::Mat weights;  // filter2D 용 CV_32F 계수
+    cv::Point anchor;
+    bool isRect;      // 모든 원소가 1 인 사각형이면 빠른 경로 사용
+    bool separable;   // 생성 시 rank 1 로 판정되면 rowKernel/colKernel 로 분리 적용
+    cv::Mat rowKernel;
+    cv::Mat colKernel;
+};
+
+// 이 크기 이상의 사각형 커널은 van Herk/Gil-Werman 경로를 사용
+const int kVhgwMinKernelSize = 15;
+
+struct MinOp {
+    static constexpr uchar pad = 255;
+    uchar operator()(uchar a, uchar b) const { return std::min(a, b); }
+};
+
+struct MaxOp {
+    static constexpr uchar pad = 0;
+    uchar operator()(uchar a, uchar b) const { return std::max(a, b); }
+};
+
+// van Herk/Gil-Werman 가로 방향 최소/최대 필터. 커널 크기와 무관하게 픽셀당 비교 3회
+template <typename Op>
+void vhgw_rows(const cv::Mat& src, cv::Mat& dst, int ksize, int anchor) {
+    const int n = src.cols;
+    const int cn = src.channels();
+    const int len = (n + ksize - 1 + ksize - 1) / ksize * ksize;
+    Op op;
+    dst.create(src.size(), src.type());
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("vhgw_rows chunk");
+        std::vector<uchar> g(len), h(len);
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* s = src.ptr<uchar>(y);
+            uchar* d = dst.ptr<uchar>(y);
+            for (int c = 0; c < cn; c++) {
+                for (int j = 0; j < len; j++) {
+                    int x = j - anchor;
+                    uchar v = (x >= 0 && x < n) ? s[x * cn + c] : Op::pad;
+                    g[j] = (j % ksize == 0) ? v : op(g[j - 1], v);
+                }
+                for (int j = len - 1; j >= 0; j--) {
+                    int x = j - anchor;
+                    uchar v = (x >= 0 && x < n) ? s[x * cn + c] : Op::pad;
+                    h[j] = (j % ksize == ksize - 1) ? v : op(h[j + 1], v);
+                }
+                for (int x = 0; x < n; x++) {
+                    d[x * cn + c] = op(h[x], g[x + ksize - 1]);
+                }
+            }
+        }
+    });
+}
+
+// 세로 방향은 행 단위로 처리해 연속 메모리에서 벡터화되도록 열 스트립으로 나눔
+template <typename Op>
+void vhgw_cols(const cv::Mat& src, cv::Mat& dst, int ksize, int anchor) {
+    const int n = src.rows;
+    const int width = src.cols * src.channels();
+    const int len = (n + ksize - 1 + ksize - 1) / ksize * ksize;
+    const int stripWidth = 256;
+    Op op;
+    dst.create(src.size(), src.type());
+    const int strips = (width + stripWidth - 1) / stripWidth;
+    cv::parallel_for_(cv::Range(0, strips), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("vhgw_cols chunk");
+        std::vector<uchar> g((size_t)len * stripWidth), h((size_t)len * stripWidth);
+        std::vector<uchar> padRow(stripWidth, Op::pad);
+        for (int strip = range.start; strip < range.end; strip++) {
+            const int x0 = strip * stripWidth;
+            const int w = std::min(stripWidth, width - x0);
+            for (int j = 0; j < len; j++) {
+                int y = j - anchor;
+                const uchar* v = (y >= 0 && y < n) ? src.ptr<uchar>(y) + x0 : padRow.data();
+                uchar* gj = &g[(size_t)j * stripWidth];
+                if (j % ksize == 0) {
+                    std::copy(v, v + w, gj);
+                } else {
+                    const uchar* prev = gj - stripWidth;
+                    for (int x = 0; x < w; x++) gj[x] = op(prev[x], v[x]);
+                }
+            }
+            for (int j = len - 1; j >= 0; j--) {
+                int y = j - anchor;
+                const uchar* v = (y >= 0 && y < n) ? src.ptr<uchar>(y) + x0 : padRow.data();
+                uchar* hj = &h[(size_t)j * stripWidth];
+                if (j % ksize == ksize - 1) {
+                    std::copy(v, v + w, hj);
+                } else {
+                    const uchar* next = hj + stripWidth;
+                    for (int x = 0; x < w; x++) hj[x] = op(next[x], v[x]);
+                }
+            }
+            for (int y = 0; y < n; y++) {
+                const uchar* hy = &h[(size_t)y * stripWidth];
+                const uchar* gy = &g[(size_t)(y + ksize - 1) * stripWidth];
+                uchar* d = dst.ptr<uchar>(y) + x0;
+                for (int x = 0; x < w; x++) d[x] = op(hy[x], gy[x]);
+            }
+        }
+    });
+}
+
+// 사각형 구조 요소의 침식/팽창. 반복 n 회는 (n*(k-1)+1) 크기 한 번과 같음
+template <typename Op>
+bool rect_morph_fast(const cv::Mat& src, cv::Mat& dst, cv::Size ksize, cv::Point anchor, int iterations) {
+    if (src.depth() != CV_8U || iterations < 1) return false;
+    if (anchor.x < 0) anchor.x = ksize.width / 2;
+    if (anchor.y < 0) anchor.y = ksize.height / 2;
+    int kw = iterations * (ksize.width - 1) + 1;
+    int kh = iterations * (ksize.height - 1) + 1;
+    if (std::max(kw, kh) < kVhgwMinKernelSize) return false;
+
+    cv::Mat tmp;
+    const cv::Mat* rowsOut = &src;
+    if (kw > 1) {
+        vhgw_rows<Op>(src, tmp, kw, iterations * anchor.x);
+        rowsOut = &tmp;
+    }
+    if (kh > 1) {
+        vhgw_cols<Op>(*rowsOut, dst, kh, iterations * anchor.y);
+    } else if (rowsOut == &tmp) {
+        dst = tmp;
+    } else {
+        src.copyTo(dst);
+    }
+    return true;
+}
+
+// 반복 호출 시 getStructuringElement 를 다시 만들지 않도록 마지막 사각형 요소를 캐시
+const cv::Mat& rect_element(int size) {
+    thread_local cv::Mat cached;
+    if (cached.rows != size || cached.cols != size) {
+        cached = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(size, size));
+    }
+    return cached;
+}
+
+void morph_erode(const cv::Mat& src, cv::Mat& dst, const Kernel& k, int iterations) {
+    if (k.isRect && rect_morph_fast<MinOp>(src, dst, k.element.size(), k.anchor, iterations)) return;
+    cv::erode(src, dst, k.element, k.anchor, iterations);
+}
+
+void morph_dilate(const cv::Mat& src, cv::Mat& dst, const Kernel& k, int iterations) {
+    if (k.isRect && rect_morph_fast<MaxOp>(src, dst, k.element.size(), k.anchor, iterations)) return;
+    cv::dilate(src, dst, k.element, k.anchor, iterations);
+}
+
+// 복합 연산을 침식/팽창으로 분해해 사각형 빠른 경로를 그대로 활용
+void morph_ex(const cv::Mat& src, cv::Mat& dst, int op, const Kernel& k, int iterations) {
+    cv::Mat tmp;
+    switch (op) {
+    case cv::MORPH_ERODE:
+        morph_erode(src, dst, k, iterations);
+        break;
+    case cv::MORPH_DILATE:
+        morph_dilate(src, dst, k, iterations);
+        break;
+    case cv::MORPH_OPEN:
+        morph_erode(src, tmp, k, iterations);
+        morph_dilate(tmp, dst, k, iterations);
+        break;
+    case cv::MORPH_CLOSE:
+        morph_dilate(src, tmp, k, iterations);
+        morph_erode(tmp, dst, k, iterations);
+        break;
+    case cv::MORPH_GRADIENT: {
+        cv::Mat eroded;
+        morph_dilate(src, tmp, k, iterations);
+        morph_erode(src, eroded, k, iterations);
+        cv::subtract(tmp, eroded, dst);
+        break;
+    }
+    case cv::MORPH_TOPHAT:
+        morph_erode(src, tmp, k, iterations);
+        morph_dilate(tmp, dst, k, iterations);
+        cv::subtract(src, dst, dst);
+        break;
+    case cv::MORPH_BLACKHAT:
+        morph_dilate(src, tmp, k, iterations);
+        morph_erode(tmp, dst, k, iterations);
+        cv::subtract(dst, src, dst);
+        break;
+    default:
+        cv::morphologyEx(src, dst, op, k.element, k.anchor, iterations);
+        break;
+    }
+}
+
+// 기존 kernelSize 기반 API 용 임시 사각형 커널 (구조 요소는 캐시에서 공유)
+Kernel rect_kernel(int kernelSize) {
+    Kernel k;
+    k.shape = cv::MORPH_RECT;
+    k.element = rect_element(kernelSize);
+    k.anchor = cv::Point(-1, -1);
+    k.isRect = true;
+    return k;
+}
+
+} // namespace
+
 // 형태학 연산
 FFI_PLUGIN_EXPORT CvMat* cv_erode(CvMat* mat, int kernelSize, int iterations) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(kernelSize, kernelSize));
-    cv::erode(*(cv::Mat*)mat, dst, kernel, cv::Point(-1, -1), iterations);
+    morph_erode(*(cv::Mat*)mat, dst, rect_kernel(kernelSize), iterations);
     return (CvMat*)new cv::Mat(dst);
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_dilate(CvMat* mat, int kernelSize, int iterations) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(kernelSize, kernelSize));
-    cv::dilate(*(cv::Mat*)mat, dst, kernel, cv::Point(-1, -1), iterations);
+    morph_dilate(*(cv::Mat*)mat, dst, rect_kernel(kernelSize), iterations);
     return (CvMat*)new cv::Mat(dst);
 }
 
 FFI_PLUGIN_EXPORT CvMat* cv_morphology_ex(CvMat* mat, int op, int kernelSize) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(kernelSize, kernelSize));
-    cv::morphologyEx(*(cv::Mat*)mat, dst, op, kernel);
+    morph_ex(*(cv::Mat*)mat, dst, op, rect_kernel(kernelSize), 1);
     return (CvMat*)new cv::Mat(dst);
 }
 
-// 임계값 처리
-FFI_PLUGIN_EXPORT CvMat* cv_threshold(CvMat* mat, double thresh, double maxval, int type) {
-    if (mat == nullptr) return nullptr;
+// 커널 객체
+FFI_PLUGIN_EXPORT CvKernel* cv_kernel_create(int shape, int width, int height) {
+    CV_PROFILE();
+    if (width < 1 || height < 1) return nullptr;
+    if (shape < cv::MORPH_RECT || shape > cv::MORPH_ELLIPSE) return nullptr;
+    Kernel* k = new Kernel();
+    k->shape = shape;
+    k->element = cv::getStructuringElement(shape, cv::Size(width, height));
+    k->element.convertTo(k->weights, CV_32F, 1.0 / cv::countNonZero(k->element));
+    k->anchor = cv::Point(-1, -1);
+    k->isRect = shape == cv::MORPH_RECT;
+    k->separable = decompose_separable(k->weights, k->rowKernel, k->colKernel);
+    return (CvKernel*)k;
+}
+
+FFI_PLUGIN_EXPORT CvKernel* cv_kernel_create_custom(const float* data, int width, int height, int anchorX, int anchorY) {
+    CV_PROFILE();
+    if (data == nullptr || width < 1 || height < 1) return nullptr;
+    Kernel* k = new Kernel();
+    k->shape = 3;
+    cv::Mat(height, width, CV_32F, (void*)data).copyTo(k->weights);
+    k->element = k->weights != 0;
+    k->element.setTo(1, k->element);
+    k->anchor = cv::Point(anchorX, anchorY);
+    k->isRect = cv::countNonZero(k->element) == width * height;
+    k->separable = decompose_separable(k->weights, k->rowKernel, k->colKernel);
+    return (CvKernel*)k;
+}
+
+FFI_PLUGIN_EXPORT void cv_kernel_release(CvKernel* kernel) {
+    CV_PROFILE();
+    if (kernel != nullptr) {
+        delete (Kernel*)kernel;
+    }
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_erode_kernel(CvMat* mat, CvKernel* kernel, int iterations) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || kernel == nullptr) return nullptr;
     cv::Mat dst;
-    cv::threshold(*(cv::Mat*)mat, dst, thresh, maxval, type);
+    morph_erode(*(cv::Mat*)mat, dst, *(Kernel*)kernel, iterations);
     return (CvMat*)new cv::Mat(dst);
 }
 
-FFI_PLUGIN_EXPORT CvMat* cv_adaptive_threshold(CvMat* mat, double maxValue, int adaptiveMethod, int thresholdType, int blockSize, double C) {
-    if (mat == nullptr) return nullptr;
+FFI_PLUGIN_EXPORT CvMat* cv_dilate_kernel(CvMat* mat, CvKernel* kernel, int iterations) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || kernel == nullptr) return nullptr;
     cv::Mat dst;
-    if (blockSize % 2 == 0) blockSize++; // 홀수로 보정
-    cv::adaptiveThreshold(*(cv::Mat*)mat, dst, maxValue, adaptiveMethod, thresholdType, blockSize, C);
+    morph_dilate(*(cv::Mat*)mat, dst, *(Kernel*)kernel, iterations);
     return (CvMat*)new cv::Mat(dst);
 }
 
-// 히스토그램
-FFI_PLUGIN_EXPORT CvMat* cv_equalize_hist(CvMat* mat) {
-    if (mat == nullptr) return nullptr;
+FFI_PLUGIN_EXPORT CvMat* cv_morphology_ex_kernel(CvMat* mat, int op, CvKernel* kernel, int iterations) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || kernel == nullptr) return nullptr;
     cv::Mat dst;
-    cv::Mat src = *(cv::Mat*)mat;
-    
-    // 그레이스케일인 경우
-    if (src.channels() == 1) {
-        cv::equalizeHist(src, dst);
+    morph_ex(*(cv::Mat*)mat, dst, op, *(Kernel*)kernel, iterations);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_filter2d_kernel(CvMat* mat, CvKernel* kernel, double delta, int borderType) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || kernel == nullptr) return nullptr;
+    Kernel* k = (Kernel*)kernel;
+    cv::Mat dst;
+    if (k->separable) {
+        filter_separable(*(cv::Mat*)mat, dst, k->rowKernel, k->colKernel, k->anchor, delta, borderType);
     } else {
-        // 컬러 이미지는 YCrCb로 변환 후 Y 채널만 평활화
-        cv::Mat ycrcb;
-        cv::cvtColor(src, ycrcb, cv::COLOR_BGR2YCrCb);
-        std::vector<cv::Mat> channels;
-        cv::split(ycrcb, channels);
-        cv::equalizeHist(channels[0], channels[0]);
-        cv::merge(channels, ycrcb);
-        cv::cvtColor(ycrcb, dst, cv::COLOR_YCrCb2BGR);
+        cv::filter2D(*(cv::Mat*)mat, dst, -1, k->weights, k->anchor, delta, borderType);
     }
     return (CvMat*)new cv::Mat(dst);
 }
 
-// 노이즈 제거
-FFI_PLUGIN_EXPORT CvMat* cv_fast_nl_means_denoising(CvMat* mat, float h, int templateWindowSize, int searchWindowSize) {
+// 사용자 커널 필터
+FFI_PLUGIN_EXPORT CvMat* cv_filter2d(CvMat* mat, const float* kernel, int kernelWidth, int kernelHeight, int anchorX, int anchorY, double delta, int borderType) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || kernel == nullptr || kernelWidth < 1 || kernelHeight < 1) return nullptr;
+    cv::Mat dst;
+    cv::Mat k(kernelHeight, kernelWidth, CV_32F, (void*)kernel);
+    filter_2d(*(cv::Mat*)mat, dst, k, cv::Point(anchorX, anchorY), delta, borderType);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_sep_filter2d(CvMat* mat, const float* kernelX, int kernelXLen, const float* kernelY, int kernelYLen, int anchorX, int anchorY, double delta, int borderType) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || kernelX == nullptr || kernelY == nullptr || kernelXLen < 1 || kernelYLen < 1) return nullptr;
+    cv::Mat dst, kx, ky;
+    cv::Mat(1, kernelXLen, CV_32F, (void*)kernelX).convertTo(kx, CV_64F);
+    cv::Mat(kernelYLen, 1, CV_32F, (void*)kernelY).convertTo(ky, CV_64F);
+    filter_separable(*(cv::Mat*)mat, dst, kx, ky, cv::Point(anchorX, anchorY), delta, borderType);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 언샤프 마스크: 블러, 차이, 가중합을 세로 패스 한 번에 결합 (8비트 영상)
+// 계수 2^15, 가로 결과는 소수부 8비트 uint16 으로 보관: 세로 누적 최대 65280 * 2^15 < 2^31
+const int kUnsharpCoeffBits = 15;
+const int kUnsharpRowShift = 7;
+
+FFI_PLUGIN_EXPORT CvMat* cv_unsharp_mask(CvMat* mat, double sigma, double amount, int threshold) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || sigma <= 0) return nullptr;
+    cv::Mat src = *(cv::Mat*)mat;
+    cv::Mat dst;
+    int ksize = cvRound(sigma * 6 + 1) | 1;
+    cv::Mat g = cv::getGaussianKernel(ksize, sigma, CV_64F);
+    std::vector<int> q;
+    // 양자화 오차 (가로/세로 곱) 와 가로 결과 반올림 오차의 최악값이 0.5 LSB 이내일 때만 고정소수점 경로
+    const double err = src.depth() == CV_8U ? quantize_gaussian(g, kUnsharpCoeffBits, q) : 1.0;
+    const double bound = 255.0 * (2 * err + err * err) + 1.0 / (1 << (kUnsharpCoeffBits - kUnsharpRowShift + 1));
+    if (src.depth() == CV_8U && bound <= 0.5) {
+        const int shift = 2 * kUnsharpCoeffBits - kUnsharpRowShift;
+        const int half = 1 << (shift - 1);
+        const int amountQ = cvRound(amount * 256);
+        sep_filter_8u_fixed<uint16_t>(src, dst, q, q, cv::Point(ksize / 2, ksize / 2), cv::BORDER_DEFAULT, kUnsharpRowShift, [&](int acc, uchar s) {
+            int diff = s - ((acc + half) >> shift);
+            if (std::abs(diff) < threshold) return s;
+            return cv::saturate_cast<uchar>(s + ((diff * amountQ + 128) >> 8));
+        });
+    } else {
+        cv::Mat blurred;
+        cv::GaussianBlur(src, blurred, cv::Size(ksize, ksize), sigma);
+        cv::addWeighted(src, 1.0 + amount, blurred, -amount, 0, dst);
+        if (threshold > 0) {
+            // 원본과 블러의 차이가 threshold 미만인 픽셀은 원본 유지
+            cv::Mat diff;
+            cv::absdiff(src, blurred, diff);
+            src.copyTo(dst, diff < threshold);
+        }
+    }
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 임계값 처리
+FFI_PLUGIN_EXPORT CvMat* cv_threshold(CvMat* mat, double thresh, double maxval, int type) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::fastNlMeansDenoising(*(cv::Mat*)mat, dst, h, templateWindowSize, searchWindowSize);
+    cv::threshold(*(cv::Mat*)mat, dst, thresh, maxval, type);
     return (CvMat*)new cv::Mat(dst);
 }
 
-FFI_PLUGIN_EXPORT CvMat* cv_fast_nl_means_denoising_colored(CvMat* mat, float h, float hColor, int templateWindowSize, int searchWindowSize) {
+FFI_PLUGIN_EXPORT CvMat* cv_adaptive_threshold(CvMat* mat, double maxValue, int adaptiveMethod, int thresholdType, int blockSize, double C) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
     cv::Mat dst;
-    cv::fastNlMeansDenoisingColored(*(cv::Mat*)mat, dst, h, hColor, templateWindowSize, searchWindowSize);
+    if (blockSize % 2 == 0) blockSize++; // 홀수로 보정
+    cv::adaptiveThreshold(*(cv::Mat*)mat, dst, maxValue, adaptiveMethod, thresholdType, blockSize, C);
     return (CvMat*)new cv::Mat(dst);
 }
 
-// 컨투어
-FFI_PLUGIN_EXPORT struct ContoursResult cv_find_contours(CvMat* mat, int mode, int method) {
-    struct ContoursResult result = {nullptr, nullptr, 0};
-    if (mat == nullptr) return result;
-    
-    std::vector<std::vector<cv::Point>> contours;
-    cv::findContours(*(cv::Mat*)mat, contours, mode, method);
-    
-    result.num_contours = contours.size();
-    if (result.num_contours == 0) return result;
-    
-    result.contours = (int**)malloc(sizeof(int*) * result.num_contours);
-    result.contour_sizes = (int*)malloc(sizeof(int) * result.num_contours);
-    
-    for (int i = 0; i < result.num_contours; i++) {
-        result.contour_sizes[i] = contours[i].size();
-        result.contours[i] = (int*)malloc(sizeof(int) * 2 * contours[i].size());
-        for (size_t j = 0; j < contours[i].size(); j++) {
-            result.contours[i][j * 2] = contours[i][j].x;
-            result.contours[i][j * 2 + 1] = contours[i][j].y;
+// 적분 영상
+namespace {
+
+// 프레임마다 다시 계산하되 버퍼는 재사용하는 적분 영상 묶음
+struct IntegralImage {
+    cv::Mat sum;    // (rows+1) x (cols+1), CV_32S 또는 CV_64F
+    cv::Mat sqsum;  // CV_64F
+    cv::Mat tilted; // sum 과 같은 깊이
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    bool hasSqsum = false;
+    bool hasTilted = false;
+};
+
+template <typename T>
+inline double integral_rect(const cv::Mat& s, int cn, int c, int x0, int y0, int x1, int y1) {
+    const T* r0 = s.ptr<T>(y0);
+    const T* r1 = s.ptr<T>(y1);
+    return (double)r1[x1 * cn + c] - (double)r1[x0 * cn + c] - (double)r0[x1 * cn + c] + (double)r0[x0 * cn + c];
+}
+
+inline double integral_rect_any(const cv::Mat& s, int cn, int c, int x0, int y0, int x1, int y1) {
+    return s.depth() == CV_32S ? integral_rect<int>(s, cn, c, x0, y0, x1, y1)
+                               : integral_rect<double>(s, cn, c, x0, y0, x1, y1);
+}
+
+// 45도 기울어진 사각형 (x, y 는 위쪽 꼭짓점). Lienhart 의 rotated Haar 합 공식
+template <typename T>
+inline double integral_tilted(const cv::Mat& t, int cn, int c, int x, int y, int w, int h) {
+    return (double)t.ptr<T>(y)[x * cn + c] - (double)t.ptr<T>(y + h)[(x - h) * cn + c]
+         - (double)t.ptr<T>(y + w)[(x + w) * cn + c] + (double)t.ptr<T>(y + w + h)[(x + w - h) * cn + c];
+}
+
+// 영상 경계로 잘라낸 사각형. 비어 있으면 false
+inline bool clip_rect(const IntegralImage* ii, const int* r, int& x0, int& y0, int& x1, int& y1) {
+    x0 = std::min(std::max(r[0], 0), ii->width);
+    y0 = std::min(std::max(r[1], 0), ii->height);
+    x1 = std::min(std::max(r[0] + r[2], 0), ii->width);
+    y1 = std::min(std::max(r[1] + r[3], 0), ii->height);
+    return x1 > x0 && y1 > y0;
+}
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvIntegral* cv_integral_create() {
+    CV_PROFILE();
+    return (CvIntegral*)new IntegralImage();
+}
+
+FFI_PLUGIN_EXPORT void cv_integral_release(CvIntegral* integral) {
+    CV_PROFILE();
+    if (integral != nullptr) {
+        delete (IntegralImage*)integral;
+    }
+}
+
+FFI_PLUGIN_EXPORT int cv_integral_compute(CvIntegral* integral, CvMat* mat, int flags) {
+    CV_PROFILE_MAT(mat);
+    if (integral == nullptr || mat == nullptr) return 0;
+    IntegralImage* ii = (IntegralImage*)integral;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (src.empty()) return 0;
+
+    // 8비트 영상은 합이 int32 범위에 들어오면 CV_32S 로 계산 (메모리와 대역폭 절반)
+    int sdepth = (src.depth() == CV_8U && src.total() * 255.0 < 2147483647.0) ? CV_32S : CV_64F;
+    ii->hasSqsum = (flags & 1) != 0;
+    ii->hasTilted = (flags & 2) != 0;
+    if (ii->hasTilted) {
+        cv::integral(src, ii->sum, ii->sqsum, ii->tilted, sdepth, CV_64F);
+        ii->hasSqsum = true;
+    } else if (ii->hasSqsum) {
+        cv::integral(src, ii->sum, ii->sqsum, sdepth, CV_64F);
+    } else {
+        cv::integral(src, ii->sum, sdepth);
+    }
+    ii->width = src.cols;
+    ii->height = src.rows;
+    ii->channels = src.channels();
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT int cv_integral_rect_sums(CvIntegral* integral, const int* rects, int count, int channel, double* outSums) {
+    CV_PROFILE();
+    if (integral == nullptr || rects == nullptr || outSums == nullptr) return 0;
+    IntegralImage* ii = (IntegralImage*)integral;
+    if (ii->sum.empty() || channel < 0 || channel >= ii->channels) return 0;
+    for (int i = 0; i < count; i++) {
+        int x0, y0, x1, y1;
+        outSums[i] = clip_rect(ii, rects + i * 4, x0, y0, x1, y1)
+            ? integral_rect_any(ii->sum, ii->channels, channel, x0, y0, x1, y1) : 0.0;
+    }
+    return count;
+}
+
+FFI_PLUGIN_EXPORT int cv_integral_rect_stats(CvIntegral* integral, const int* rects, int count, int channel, double* outMeans, double* outVariances) {
+    CV_PROFILE();
+    if (integral == nullptr || rects == nullptr || outMeans == nullptr) return 0;
+    IntegralImage* ii = (IntegralImage*)integral;
+    if (ii->sum.empty() || channel < 0 || channel >= ii->channels) return 0;
+    if (outVariances != nullptr && !ii->hasSqsum) return 0;
+    const int cn = ii->channels;
+    for (int i = 0; i < count; i++) {
+        int x0, y0, x1, y1;
+        if (!clip_rect(ii, rects + i * 4, x0, y0, x1, y1)) {
+            outMeans[i] = 0.0;
+            if (outVariances != nullptr) outVariances[i] = 0.0;
+            continue;
+        }
+        double n = (double)(x1 - x0) * (y1 - y0);
+        double mean = integral_rect_any(ii->sum, cn, channel, x0, y0, x1, y1) / n;
+        outMeans[i] = mean;
+        if (outVariances != nullptr) {
+            double sq = integral_rect<double>(ii->sqsum, cn, channel, x0, y0, x1, y1) / n;
+            outVariances[i] = std::max(0.0, sq - mean * mean);
         }
     }
-    
-    return result;
+    return count;
 }
 
-FFI_PLUGIN_EXPORT void cv_free_contours(struct ContoursResult result) {
-    if (result.contours != nullptr) {
-        for (int i = 0; i < result.num_contours; i++) {
-            free(result.contours[i]);
+FFI_PLUGIN_EXPORT int cv_integral_tilted_sums(CvIntegral* integral, const int* rects, int count, int channel, double* outSums) {
+    CV_PROFILE();
+    if (integral == nullptr || rects == nullptr || outSums == nullptr) return 0;
+    IntegralImage* ii = (IntegralImage*)integral;
+    if (!ii->hasTilted || channel < 0 || channel >= ii->channels) return 0;
+    const int cn = ii->channels;
+    for (int i = 0; i < count; i++) {
+        const int* r = rects + i * 4;
+        int x = r[0], y = r[1], w = r[2], h = r[3];
+        bool inside = w > 0 && h > 0 && y >= 0 && x - h >= 0 && x + w <= ii->width && y + w + h <= ii->height;
+        if (!inside) {
+            outSums[i] = 0.0;
+        } else if (ii->tilted.depth() == CV_32S) {
+            outSums[i] = integral_tilted<int>(ii->tilted, cn, channel, x, y, w, h);
+        } else {
+            outSums[i] = integral_tilted<double>(ii->tilted, cn, channel, x, y, w, h);
         }
-        free(result.contours);
     }
-    if (result.contour_sizes != nullptr) {
-        free(result.contour_sizes);
+    return count;
+}
+
+// 문서 이진화
+namespace {
+
+// 한 행의 창 평균 / 표준편차. 창은 영상 경계에서 잘라냄.
+// 창이 잘리는 좌우 가장자리만 픽셀마다 넓이를 구하고, 내부는 넓이가 일정해 나눗셈 없이 벡터화됨
+template <typename S>
+void window_stats_row(const cv::Mat& sum, const cv::Mat& sqsum, int y, int half, float* mean, float* stdev) {
+    const int width = sum.cols - 1;
+    const int height = sum.rows - 1;
+    const int y0 = std::max(0, y - half);
+    const int y1 = std::min(height, y + half + 1);
+    const S* s0 = sum.ptr<S>(y0);
+    const S* s1 = sum.ptr<S>(y1);
+    const double* q0 = sqsum.ptr<double>(y0);
+    const double* q1 = sqsum.ptr<double>(y1);
+    // stdev 에는 우선 분산을 기록하고 마지막에 행 전체의 제곱근을 한 번에 구함
+    // (std::sqrt 는 errno 처리 때문에 루프 벡터화를 막음)
+    auto clamped = [&](int x) {
+        const int x0 = std::max(0, x - half);
+        const int x1 = std::min(width, x + half + 1);
+        const double inv = 1.0 / ((double)(x1 - x0) * (y1 - y0));
+        const double m = ((double)s1[x1] - (double)s1[x0] - (double)s0[x1] + (double)s0[x0]) * inv;
+        const double sq = (q1[x1] - q1[x0] - q0[x1] + q0[x0]) * inv;
+        mean[x] = (float)m;
+        stdev[x] = (float)std::max(0.0, sq - m * m);
+    };
+    const int xBegin = std::min(half, width);
+    const int xEnd = std::max(xBegin, width - half);
+    for (int x = 0; x < xBegin; x++) clamped(x);
+    const double inv = 1.0 / ((double)(2 * half + 1) * (y1 - y0));
+    for (int x = xBegin; x < xEnd; x++) {
+        const int x0 = x - half, x1 = x + half + 1;
+        const double m = ((double)s1[x1] - (double)s1[x0] - (double)s0[x1] + (double)s0[x0]) * inv;
+        const double sq = (q1[x1] - q1[x0] - q0[x1] + q0[x0]) * inv;
+        mean[x] = (float)m;
+        stdev[x] = (float)std::max(0.0, sq - m * m);
     }
+    for (int x = xEnd; x < width; x++) clamped(x);
+    cv::Mat row(1, width, CV_32F, stdev);
+    cv::sqrt(row, row);
 }
 
-FFI_PLUGIN_EXPORT void cv_draw_contours(CvMat* mat, struct ContoursResult contours, int contourIdx, int r, int g, int b, int thickness) {
-    if (mat == nullptr || contours.contours == nullptr) return;
-    
-    std::vector<std::vector<cv::Point>> cvContours;
-    for (int i = 0; i < contours.num_contours; i++) {
-        std::vector<cv::Point> contour;
-        for (int j = 0; j < contours.contour_sizes[i]; j++) {
-            contour.push_back(cv::Point(
-                contours.contours[i][j * 2],
-                contours.contours[i][j * 2 + 1]
-            ));
+void window_stats_row_any(const cv::Mat& sum, const cv::Mat& sqsum, int y, int half, float* mean, float* stdev) {
+    if (sum.depth() == CV_32S) {
+        window_stats_row<int>(sum, sqsum, y, half, mean, stdev);
+    } else {
+        window_stats_row<double>(sum, sqsum, y, half, mean, stdev);
+    }
+}
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvMat* cv_binarize_document(CvMat* mat, int method, int windowSize, double k, double r, int scales) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return nullptr;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (src.empty() || src.depth() != CV_8U) return nullptr;
+    cv::Mat gray;
+    if (src.channels() == 1) {
+        gray = src;
+    } else {
+        cv::cvtColor(src, gray, src.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+    }
+    if (windowSize < 3) windowSize = 3;
+    if (windowSize % 2 == 0) windowSize++; // 홀수로 보정
+    scales = std::min(std::max(scales, 1), 4);
+    if (r <= 0) r = 128.0;
+
+    // 호출마다 큰 적분 버퍼를 다시 할당하지 않도록 스레드별로 재사용
+    // (작업 스레드는 자신의 thread_local 을 보므로 람다에는 로컬 헤더로 넘김)
+    thread_local cv::Mat sumBuf, sqsumBuf;
+    int sdepth = gray.total() * 255.0 < 2147483647.0 ? CV_32S : CV_64F;
+    cv::integral(gray, sumBuf, sqsumBuf, sdepth, CV_64F);
+    const cv::Mat sum = sumBuf;
+    const cv::Mat sqsum = sqsumBuf;
+
+    const int width = gray.cols;
+    const int height = gray.rows;
+
+    // Wolf 는 전역 최소 밝기와 최대 지역 표준편차가 필요해 통계 패스를 한 번 더 수행.
+    // 행 스트립마다 부분 최댓값을 구한 뒤 합쳐 스레드 간 경합이 없음
+    double minGray = 0, maxStd = 1;
+    if (method == 1) {
+        cv::minMaxLoc(gray, &minGray);
+        const int stripes = std::max(1, std::min(height, cv::getNumThreads() * 4));
+        std::vector<float> partial(stripes, 0.0f);
+        cv::parallel_for_(cv::Range(0, stripes), [&](const cv::Range& range) {
+            CV_TRACE_SPAN("cv_binarize_document max stdev chunk");
+            std::vector<float> m(width), sd(width);
+            for (int t = range.start; t < range.end; t++) {
+                float best = 0;
+                for (int y = height * t / stripes; y < height * (t + 1) / stripes; y++) {
+                    window_stats_row_any(sum, sqsum, y, windowSize / 2, m.data(), sd.data());
+                    for (int x = 0; x < width; x++) best = std::max(best, sd[x]);
+                }
+                partial[t] = best;
+            }
+        });
+        maxStd = std::max(1.0f, *std::max_element(partial.begin(), partial.end()));
+    }
+
+    const float kf = (float)k;
+    const float invR = (float)(1.0 / r);
+    const float minContrast = (float)(r * 0.1);
+    const float fMin = (float)minGray;
+    const float invMaxStd = (float)(1.0 / maxStd);
+
+    cv::Mat dst(gray.size(), CV_8U);
+    cv::parallel_for_(cv::Range(0, height), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("cv_binarize_document chunk");
+        std::vector<float> means((size_t)scales * width), stds((size_t)scales * width);
+        std::vector<float> m(width), sd(width);
+        for (int y = range.start; y < range.end; y++) {
+            for (int i = 0; i < scales; i++) {
+                window_stats_row_any(sum, sqsum, y, (windowSize << i) / 2, &means[(size_t)i * width], &stds[(size_t)i * width]);
+            }
+            // 다중 스케일: 대비가 낮은(배경) 위치는 더 큰 창의 통계를 사용
+            std::copy(means.begin(), means.begin() + width, m.begin());
+            std::copy(stds.begin(), stds.begin() + width, sd.begin());
+            for (int i = 1; i < scales; i++) {
+                const float* mi = &means[(size_t)i * width];
+                const float* si = &stds[(size_t)i * width];
+                for (int x = 0; x < width; x++) {
+                    bool flat = sd[x] < minContrast;
+                    m[x] = flat ? mi[x] : m[x];
+                    sd[x] = flat ? si[x] : sd[x];
+                }
+            }
+
+            const uchar* g = gray.ptr<uchar>(y);
+            uchar* d = dst.ptr<uchar>(y);
+            if (method == 1) {
+                for (int x = 0; x < width; x++) {
+                    float t = (1.0f - kf) * m[x] + kf * fMin + kf * sd[x] * invMaxStd * (m[x] - fMin);
+                    d[x] = g[x] > t ? 255 : 0;
+                }
+            } else if (method == 2) {
+                for (int x = 0; x < width; x++) {
+                    float t = m[x] + kf * sd[x];
+                    d[x] = g[x] > t ? 255 : 0;
+                }
+            } else {
+                for (int x = 0; x < width; x++) {
+                    float t = m[x] * (1.0f + kf * (sd[x] * invR - 1.0f));
+                    d[x] = g[x] > t ? 255 : 0;
+                }
+            }
         }
-        cvContours.push_back(contour);
+    });
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 문서 스캐너
+namespace {
+
+// 좌상, 우상, 우하, 좌하 순서로 정렬
+void order_quad(std::vector<cv::Point2f>& pts) {
+    cv::Point2f tl = pts[0], tr = pts[0], br = pts[0], bl = pts[0];
+    for (const cv::Point2f& p : pts) {
+        if (p.x + p.y < tl.x + tl.y) tl = p;
+        if (p.x + p.y > br.x + br.y) br = p;
+        if (p.x - p.y > tr.x - tr.y) tr = p;
+        if (p.x - p.y < bl.x - bl.y) bl = p;
     }
-    
-    cv::drawContours(*(cv::Mat*)mat, cvContours, contourIdx, cv::Scalar(b, g, r), thickness);
+    pts = {tl, tr, br, bl};
 }
 
-FFI_PLUGIN_EXPORT void cv_rectangle(CvMat* mat, int x, int y, int width, int height, int r, int g, int b, int thickness) {
-    if (mat == nullptr) return;
-    cv::rectangle(*(cv::Mat*)mat, cv::Rect(x, y, width, height), cv::Scalar(b, g, r), thickness);
+// 사각형 변 위의 점 중 엣지 픽셀(주변 1픽셀 포함)에 놓인 비율
+double quad_edge_support(const cv::Mat& edges, const std::vector<cv::Point2f>& quad) {
+    int total = 0, hit = 0;
+    for (int i = 0; i < 4; i++) {
+        cv::Point2f a = quad[i], b = quad[(i + 1) % 4];
+        int steps = std::max(1, (int)cv::norm(b - a));
+        for (int s = 0; s <= steps; s++) {
+            cv::Point2f p = a + (b - a) * ((float)s / steps);
+            int x = cvRound(p.x), y = cvRound(p.y);
+            if (x < 1 || y < 1 || x >= edges.cols - 1 || y >= edges.rows - 1) continue;
+            total++;
+            const uchar* r0 = edges.ptr<uchar>(y - 1);
+            const uchar* r1 = edges.ptr<uchar>(y);
+            const uchar* r2 = edges.ptr<uchar>(y + 1);
+            if ((r0[x - 1] | r0[x] | r0[x + 1] | r1[x - 1] | r1[x] | r1[x + 1] | r2[x - 1] | r2[x] | r2[x + 1]) != 0) hit++;
+        }
+    }
+    return total > 0 ? (double)hit / total : 0.0;
 }
 
-FFI_PLUGIN_EXPORT void cv_circle(CvMat* mat, int centerX, int centerY, int radius, int r, int g, int b, int thickness) {
-    if (mat == nullptr) return;
-    cv::circle(*(cv::Mat*)mat, cv::Point(centerX, centerY), radius, cv::Scalar(b, g, r), thickness);
+// 네 내각이 90도에 가까울수록 1
+double quad_angle_score(const std::vector<cv::Point2f>& quad) {
+    double worst = 0;
+    for (int i = 0; i < 4; i++) {
+        cv::Point2f a = quad[(i + 3) % 4] - quad[i];
+        cv::Point2f b = quad[(i + 1) % 4] - quad[i];
+        double denom = cv::norm(a) * cv::norm(b);
+        if (denom <= 0) return 0;
+        worst = std::max(worst, std::abs(a.dot(b)) / denom); // |cos|
+    }
+    return 1.0 - worst;
 }
 
-FFI_PLUGIN_EXPORT void cv_line(CvMat* mat, int x1, int y1, int x2, int y2, int r, int g, int b, int thickness) {
-    if (mat == nullptr) return;
-    cv::line(*(cv::Mat*)mat, cv::Point(x1, y1), cv::Point(x2, y2), cv::Scalar(b, g, r), thickness);
+} // namespace
+
+FFI_PLUGIN_EXPORT double cv_document_detect(CvMat* mat, int maxSide, float* outQuad) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || outQuad == nullptr) return 0;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (src.empty() || src.depth() != CV_8U) return 0;
+    if (maxSide <= 0) maxSide = 500;
+
+    // 카메라 프레임마다 호출되므로 작업 버퍼는 스레드별로 재사용
+    thread_local cv::Mat small, gray, edges;
+    double scale = std::min(1.0, (double)maxSide / std::max(src.cols, src.rows));
+    if (scale < 1.0) {
+        resize_image(src, small, cv::Size(cvRound(src.cols * scale), cvRound(src.rows * scale)), cv::INTER_AREA);
+    } else {
+        src.copyTo(small);
+    }
+    if (small.channels() == 1) {
+        small.copyTo(gray);
+    } else {
+        cv::cvtColor(small, gray, small.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+    }
+    cv::GaussianBlur(gray, gray, cv::Size(5, 5), 0);
+    cv::Canny(gray, edges, 50, 150);
+    cv::Mat closed;
+    morph_dilate(edges, closed, rect_kernel(3), 1);
+
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(closed, contours, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+
+    const double imageArea = (double)gray.cols * gray.rows;
+    std::vector<std::pair<double, size_t>> byArea;
+    for (size_t i = 0; i < contours.size(); i++) {
+        double area = cv::contourArea(contours[i]);
+        if (area >= imageArea * 0.1) byArea.push_back({area, i});
+    }
+    std::sort(byArea.begin(), byArea.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    if (byArea.size() > 5) byArea.resize(5);
+
+    double bestScore = 0;
+    std::vector<cv::Point2f> best;
+    for (const auto& entry : byArea) {
+        const std::vector<cv::Point>& contour = contours[entry.second];
+        std::vector<cv::Point> approx;
+        cv::approxPolyDP(contour, approx, 0.02 * cv::arcLength(contour, true), true);
+        std::vector<cv::Point2f> quad;
+        if (approx.size() == 4 && cv::isContourConvex(approx)) {
+            for (const cv::Point& p : approx) quad.push_back(cv::Point2f((float)p.x, (float)p.y));
+        } else {
+            // 꼭짓점이 가려진 경우 최소 외접 사각형으로 대체 (신뢰도는 엣지 지지율로 낮아짐)
+            cv::Point2f box[4];
+            cv::minAreaRect(contour).points(box);
+            quad.assign(box, box + 4);
+        }
+        order_quad(quad);
+        double areaScore = std::min(1.0, cv::contourArea(quad) / (imageArea * 0.5));
+        double score = 0.5 * quad_edge_support(edges, quad) + 0.3 * quad_angle_score(quad) + 0.2 * areaScore;
+        if (score > bestScore) {
+            bestScore = score;
+            best = quad;
+        }
+    }
+    if (best.empty()) return 0;
+
+    for (int i = 0; i < 4; i++) {
+        outQuad[i * 2] = (float)(best[i].x / scale);
+        outQuad[i * 2 + 1] = (float)(best[i].y / scale);
+    }
+    return bestScore;
 }
 
-FFI_PLUGIN_EXPORT int cv_mat_width(CvMat* mat) {
-    if (mat == nullptr) return 0;
-    return ((cv::Mat*)mat)->cols;
+FFI_PLUGIN_EXPORT int cv_document_refine(CvMat* mat, float* quad, int searchRadius) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || quad == nullptr) return 0;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (src.empty() || src.depth() != CV_8U) return 0;
+    if (searchRadius <= 0) searchRadius = 15;
+
+    // 전체 영상 대신 각 꼭짓점 주변 ROI 만 그레이스케일로 변환
+    const cv::Rect bounds(0, 0, src.cols, src.rows);
+    const cv::TermCriteria criteria(cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 30, 0.01);
+    for (int i = 0; i < 4; i++) {
+        cv::Point2f p(quad[i * 2], quad[i * 2 + 1]);
+        int margin = searchRadius * 2;
+        cv::Rect roi = cv::Rect(cvRound(p.x) - margin, cvRound(p.y) - margin, margin * 2 + 1, margin * 2 + 1) & bounds;
+        if (roi.width <= searchRadius * 2 + 5 || roi.height <= searchRadius * 2 + 5) continue;
+        cv::Mat patch;
+        if (src.channels() == 1) {
+            patch = src(roi);
+        } else {
+            cv::cvtColor(src(roi), patch, src.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+        }
+        std::vector<cv::Point2f> corner = {p - cv::Point2f((float)roi.x, (float)roi.y)};
+        cv::cornerSubPix(patch, corner, cv::Size(searchRadius, searchRadius), cv::Size(-1, -1), criteria);
+        cv::Point2f refined = corner[0] + cv::Point2f((float)roi.x, (float)roi.y);
+        // 탐색 반경 밖으로 벗어나면 검출 결과를 유지
+        if (cv::norm(refined - p) <= searchRadius) {
+            quad[i * 2] = refined.x;
+            quad[i * 2 + 1] = refined.y;
+        }
+    }
+    return 1;
 }
 
-FFI_PLUGIN_EXPORT int cv_mat_height(CvMat* mat) {
-    if (mat == nullptr) return 0;
-    return ((cv::Mat*)mat)->rows;
+FFI_PLUGIN_EXPORT CvMat* cv_document_warp(CvMat* mat, const float* quad, int outWidth, int outHeight) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || quad == nullptr) return nullptr;
+    cv::Mat src = *(cv::Mat*)mat;
+    if (src.empty()) return nullptr;
+    cv::Point2f from[4];
+    for (int i = 0; i < 4; i++) from[i] = cv::Point2f(quad[i * 2], quad[i * 2 + 1]);
+    // 0 이면 마주 보는 변 중 긴 쪽 길이로 출력 크기 결정
+    if (outWidth <= 0) outWidth = (int)std::max(cv::norm(from[1] - from[0]), cv::norm(from[2] - from[3]));
+    if (outHeight <= 0) outHeight = (int)std::max(cv::norm(from[3] - from[0]), cv::norm(from[2] - from[1]));
+    if (outWidth <= 0 || outHeight <= 0) return nullptr;
+    cv::Point2f to[4] = {
+        cv::Point2f(0, 0),
+        cv::Point2f((float)(outWidth - 1), 0),
+        cv::Point2f((float)(outWidth - 1), (float)(outHeight - 1)),
+        cv::Point2f(0, (float)(outHeight - 1)),
+    };
+    cv::Mat m = cv::getPerspectiveTransform(from, to);
+    cv::Mat dst;
+    cv::warpPerspective(src, dst, m, cv::Size(outWidth, outHeight), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    return (CvMat*)new cv::Mat(dst);
 }
 
-FFI_PLUGIN_EXPORT int cv_mat_channels(CvMat* mat) {
-    if (mat == nullptr) return 0;
-    return ((cv::Mat*)mat)->channels();
+// 히스토그램
+namespace {
+
+// 8비트 영상의 채널별 256단계 히스토그램 (counts: channels * 256)
+// 행 스트립마다 부분 히스토그램을 만든 뒤 합쳐 스레드 간 경합이 없음
+void histogram_8u(const cv::Mat& src, const cv::Mat& mask, std::vector<unsigned>& counts) {
+    const int cn = src.channels();
+    const int bins = cn * 256;
+    const int stripes = std::max(1, std::min(src.rows, cv::getNumThreads() * 4));
+    std::vector<unsigned> partial((size_t)stripes * bins, 0);
+    cv::parallel_for_(cv::Range(0, stripes), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("histogram_8u chunk");
+        for (int t = range.start; t < range.end; t++) {
+            unsigned* h = &partial[(size_t)t * bins];
+            const int y0 = src.rows * t / stripes;
+            const int y1 = src.rows * (t + 1) / stripes;
+            for (int y = y0; y < y1; y++) {
+                const uchar* s = src.ptr<uchar>(y);
+                const uchar* m = mask.empty() ? nullptr : mask.ptr<uchar>(y);
+                if (cn == 1 && m == nullptr) {
+                    for (int x = 0; x < src.cols; x++) h[s[x]]++;
+                    continue;
+                }
+                for (int x = 0; x < src.cols; x++) {
+                    if (m != nullptr && m[x] == 0) continue;
+                    for (int c = 0; c < cn; c++) h[c * 256 + s[x * cn + c]]++;
+                }
+            }
+        }
+    });
+    counts.assign(bins, 0);
+    for (int t = 0; t < stripes; t++) {
+        const unsigned* h = &partial[(size_t)t * bins];
+        for (int i = 0; i < bins; i++) counts[i] += h[i];
+    }
 }
 
-FFI_PLUGIN_EXPORT const uint8_t* cv_mat_data(CvMat* mat) {
+// cv::equalizeHist 와 같은 누적 분포 LUT
+void equalize_lut(const unsigned* hist, unsigned total, uchar* lut) {
+    int first = 0;
+    while (first < 255 && hist[first] == 0) first++;
+    if (hist[first] == total) {
+        for (int i = 0; i < 256; i++) lut[i] = (uchar)first;
+        return;
+    }
+    const float scale = 255.0f / (float)(total - hist[first]);
+    unsigned sum = 0;
+    for (int i = 0; i < 256; i++) {
+        if (i > first) sum += hist[i];
+        lut[i] = cv::saturate_cast<uchar>(sum * scale);
+    }
+}
+
+// YCrCb 에서 Y 만 바꾼 뒤 BGR 로 되돌리면 세 채널에 같은 변화량이 더해지므로,
+// 분리/병합 없이 dst = src + (lut[Y] - Y) 한 패스로 처리 (알파 채널은 그대로)
+void apply_luma_lut(const cv::Mat& src, const cv::Mat& luma, const uchar* lut, cv::Mat& dst) {
+    dst.create(src.size(), src.type());
+    const int cn = src.channels();
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("apply_luma_lut chunk");
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* s = src.ptr<uchar>(y);
+            const uchar* l = luma.ptr<uchar>(y);
+            uchar* d = dst.ptr<uchar>(y);
+            for (int x = 0; x < src.cols; x++) {
+                const int delta = (int)lut[l[x]] - (int)l[x];
+                for (int c = 0; c < 3; c++) d[x * cn + c] = cv::saturate_cast<uchar>(s[x * cn + c] + delta);
+                if (cn == 4) d[x * cn + 3] = s[x * cn + 3];
+            }
+        }
+    });
+}
+
+// 변환 전후의 밝기 영상으로 같은 방식의 변화량 적용
+void apply_luma_delta(const cv::Mat& src, const cv::Mat& luma, const cv::Mat& mapped, cv::Mat& dst) {
+    dst.create(src.size(), src.type());
+    const int cn = src.channels();
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("apply_luma_delta chunk");
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* s = src.ptr<uchar>(y);
+            const uchar* l = luma.ptr<uchar>(y);
+            const uchar* m = mapped.ptr<uchar>(y);
+            uchar* d = dst.ptr<uchar>(y);
+            for (int x = 0; x < src.cols; x++) {
+                const int delta = (int)m[x] - (int)l[x];
+                for (int c = 0; c < 3; c++) d[x * cn + c] = cv::saturate_cast<uchar>(s[x * cn + c] + delta);
+                if (cn == 4) d[x * cn + 3] = s[x * cn + 3];
+            }
+        }
+    });
+}
+
+void to_luma(const cv::Mat& src, cv::Mat& luma) {
+    cv::cvtColor(src, luma, src.channels() == 4 ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY);
+}
+
+// 프레임 간 재사용하는 CLAHE 와 밝기 버퍼
+struct ClaheContext {
+    cv::Ptr<cv::CLAHE> clahe;
+    cv::Mat luma;
+    cv::Mat mapped;
+};
+
+} // namespace
+
+FFI_PLUGIN_EXPORT int cv_calc_hist(CvMat* mat, int channel, int bins, float rangeMin, float rangeMax, CvMat* mask, float* outHist) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || outHist == nullptr || bins <= 0 || rangeMax <= rangeMin) return 0;
+    const cv::Mat& src = *(cv::Mat*)mat;
+    if (src.empty()) return 0;
+    cv::Mat m = mask != nullptr ? *(cv::Mat*)mask : cv::Mat();
+    if (!m.empty() && (m.size() != src.size() || m.type() != CV_8UC1)) return 0;
+    const int cn = src.channels();
+    if (channel >= cn) return 0;
+    const int first = channel < 0 ? 0 : channel;
+    const int last = channel < 0 ? cn - 1 : channel;
+
+    if (src.depth() == CV_8U) {
+        // 256단계 카운트를 한 번에 구한 뒤 요청한 구간/개수로 접음
+        std::vector<unsigned> counts;
+        histogram_8u(src, m, counts);
+        for (int c = first; c <= last; c++) {
+            float* out = outHist + (size_t)(c - first) * bins;
+            std::fill(out, out + bins, 0.0f);
+            for (int v = 0; v < 256; v++) {
+                if (v < rangeMin || v >= rangeMax) continue;
+                int b = (int)((v - rangeMin) * bins / (rangeMax - rangeMin));
+                out[std::min(b, bins - 1)] += (float)counts[c * 256 + v];
+            }
+        }
+        return 1;
+    }
+
+    float range[] = {rangeMin, rangeMax};
+    const float* ranges[] = {range};
+    for (int c = first; c <= last; c++) {
+        cv::Mat hist;
+        cv::calcHist(&src, 1, &c, m, hist, 1, &bins, ranges);
+        std::copy(hist.ptr<float>(), hist.ptr<float>() + bins, outHist + (size_t)(c - first) * bins);
+    }
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_equalize_hist(CvMat* mat) {
+    CV_PROFILE_MAT(mat);
     if (mat == nullptr) return nullptr;
-    return ((cv::Mat*)mat)->data;
+    cv::Mat dst;
+    cv::Mat src = *(cv::Mat*)mat;
+    // 8비트 히스토그램/LUT 경로만 지원 (다른 깊이나 2 채널은 OpenCV 예외가 FFI 경계를 넘지 않도록 실패 처리)
+    if (src.depth() != CV_8U || (src.channels() != 1 && src.channels() != 3 && src.channels() != 4)) return nullptr;
+
+    // 그레이스케일인 경우
+    if (src.channels() == 1) {
+        cv::equalizeHist(src, dst);
+    } else {
+        // 컬러 이미지는 Y(밝기)만 평활화. 밝기 히스토그램 + 변화량 적용 두 패스
+        cv::Mat luma;
+        to_luma(src, luma);
+        std::vector<unsigned> hist;
+        histogram_8u(luma, cv::Mat(), hist);
+        uchar lut[256];
+        equalize_lut(hist.data(), (unsigned)luma.total(), lut);
+        apply_luma_lut(src, luma, lut, dst);
+    }
+    return (CvMat*)new cv::Mat(dst);
 }
 
-FFI_PLUGIN_EXPORT CvVideoCapture* cv_videocapture_create(int index) {
-    cv::VideoCapture* cap = new cv::VideoCapture(index);
-    if (!cap->isOpened()) {
-        delete cap;
+// CLAHE
+FFI_PLUGIN_EXPORT CvClahe* cv_clahe_create(double clipLimit, int tilesX, int tilesY) {
+    CV_PROFILE();
+    if (tilesX <= 0 || tilesY <= 0) return nullptr;
+    ClaheContext* ctx = new ClaheContext();
+    ctx->clahe = cv::createCLAHE(clipLimit, cv::Size(tilesX, tilesY));
+    return (CvClahe*)ctx;
+}
+
+FFI_PLUGIN_EXPORT void cv_clahe_release(CvClahe* clahe) {
+    CV_PROFILE();
+    if (clahe != nullptr) {
+        delete (ClaheContext*)clahe;
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_clahe_set(CvClahe* clahe, double clipLimit, int tilesX, int tilesY) {
+    CV_PROFILE();
+    if (clahe == nullptr || tilesX <= 0 || tilesY <= 0) return;
+    ClaheContext* ctx = (ClaheContext*)clahe;
+    ctx->clahe->setClipLimit(clipLimit);
+    ctx->clahe->setTilesGridSize(cv::Size(tilesX, tilesY));
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_clahe_apply(CvClahe* clahe, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
+    if (clahe == nullptr || mat == nullptr) return nullptr;
+    ClaheContext* ctx = (ClaheContext*)clahe;
+    const cv::Mat& src = *(cv::Mat*)mat;
+    if (src.empty()) return nullptr;
+    cv::Mat dst;
+    if (src.channels() == 1) {
+        ctx->clahe->apply(src, dst);
+    } else if (src.depth() == CV_8U) {
+        // 컬러는 밝기에만 적용하고 변화량을 BGR 에 더함 (버퍼는 프레임 간 재사용)
+        to_luma(src, ctx->luma);
+        ctx->clahe->apply(ctx->luma, ctx->mapped);
+        apply_luma_delta(src, ctx->luma, ctx->mapped, dst);
+    } else {
         return nullptr;
     }
-    return (CvVideoCapture*)cap;
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 룩업 테이블
+namespace {
+
+// 톤 연산 체인을 채널별 256단계 테이블 하나로 합성. 연산은 float 테이블에 누적해 양자화 오차가 쌓이지 않고,
+// 적용 직전에만 8비트 테이블로 변환해 프레임 간 재사용
+struct ToneLut {
+    float table[4][256];
+    cv::Mat compiled; // 1x256, CV_8UC(cn)
+    int compiledChannels = 0;
+    bool dirty = true;
+    // 3D 색보정 격자 (size^3, BGR 순서 출력 0~255). 비어 있으면 사용 안 함
+    int gridSize = 0;
+    std::vector<float> grid;
+};
+
+void lut_reset(ToneLut* lut) {
+    for (int c = 0; c < 4; c++) {
+        for (int i = 0; i < 256; i++) lut->table[c][i] = (float)i;
+    }
+    lut->grid.clear();
+    lut->gridSize = 0;
+    lut->dirty = true;
 }
 
-FFI_PLUGIN_EXPORT void cv_videocapture_release(CvVideoCapture* cap) {
-    if (cap != nullptr) {
-        delete (cv::VideoCapture*)cap;
+// channel -1 이면 색상 채널(0~2)에 적용 (알파는 유지)
+template <typename Op>
+void lut_compose(ToneLut* lut, int channel, Op op) {
+    const int first = channel < 0 ? 0 : std::min(channel, 3);
+    const int last = channel < 0 ? 2 : std::min(channel, 3);
+    for (int c = first; c <= last; c++) {
+        for (int i = 0; i < 256; i++) {
+            lut->table[c][i] = std::min(255.0f, std::max(0.0f, (float)op(lut->table[c][i])));
+        }
     }
+    lut->dirty = true;
 }
 
-FFI_PLUGIN_EXPORT int cv_videocapture_read(CvVideoCapture* cap, CvMat* dst) {
-    if (cap == nullptr || dst == nullptr) return 0;
-    cv::Mat* frame = (cv::Mat*)dst;
-    if (((cv::VideoCapture*)cap)->read(*frame)) {
-        return 1;
+const cv::Mat& lut_compiled(ToneLut* lut, int cn) {
+    if (lut->dirty || lut->compiledChannels != cn) {
+        lut->compiled.create(1, 256, CV_8UC(cn));
+        uchar* d = lut->compiled.ptr<uchar>();
+        for (int i = 0; i < 256; i++) {
+            for (int c = 0; c < cn; c++) d[i * cn + c] = (uchar)cvRound(lut->table[c][i]);
+        }
+        lut->compiledChannels = cn;
+        lut->dirty = false;
     }
-    return 0;
+    return lut->compiled;
 }
 
-FFI_PLUGIN_EXPORT double cv_videocapture_get(CvVideoCapture* cap, int propId) {
-    if (cap == nullptr) return 0.0;
-    return ((cv::VideoCapture*)cap)->get(propId);
+// 1D 톤 테이블을 격자 인덱스/가중치 테이블에 미리 합쳐 두고 픽셀마다 삼선형 보간
+void lut_apply_3d(ToneLut* lut, const cv::Mat& src, cv::Mat& dst) {
+    const int n = lut->gridSize;
+    const int cn = src.channels();
+    int idx[3][256];
+    float frac[3][256];
+    for (int c = 0; c < 3; c++) {
+        for (int v = 0; v < 256; v++) {
+            float pos = lut->table[c][v] * (n - 1) / 255.0f;
+            int i0 = std::min((int)pos, n - 2);
+            idx[c][v] = i0;
+            frac[c][v] = pos - i0;
+        }
+    }
+    const float* grid = lut->grid.data();
+    const int strideG = n * 3;
+    const int strideB = n * n * 3;
+    dst.create(src.size(), src.type());
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("lut_apply_3d chunk");
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* s = src.ptr<uchar>(y);
+            uchar* d = dst.ptr<uchar>(y);
+            for (int x = 0; x < src.cols; x++) {
+                const uchar b = s[x * cn], g = s[x * cn + 1], r = s[x * cn + 2];
+                const float fb = frac[0][b], fg = frac[1][g], fr = frac[2][r];
+                const float* p = grid + idx[0][b] * strideB + idx[1][g] * strideG + idx[2][r] * 3;
+                for (int c = 0; c < 3; c++) {
+                    float c00 = p[c] + (p[3 + c] - p[c]) * fr;
+                    float c01 = p[strideG + c] + (p[strideG + 3 + c] - p[strideG + c]) * fr;
+                    float c10 = p[strideB + c] + (p[strideB + 3 + c] - p[strideB + c]) * fr;
+                    float c11 = p[strideB + strideG + c] + (p[strideB + strideG + 3 + c] - p[strideB + strideG + c]) * fr;
+                    float c0 = c00 + (c01 - c00) * fg;
+                    float c1 = c10 + (c11 - c10) * fg;
+                    d[x * cn + c] = cv::saturate_cast<uchar>(c0 + (c1 - c0) * fb);
+                }
+                if (cn == 4) d[x * cn + 3] = cv::saturate_cast<uchar>(lut->table[3][s[x * cn + 3]]);
+            }
+        }
+    });
 }
 
-FFI_PLUGIN_EXPORT void cv_videocapture_set(CvVideoCapture* cap, int propId, double value) {
-    if (cap == nullptr) return;
-    ((cv::VideoCapture*)cap)->set(propId, value);
+} // namespace
+
+FFI_PLUGIN_EXPORT CvLut* cv_lut_create() {
+    CV_PROFILE();
+    ToneLut* lut = new ToneLut();
+    lut_reset(lut);
+    return (CvLut*)lut;
 }
 
-FFI_PLUGIN_EXPORT int cv_mat_data_len(CvMat* mat) {
-    if (mat == nullptr) return 0;
-    cv::Mat* m = (cv::Mat*)mat;
-    return m->total() * m->elemSize();
+FFI_PLUGIN_EXPORT void cv_lut_release(CvLut* lut) {
+    CV_PROFILE();
+    if (lut != nullptr) {
+        delete (ToneLut*)lut;
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_reset(CvLut* lut) {
+    CV_PROFILE();
+    if (lut == nullptr) return;
+    lut_reset((ToneLut*)lut);
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_brightness(CvLut* lut, int channel, double delta) {
+    CV_PROFILE();
+    if (lut == nullptr) return;
+    lut_compose((ToneLut*)lut, channel, [=](float v) { return v + delta; });
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_contrast(CvLut* lut, int channel, double factor, double pivot) {
+    CV_PROFILE();
+    if (lut == nullptr) return;
+    lut_compose((ToneLut*)lut, channel, [=](float v) { return (v - pivot) * factor + pivot; });
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_gamma(CvLut* lut, int channel, double gamma) {
+    CV_PROFILE();
+    if (lut == nullptr || gamma <= 0) return;
+    const double inv = 1.0 / gamma;
+    lut_compose((ToneLut*)lut, channel, [=](float v) { return 255.0 * std::pow(v / 255.0, inv); });
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_levels(CvLut* lut, int channel, double inBlack, double inWhite, double outBlack, double outWhite) {
+    CV_PROFILE();
+    if (lut == nullptr || inWhite <= inBlack) return;
+    lut_compose((ToneLut*)lut, channel, [=](float v) {
+        double t = std::min(1.0, std::max(0.0, (v - inBlack) / (inWhite - inBlack)));
+        return outBlack + t * (outWhite - outBlack);
+    });
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_curve(CvLut* lut, int channel, const float* points, int count) {
+    CV_PROFILE();
+    if (lut == nullptr || points == nullptr || count < 2) return;
+    // 제어점 (x, y) 을 x 순으로 정렬한 뒤 구간 선형 보간
+    std::vector<cv::Point2f> pts(count);
+    for (int i = 0; i < count; i++) pts[i] = cv::Point2f(points[i * 2], points[i * 2 + 1]);
+    std::sort(pts.begin(), pts.end(), [](const cv::Point2f& a, const cv::Point2f& b) { return a.x < b.x; });
+    float curve[256];
+    for (int v = 0; v < 256; v++) {
+        size_t k = 0;
+        while (k + 1 < pts.size() && pts[k + 1].x < v) k++;
+        if (v <= pts.front().x) {
+            curve[v] = pts.front().y;
+        } else if (k + 1 >= pts.size()) {
+            curve[v] = pts.back().y;
+        } else {
+            float span = pts[k + 1].x - pts[k].x;
+            float t = span > 0 ? (v - pts[k].x) / span : 0.0f;
+            curve[v] = pts[k].y + (pts[k + 1].y - pts[k].y) * t;
+        }
+    }
+    lut_compose((ToneLut*)lut, channel, [&](float v) {
+        int i0 = std::min((int)v, 254);
+        float t = v - i0;
+        return curve[i0] + (curve[i0 + 1] - curve[i0]) * t;
+    });
+}
+
+FFI_PLUGIN_EXPORT void cv_lut_table(CvLut* lut, int channel, const uint8_t* table) {
+    CV_PROFILE();
+    if (lut == nullptr || table == nullptr) return;
+    lut_compose((ToneLut*)lut, channel, [=](float v) {
+        int i0 = std::min((int)v, 254);
+        float t = v - i0;
+        return table[i0] + (table[i0 + 1] - table[i0]) * t;
+    });
+}
+
+FFI_PLUGIN_EXPORT int cv_lut_set_3d(CvLut* lut, const float* data, int size) {
+    CV_PROFILE();
+    if (lut == nullptr) return 0;
+    ToneLut* t = (ToneLut*)lut;
+    if (data == nullptr || size < 2) {
+        t->grid.clear();
+        t->gridSize = 0;
+        return 1;
+    }
+    // 입력은 .cube 순서 (R 이 가장 빠르게 변함, RGB 0~1). 내부는 [b][g][r] 격자의 BGR 0~255
+    const size_t cells = (size_t)size * size * size;
+    t->grid.resize(cells * 3);
+    for (size_t i = 0; i < cells; i++) {
+        t->grid[i * 3] = data[i * 3 + 2] * 255.0f;
+        t->grid[i * 3 + 1] = data[i * 3 + 1] * 255.0f;
+        t->grid[i * 3 + 2] = data[i * 3] * 255.0f;
+    }
+    t->gridSize = size;
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_lut_apply(CvLut* lut, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
+    if (lut == nullptr || mat == nullptr) return nullptr;
+    ToneLut* t = (ToneLut*)lut;
+    const cv::Mat& src = *(cv::Mat*)mat;
+    if (src.empty() || src.depth() != CV_8U) return nullptr;
+    cv::Mat dst;
+    if (t->gridSize > 0 && src.channels() >= 3) {
+        lut_apply_3d(t, src, dst);
+    } else {
+        cv::LUT(src, lut_compiled(t, src.channels()), dst);
+    }
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 옵티컬 플로우
+namespace {
+
+// 이전 프레임의 LK 피라미드를 보관해 다음 프레임에서 다시 만들지 않는 추적기
+// 피라미드 / 그레이 버퍼는 두 벌을 번갈아 써서 해상도가 같으면 재할당이 없음
+struct FlowTracker {
+    cv::Size winSize;
+    int maxLevel;
+    cv::Mat gray[2];
+    std::vector<cv::Mat> pyramid[2];
+    int current = -1; // 마지막 프레임의 버퍼 인덱스 (-1: 아직 없음)
+    std::vector<cv::Point2f> prevPts, nextPts;
+    std::vector<uchar> status;
+    std::vector<float> err;
+};
+
+void to_gray(const cv::Mat& src, cv::Mat& gray) {
+    if (src.channels() == 1) {
+        src.copyTo(gray);
+    } else {
+        to_luma(src, gray);
+    }
+}
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvFlowTracker* cv_flow_tracker_create(int winSize, int maxLevel) {
+    CV_PROFILE();
+    FlowTracker* t = new FlowTracker();
+    t->winSize = cv::Size(winSize > 0 ? winSize : 21, winSize > 0 ? winSize : 21);
+    t->maxLevel = maxLevel >= 0 ? maxLevel : 3;
+    return (CvFlowTracker*)t;
+}
+
+FFI_PLUGIN_EXPORT void cv_flow_tracker_release(CvFlowTracker* tracker) {
+    CV_PROFILE();
+    if (tracker != nullptr) {
+        delete (FlowTracker*)tracker;
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_flow_tracker_reset(CvFlowTracker* tracker) {
+    CV_PROFILE();
+    if (tracker == nullptr) return;
+    ((FlowTracker*)tracker)->current = -1;
+}
+
+FFI_PLUGIN_EXPORT int cv_flow_tracker_track(CvFlowTracker* tracker, CvMat* mat, const float* points, int count, float* outPoints, uint8_t* outStatus, float* outError) {
+    CV_PROFILE_MAT(mat);
+    if (tracker == nullptr || mat == nullptr) return 0;
+    FlowTracker* t = (FlowTracker*)tracker;
+    const cv::Mat& src = *(cv::Mat*)mat;
+    if (src.empty() || src.depth() != CV_8U) return 0;
+
+    const int next = t->current < 0 ? 0 : 1 - t->current;
+    to_gray(src, t->gray[next]);
+    cv::buildOpticalFlowPyramid(t->gray[next], t->pyramid[next], t->winSize, t->maxLevel);
+    // 이전 프레임이 없거나 해상도가 바뀌면 피라미드만 저장
+    const bool tracked = t->current >= 0 && t->gray[t->current].size() == t->gray[next].size() && count > 0 && points != nullptr;
+    if (tracked) {
+        t->prevPts.resize(count);
+        for (int i = 0; i < count; i++) t->prevPts[i] = cv::Point2f(points[i * 2], points[i * 2 + 1]);
+        cv::calcOpticalFlowPyrLK(t->pyramid[t->current], t->pyramid[next], t->prevPts, t->nextPts, t->status, t->err, t->winSize, t->maxLevel,
+                                 cv::TermCriteria(cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 30, 0.01));
+        for (int i = 0; i < count; i++) {
+            if (outPoints != nullptr) {
+                outPoints[i * 2] = t->nextPts[i].x;
+                outPoints[i * 2 + 1] = t->nextPts[i].y;
+            }
+            if (outStatus != nullptr) outStatus[i] = t->status[i];
+            if (outError != nullptr) outError[i] = t->err[i];
+        }
+    }
+    t->current = next;
+    return tracked ? 1 : 0;
+}
+
+FFI_PLUGIN_EXPORT int cv_flow_tracker_detect(CvFlowTracker* tracker, int maxCorners, double quality, double minDistance, float* outPoints) {
+    CV_PROFILE();
+    if (tracker == nullptr || outPoints == nullptr || maxCorners <= 0) return 0;
+    FlowTracker* t = (FlowTracker*)tracker;
+    if (t->current < 0) return 0;
+    // 마지막 프레임에서 추적할 코너 검출
+    std::vector<cv::Point2f> corners;
+    cv::goodFeaturesToTrack(t->gray[t->current], corners, maxCorners, quality, minDistance);
+    for (size_t i = 0; i < corners.size(); i++) {
+        outPoints[i * 2] = corners[i].x;
+        outPoints[i * 2 + 1] = corners[i].y;
+    }
+    return (int)corners.size();
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_optical_flow_dense(CvMat* prev, CvMat* next, int method, int preset) {
+    CV_PROFILE_MAT(prev);
+    if (prev == nullptr || next == nullptr) return nullptr;
+    const cv::Mat& a = *(cv::Mat*)prev;
+    const cv::Mat& b = *(cv::Mat*)next;
+    if (a.empty() || a.size() != b.size() || a.depth() != CV_8U || b.depth() != CV_8U) return nullptr;
+    thread_local cv::Mat grayA, grayB;
+    to_gray(a, grayA);
+    to_gray(b, grayB);
+    cv::Mat flow;
+    if (method == 1) {
+        cv::calcOpticalFlowFarneback(grayA, grayB, flow, 0.5, 3, 15, 3, 5, 1.2, 0);
+    } else {
+        // DIS 인스턴스는 내부 버퍼를 유지하므로 스레드별로 재사용 (프리셋이 바뀔 때만 재생성)
+        thread_local cv::Ptr<cv::DISOpticalFlow> dis;
+        thread_local int disPreset = -1;
+        if (!dis || disPreset != preset) {
+            dis = cv::DISOpticalFlow::create(preset);
+            disPreset = preset;
+        }
+        dis->calc(grayA, grayB, flow);
+    }
+    return (CvMat*)new cv::Mat(flow);
+}
+
+// 노이즈 제거
+FFI_PLUGIN_EXPORT CvMat* cv_fast_nl_means_denoising(CvMat* mat, float h, int templateWindowSize, int searchWindowSize) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return nullptr;
+    cv::Mat dst;
+    cv::fastNlMeansDenoising(*(cv::Mat*)mat, dst, h, templateWindowSize, searchWindowSize);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_fast_nl_means_denoising_colored(CvMat* mat, float h, float hColor, int templateWindowSize, int searchWindowSize) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return nullptr;
+    cv::Mat dst;
+    cv::fastNlMeansDenoisingColored(*(cv::Mat*)mat, dst, h, hColor, templateWindowSize, searchWindowSize);
+    return (CvMat*)new cv::Mat(dst);
+}
+
+// 컨투어
+FFI_PLUGIN_EXPORT struct ContoursResult cv_find_contours(CvMat* mat, int mode, int method) {
+    CV_PROFILE_MAT(mat);
+    struct ContoursResult result = {nullptr, nullptr, 0};
+    if (mat == nullptr) return result;
+    
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(*(cv::Mat*)mat, contours, mode, method);
+    
+    result.num_contours = contours.size();
+    if (result.num_contours == 0) return result;
+    
+    result.contours = (int**)malloc(sizeof(int*) * result.num_contours);
+    result.contour_sizes = (int*)malloc(sizeof(int) * result.num_contours);
+    
+    for (int i = 0; i < result.num_contours; i++) {
+        result.contour_sizes[i] = contours[i].size();
+        result.contours[i] = (int*)malloc(sizeof(int) * 2 * contours[i].size());
+        for (size_t j = 0; j < contours[i].size(); j++) {
+            result.contours[i][j * 2] = contours[i][j].x;
+            result.contours[i][j * 2 + 1] = contours[i][j].y;
+        }
+    }
+    
+    return result;
+}
+
+FFI_PLUGIN_EXPORT void cv_free_contours(struct ContoursResult result) {
+    CV_PROFILE();
+    if (result.contours != nullptr) {
+        for (int i = 0; i < result.num_contours; i++) {
+            free(result.contours[i]);
+        }
+        free(result.contours);
+    }
+    if (result.contour_sizes != nullptr) {
+        free(result.contour_sizes);
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_draw_contours(CvMat* mat, struct ContoursResult contours, int contourIdx, int r, int g, int b, int thickness) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr || contours.contours == nullptr) return;
+    
+    std::vector<std::vector<cv::Point>> cvContours;
+    for (int i = 0; i < contours.num_contours; i++) {
+        std::vector<cv::Point> contour;
+        for (int j = 0; j < contours.contour_sizes[i]; j++) {
+            contour.push_back(cv::Point(
+                contours.contours[i][j * 2],
+                contours.contours[i][j * 2 + 1]
+            ));
+        }
+        cvContours.push_back(contour);
+    }
+    
+    cv::drawContours(*(cv::Mat*)mat, cvContours, contourIdx, cv::Scalar(b, g, r), thickness);
+}
+
+FFI_PLUGIN_EXPORT void cv_rectangle(CvMat* mat, int x, int y, int width, int height, int r, int g, int b, int thickness) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return;
+    cv::rectangle(*(cv::Mat*)mat, cv::Rect(x, y, width, height), cv::Scalar(b, g, r), thickness);
+}
+
+FFI_PLUGIN_EXPORT void cv_circle(CvMat* mat, int centerX, int centerY, int radius, int r, int g, int b, int thickness) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return;
+    cv::circle(*(cv::Mat*)mat, cv::Point(centerX, centerY), radius, cv::Scalar(b, g, r), thickness);
+}
+
+FFI_PLUGIN_EXPORT void cv_line(CvMat* mat, int x1, int y1, int x2, int y2, int r, int g, int b, int thickness) {
+    CV_PROFILE_MAT(mat);
+    if (mat == nullptr) return;
+    cv::line(*(cv::Mat*)mat, cv::Point(x1, y1), cv::Point(x2, y2), cv::Scalar(b, g, r), thickness);
+}
+
+// Mat 속성 접근자는 ffigen 에서 leaf 호출로 선언되어 있으므로 CV_PROFILE 을 두지 않음.
+// 계측 스코프는 스레드별 첫 호출에서 슬롯을 할당하고 g_profileLock 을 잡기 때문에 leaf 호출 안에서 블로킹할 수 있음
+FFI_PLUGIN_EXPORT int cv_mat_width(CvMat* mat) {
+    if (mat == nullptr) return 0;
+    return ((cv::Mat*)mat)->cols;
+}
+
+FFI_PLUGIN_EXPORT int cv_mat_height(CvMat* mat) {
+    if (mat == nullptr) return 0;
+    return ((cv::Mat*)mat)->rows;
+}
+
+FFI_PLUGIN_EXPORT int cv_mat_channels(CvMat* mat) {
+    if (mat == nullptr) return 0;
+    return ((cv::Mat*)mat)->channels();
+}
+
+FFI_PLUGIN_EXPORT const uint8_t* cv_mat_data(CvMat* mat) {
+    if (mat == nullptr) return nullptr;
+    return ((cv::Mat*)mat)->data;
+}
+
+namespace {
+
+// 프레임 이력을 미리 할당된 링 버퍼에 유지하는 시간적 노이즈 제거기
+struct TemporalDenoiser {
+    int mode;             // 0: 움직임 적응형 재귀 평균, 1: 멀티 프레임 NL-Means
+    int windowSize;       // 멀티 프레임 모드의 시간 창 크기 (홀수)
+    float h;
+    int motionThreshold;
+    uint16_t weights[256]; // 프레임 차이별 재귀 평균 가중치 (8비트 고정소수점)
+
+    std::vector<cv::Mat> ring;    // 멀티 프레임 모드의 프레임 이력
+    std::vector<cv::Mat> ordered; // 오래된 순서로 정렬한 ring 헤더 (픽셀 복사 없음)
+    int head = 0;
+    int filled = 0;
+    cv::Mat state;                // 재귀 평균 누적값 (CV_16U, 하위 8비트 소수부)
+};
+
+// 부분 샘플링 격자에서 프레임 통계를 계산하는 수집기 (결과는 고정 구조체에 덮어씀)
+struct FrameStatsCollector {
+    CvFrameStats stats;
+    int step;
+    int lowClip;
+    int highClip;
+};
+
+// 축소한 그레이 프레임에서 동작하는 움직임 검출기 (버퍼는 해상도가 바뀌지 않는 한 재사용)
+struct MotionDetector {
+    int method; // 0: 이동 평균 배경 차분, 1: MOG2, 2: KNN
+    int maxSide;
+    double learningRate;
+    int threshold;
+    int minArea;
+    cv::Ptr<cv::BackgroundSubtractor> subtractor;
+    cv::Mat small, gray, background, background8u, diff, mask, cleaned;
+    cv::Mat labels, componentStats, centroids;
+    double scale = 1.0;
+    double activity = 0.0;
+    std::vector<cv::Rect> boxes; // 원본 좌표
+};
+
+// 영상 안정화기. 연속 프레임 간 움직임을 축소 그레이에서 추정하고,
+// 누적 궤적을 앞뒤 radius 프레임 이동 평균으로 평활화해 보정 (출력은 radius 프레임 지연)
+struct VideoStabilizer {
+    int radius;
+    double zoom; // 보정으로 드러나는 가장자리를 가리기 위한 확대 비율
+    int maxSide;
+    // 움직임 추정용 버퍼 (두 벌을 번갈아 사용)
+    cv::Mat small, gray[2];
+    std::vector<cv::Mat> pyramid[2];
+    int current = -1;
+    double scale = 1.0;
+    std::vector<cv::Point2f> prevPts, nextPts, goodPrev, goodNext;
+    std::vector<uchar> status;
+    std::vector<float> err;
+    // 지연 버퍼: 프레임 radius + 1 장, 누적 궤적 (dx, dy, da) 2 * radius + 1 개
+    std::vector<cv::Mat> frames;
+    std::vector<cv::Vec3d> path;
+    cv::Vec3d cumulative;
+    long long received = 0;
+    double latencyMs = 0.0;
+};
+
+// 로그 구간 지연 히스토그램 (us). 2 배 구간마다 4 칸, 최대 약 16 초
+constexpr int kLatencyBuckets = 96;
+
+struct LatencyHistogram {
+    uint32_t buckets[kLatencyBuckets] = {};
+    int64_t count = 0;
+    int64_t sumUs = 0;
+    int64_t maxUs = 0;
+};
+
+int latency_bucket(int64_t us) {
+    if (us < 4) return (int)std::max<int64_t>(us, 0);
+    int msb = 2;
+    while (msb < 62 && (us >> (msb + 1)) != 0) msb++;
+    const int sub = (int)((us >> (msb - 2)) & 3);
+    return std::min(kLatencyBuckets - 1, 4 * (msb - 1) + sub);
+}
+
+// 칸의 상한 (us)
+int64_t latency_bucket_upper(int bucket) {
+    if (bucket < 4) return bucket;
+    const int msb = bucket / 4 + 1;
+    return ((int64_t)(4 + bucket % 4 + 1) << (msb - 2)) - 1;
+}
+
+void latency_record(LatencyHistogram& h, int64_t ns) {
+    const int64_t us = std::max<int64_t>(0, ns / 1000);
+    h.buckets[latency_bucket(us)]++;
+    h.count++;
+    h.sumUs += us;
+    h.maxUs = std::max(h.maxUs, us);
+}
+
+double latency_percentile_ms(const LatencyHistogram& h, double p) {
+    if (h.count == 0) return 0.0;
+    const int64_t rank = std::max<int64_t>(1, (int64_t)std::ceil(p * h.count));
+    int64_t seen = 0;
+    for (int i = 0; i < kLatencyBuckets; i++) {
+        seen += h.buckets[i];
+        if (seen >= rank) return std::min(latency_bucket_upper(i), h.maxUs) / 1000.0;
+    }
+    return h.maxUs / 1000.0;
+}
+
+// 디코드 큐의 프레임과 시각 정보
+struct DecodedFrame {
+    cv::Mat image;
+    CvFrameTiming timing = {-1, 0, 0, 0};
+};
+
+// 지연 통계 구간 (헤더의 CV_LATENCY_* 와 같은 순서)
+constexpr int kLatencyStages = 4;
+
+// VideoCapture 와 부착된 프레임 처리 단계
+struct VideoCaptureContext {
+    cv::VideoCapture capture;
+    std::mutex captureLock; // capture 접근 보호 (디코드 스레드와 get/set/seek)
+    int stride = 1; // N 프레임마다 한 장만 디코드
+    int pendingSkip = 0; // 다음 디코드 전에 건너뛸 프레임 수
+    long long decodeIndex = 0; // capture 가 다음에 내놓을 프레임 번호
+    long long frameCount = 0; // 파일을 연 시점의 전체 프레임 수 (모르면 0)
+    // 시각 기록. inflight 는 지연 단계 (안정화기) 를 거치는 동안 대기 중인 프레임의 시각
+    std::deque<CvFrameTiming> inflight;
+    CvFrameTiming last = {-1, 0, 0, 0}; // 마지막 read 로 반환된 프레임
+    std::mutex latencyLock;
+    LatencyHistogram latency[kLatencyStages];
+    // 비동기 디코드 (queueCapacity > 0 일 때 사용)
+    std::thread decoder;
+    std::mutex queueLock;
+    std::condition_variable queueReady, queueSpace;
+    std::deque<DecodedFrame> queue;
+    std::vector<cv::Mat> pool; // 소비된 프레임 버퍼 재사용
+    size_t queueCapacity = 0;
+    long long generation = 0; // seek 마다 증가. 이전 세대에서 디코드된 프레임은 버림
+    bool stopping = false;
+    bool eof = false;
+    RemapCache* remap = nullptr;
+    TemporalDenoiser* denoiser = nullptr;
+    FrameStatsCollector* stats = nullptr;
+    MotionDetector* motion = nullptr;
+    VideoStabilizer* stabilizer = nullptr;
+    cv::Mat raw; // 처리 단계가 있을 때 사용하는 수신 버퍼
+    cv::Mat remapped; // 리맵 뒤에 다른 단계가 이어질 때의 중간 버퍼
+    cv::Mat stabilized; // 안정화 뒤에 노이즈 제거가 이어질 때의 중간 버퍼
+};
+
+// 차이가 작을수록 이전 누적값을 신뢰하고, motionThreshold 이상이면 현재 프레임을 그대로 사용
+void denoiser_recursive(TemporalDenoiser* d, const cv::Mat& src, cv::Mat& dst) {
+    if (d->state.size() != src.size() || d->state.type() != CV_16UC(src.channels())) {
+        src.convertTo(d->state, CV_16U, 256.0);
+        src.copyTo(dst);
+        return;
+    }
+    dst.create(src.size(), src.type());
+
+    const int cols = src.cols * src.channels();
+    cv::parallel_for_(cv::Range(0, src.rows), [&](const cv::Range& range) {
+        CV_TRACE_SPAN("denoiser_recursive chunk");
+        for (int y = range.start; y < range.end; y++) {
+            const uchar* s = src.ptr<uchar>(y);
+            ushort* acc = d->state.ptr<ushort>(y);
+            uchar* o = dst.ptr<uchar>(y);
+            for (int x = 0; x < cols; x++) {
+                int diff = (s[x] << 8) - acc[x];
+                int next = acc[x] + ((diff * d->weights[std::abs(diff) >> 8]) >> 8);
+                acc[x] = (ushort)next;
+                o[x] = (uchar)((next + 128) >> 8);
+            }
+        }
+    });
+}
+
+// 시간 창의 가운데 프레임을 디노이즈하므로 출력은 windowSize / 2 프레임 지연됨.
+// 창이 찰 때까지는 출력할 프레임이 없어 0 (입력을 그대로 내보내면 창이 찬 뒤 가운데 프레임으로 되돌아가 순서가 뒤집힘)
+int denoiser_multi(TemporalDenoiser* d, const cv::Mat& src, cv::Mat& dst) {
+    if (d->ring[0].size() != src.size() || d->ring[0].type() != src.type()) {
+        for (cv::Mat& slot : d->ring) {
+            slot.create(src.size(), src.type());
+        }
+        d->head = 0;
+        d->filled = 0;
+    }
+    src.copyTo(d->ring[d->head]);
+    d->head = (d->head + 1) % d->windowSize;
+    if (d->filled < d->windowSize) d->filled++;
+
+    if (d->filled < d->windowSize) return 0;
+    for (int i = 0; i < d->windowSize; i++) {
+        d->ordered[i] = d->ring[(d->head + i) % d->windowSize];
+    }
+    int center = d->windowSize / 2;
+    if (src.channels() == 3) {
+        cv::fastNlMeansDenoisingColoredMulti(d->ordered, dst, center, d->windowSize, d->h, d->h);
+    } else {
+        cv::fastNlMeansDenoisingMulti(d->ordered, dst, center, d->windowSize, d->h);
+    }
+    return 1;
+}
+
+// 프레임 이력 초기화 (슬롯 버퍼는 재사용)
+void denoiser_reset(TemporalDenoiser* d) {
+    d->state.release();
+    d->head = 0;
+    d->filled = 0;
+}
+
+int denoiser_process(TemporalDenoiser* d, const cv::Mat& src, cv::Mat& dst) {
+    if (src.empty() || src.depth() != CV_8U) return 0;
+    if (d->mode == 1) return denoiser_multi(d, src, dst);
+    denoiser_recursive(d, src, dst);
+    return 1;
+}
+
+// step 간격 격자의 픽셀만 읽으므로 step 4 기준 전체 픽셀의 1/16 만 처리
+// 밝기는 BT.601 정수 근사 (29 B + 150 G + 77 R) >> 8
+int frame_stats_compute(FrameStatsCollector* c, const cv::Mat& src) {
+    if (src.empty() || src.depth() != CV_8U) return 0;
+    CvFrameStats& st = c->stats;
+    const int cn = src.channels();
+    const int step = c->step;
+    uint32_t hist[256] = {0};
+    uint64_t channelSum[4] = {0, 0, 0, 0};
+    uint64_t lumaSum = 0;
+    uint32_t samples = 0, low = 0, high = 0;
+    for (int y = step / 2; y < src.rows; y += step) {
+        const uchar* row = src.ptr<uchar>(y);
+        for (int x = step / 2; x < src.cols; x += step) {
+            const uchar* p = row + x * cn;
+            int luma;
+            if (cn >= 3) {
+                luma = (29 * p[0] + 150 * p[1] + 77 * p[2]) >> 8;
+            } else {
+                luma = p[0];
+            }
+            for (int ch = 0; ch < cn && ch < 4; ch++) channelSum[ch] += p[ch];
+            hist[luma]++;
+            lumaSum += luma;
+            low += luma <= c->lowClip ? 1 : 0;
+            high += luma >= c->highClip ? 1 : 0;
+            samples++;
+        }
+    }
+    if (samples == 0) return 0;
+
+    std::copy(hist, hist + 256, st.histogram);
+    st.samples = samples;
+    st.frameCount++;
+    st.meanLuma = (float)lumaSum / samples;
+    st.clipLow = (float)low / samples;
+    st.clipHigh = (float)high / samples;
+    for (int ch = 0; ch < 4; ch++) {
+        st.channelMeans[ch] = ch < cn ? (float)channelSum[ch] / samples : 0.0f;
+    }
+    // Gray-world: 세 채널 평균이 같아지도록 하는 채널별 게인
+    if (cn >= 3) {
+        float gray = (st.channelMeans[0] + st.channelMeans[1] + st.channelMeans[2]) / 3.0f;
+        for (int ch = 0; ch < 3; ch++) {
+            st.grayWorldGains[ch] = st.channelMeans[ch] > 0 ? gray / st.channelMeans[ch] : 1.0f;
+        }
+    } else {
+        st.grayWorldGains[0] = st.grayWorldGains[1] = st.grayWorldGains[2] = 1.0f;
+    }
+    return 1;
+}
+
+void motion_detector_reset(MotionDetector* m) {
+    m->background.release();
+    m->activity = 0.0;
+    m->boxes.clear();
+    if (m->method == 1) {
+        m->subtractor = cv::createBackgroundSubtractorMOG2(500, 16, false);
+    } else if (m->method == 2) {
+        m->subtractor = cv::createBackgroundSubtractorKNN(500, 400, false);
+    } else {
+        m->subtractor.reset();
+    }
+}
+
+int motion_detector_process(MotionDetector* m, const cv::Mat& src) {
+    if (src.empty() || src.depth() != CV_8U) return 0;
+    m->scale = std::min(1.0, (double)m->maxSide / std::max(src.cols, src.rows));
+    cv::Size size(std::max(1, cvRound(src.cols * m->scale)), std::max(1, cvRound(src.rows * m->scale)));
+    resize_image(src, m->small, size, cv::INTER_AREA);
+    if (m->small.channels() == 1) {
+        m->small.copyTo(m->gray);
+    } else {
+        to_luma(m->small, m->gray);
+    }
+    cv::GaussianBlur(m->gray, m->gray, cv::Size(5, 5), 0);
+
+    if (m->method == 0) {
+        // 첫 프레임 또는 해상도 변경 시 배경 초기화
+        if (m->background.size() != m->gray.size()) {
+            m->gray.convertTo(m->background, CV_32F);
+        }
+        m->background.convertTo(m->background8u, CV_8U);
+        cv::absdiff(m->gray, m->background8u, m->diff);
+        cv::threshold(m->diff, m->mask, m->threshold, 255, cv::THRESH_BINARY);
+        cv::accumulateWeighted(m->gray, m->background, m->learningRate);
+    } else {
+        m->subtractor->apply(m->gray, m->mask, m->learningRate);
+    }
+
+    // 작은 잡음을 열기 연산으로 제거한 뒤 연결 요소별 영역 추출
+    cv::Mat opened;
+    morph_erode(m->mask, opened, rect_kernel(3), 1);
+    morph_dilate(opened, m->cleaned, rect_kernel(3), 1);
+    m->activity = (double)cv::countNonZero(m->cleaned) / m->cleaned.total();
+
+    m->boxes.clear();
+    int n = cv::connectedComponentsWithStats(m->cleaned, m->labels, m->componentStats, m->centroids, 8, CV_32S);
+    const double inv = 1.0 / m->scale;
+    for (int i = 1; i < n; i++) {
+        const int* st = m->componentStats.ptr<int>(i);
+        if (st[cv::CC_STAT_AREA] < m->minArea) continue;
+        m->boxes.push_back(cv::Rect(cvFloor(st[cv::CC_STAT_LEFT] * inv), cvFloor(st[cv::CC_STAT_TOP] * inv),
+                                    cvCeil(st[cv::CC_STAT_WIDTH] * inv), cvCeil(st[cv::CC_STAT_HEIGHT] * inv)));
+    }
+    return 1;
+}
+
+void stabilizer_reset(VideoStabilizer* st) {
+    st->current = -1;
+    st->received = 0;
+    st->cumulative = cv::Vec3d(0, 0, 0);
+    st->frames.assign(st->radius + 1, cv::Mat());
+    st->path.assign(2 * st->radius + 1, cv::Vec3d(0, 0, 0));
+}
+
+// 직전 프레임 -> 현재 프레임의 이동 (dx, dy 는 원본 픽셀, da 는 라디안). 추정 실패 시 0
+cv::Vec3d stabilizer_estimate(VideoStabilizer* st, const cv::Mat& src) {
+    st->scale = std::min(1.0, (double)st->maxSide / std::max(src.cols, src.rows));
+    cv::Size size(std::max(1, cvRound(src.cols * st->scale)), std::max(1, cvRound(src.rows * st->scale)));
+    const int next = st->current < 0 ? 0 : 1 - st->current;
+    resize_image(src, st->small, size, cv::INTER_AREA);
+    if (st->small.channels() == 1) {
+        st->small.copyTo(st->gray[next]);
+    } else {
+        to_luma(st->small, st->gray[next]);
+    }
+    const cv::Size winSize(21, 21);
+    cv::buildOpticalFlowPyramid(st->gray[next], st->pyramid[next], winSize, 3);
+    const int prev = st->current;
+    st->current = next;
+    if (prev < 0 || st->gray[prev].size() != st->gray[next].size()) return cv::Vec3d(0, 0, 0);
+
+    cv::goodFeaturesToTrack(st->gray[prev], st->prevPts, 200, 0.01, 20);
+    if (st->prevPts.size() < 6) return cv::Vec3d(0, 0, 0);
+    cv::calcOpticalFlowPyrLK(st->pyramid[prev], st->pyramid[next], st->prevPts, st->nextPts, st->status, st->err, winSize, 3);
+    st->goodPrev.clear();
+    st->goodNext.clear();
+    for (size_t i = 0; i < st->status.size(); i++) {
+        if (!st->status[i]) continue;
+        st->goodPrev.push_back(st->prevPts[i]);
+        st->goodNext.push_back(st->nextPts[i]);
+    }
+    if (st->goodPrev.size() < 6) return cv::Vec3d(0, 0, 0);
+    cv::Mat m = cv::estimateAffinePartial2D(st->goodPrev, st->goodNext, cv::noArray(), cv::RANSAC);
+    if (m.empty()) return cv::Vec3d(0, 0, 0);
+    const double inv = 1.0 / st->scale;
+    return cv::Vec3d(m.at<double>(0, 2) * inv, m.at<double>(1, 2) * inv, std::atan2(m.at<double>(1, 0), m.at<double>(0, 0)));
+}
+
+// 프레임을 지연 버퍼에 넣고, radius 프레임 전의 프레임을 보정해 dst 에 기록. 아직 출력할 프레임이 없으면 0
+int stabilizer_process(VideoStabilizer* st, const cv::Mat& src, cv::Mat& dst) {
+    if (src.empty() || src.depth() != CV_8U) return 0;
+    const int64_t start = cv::getTickCount();
+    const int frameSlots = (int)st->frames.size();
+    const int pathSlots = (int)st->path.size();
+    if (st->received > 0 && st->frames[(st->received - 1) % frameSlots].size() != src.size()) {
+        stabilizer_reset(st); // 해상도가 바뀌면 궤적을 새로 시작
+    }
+
+    st->cumulative += stabilizer_estimate(st, src);
+    st->path[st->received % pathSlots] = st->cumulative;
+    src.copyTo(st->frames[st->received % frameSlots]); // 슬롯 버퍼 재사용
+    st->received++;
+    if (st->received <= st->radius) return 0;
+
+    // 출력 프레임 k 를 중심으로 [k - radius, k + radius] 궤적 평균 (앞쪽은 있는 만큼만)
+    const long long k = st->received - 1 - st->radius;
+    const long long first = std::max(0LL, k - st->radius);
+    cv::Vec3d smooth(0, 0, 0);
+    for (long long j = first; j < st->received; j++) smooth += st->path[j % pathSlots];
+    smooth *= 1.0 / (double)(st->received - first);
+    const cv::Vec3d diff = smooth - st->path[k % pathSlots];
+
+    const cv::Mat& frame = st->frames[k % frameSlots];
+    cv::Point2f center(frame.cols * 0.5f, frame.rows * 0.5f);
+    cv::Mat m = cv::getRotationMatrix2D(center, -diff[2] * 180.0 / CV_PI, st->zoom);
+    m.at<double>(0, 2) += diff[0];
+    m.at<double>(1, 2) += diff[1];
+    cv::warpAffine(frame, dst, m, frame.size(), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    st->latencyMs = (cv::getTickCount() - start) * 1000.0 / cv::getTickFrequency();
+    return 1;
+}
+
+// seek 시 백엔드 탐색 대신 grab 으로 전진할 최대 거리 (키프레임 간격 안쪽이면 이쪽이 쌈)
+constexpr long long kSeekGrabLimit = 64;
+
+// 건너뛸 프레임은 grab 만 하고 다음 프레임을 디코드. captureLock 을 잡은 상태에서 호출
+// 캡처 시각은 grab 이 끝난 시점 (retrieve 의 디코드/색 변환 시간은 제외)
+bool capture_decode(VideoCaptureContext* ctx, cv::Mat& out, CvFrameTiming& timing) {
+    CV_TRACE_SPAN("capture_decode");
+    for (; ctx->pendingSkip > 0; ctx->pendingSkip--) {
+        if (!ctx->capture.grab()) return false;
+        ctx->decodeIndex++;
+    }
+    if (!ctx->capture.grab()) return false;
+    timing.captureNs = monotonic_ns();
+    if (!ctx->capture.retrieve(out)) return false;
+    timing.frameIndex = ctx->decodeIndex++;
+    ctx->pendingSkip = ctx->stride - 1;
+    return true;
+}
+
+// 디코드 스레드. 큐가 가득 차거나 스트림이 끝나면 대기
+void capture_decode_loop(VideoCaptureContext* ctx) {
+    CV_TRACE_THREAD_NAME("cv_capture_decode");
+    for (;;) {
+        DecodedFrame item;
+        long long generation;
+        {
+            std::unique_lock<std::mutex> lock(ctx->queueLock);
+            ctx->queueSpace.wait(lock, [ctx] {
+                return ctx->stopping || (!ctx->eof && ctx->queue.size() < ctx->queueCapacity);
+            });
+            if (ctx->stopping) return;
+            if (!ctx->pool.empty()) {
+                item.image = std::move(ctx->pool.back());
+                ctx->pool.pop_back();
+            }
+        }
+        bool ok;
+        {
+            // seek 는 두 잠금을 모두 잡고 세대를 올리므로, captureLock 안에서 읽은 세대는 이 디코드 위치와 일치
+            std::lock_guard<std::mutex> lock(ctx->captureLock);
+            generation = ctx->generation;
+            ok = capture_decode(ctx, item.image, item.timing);
+        }
+        std::lock_guard<std::mutex> lock(ctx->queueLock);
+        if (generation != ctx->generation) {
+            ctx->pool.push_back(std::move(item.image)); // 디코드 도중 seek 됨
+            continue;
+        }
+        if (ok) {
+            ctx->queue.push_back(std::move(item));
+        } else {
+            ctx->eof = true;
+        }
+        ctx->queueReady.notify_all();
+    }
+}
+
+void capture_stop_decoder(VideoCaptureContext* ctx) {
+    if (!ctx->decoder.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(ctx->queueLock);
+        ctx->stopping = true;
+    }
+    ctx->queueSpace.notify_all();
+    ctx->decoder.join();
+}
+
+// 다음 프레임을 out 에 받음. 비동기 모드에서는 큐에서 꺼내고,
+// recycle 이면 out 이 쓰던 버퍼를 디코드 스레드에 돌려줌 (호출자 Mat 은 공유됐을 수 있어 내부 버퍼만)
+bool capture_next(VideoCaptureContext* ctx, cv::Mat& out, bool recycle) {
+    CvFrameTiming timing = {-1, 0, 0, 0};
+    if (ctx->queueCapacity == 0) {
+        std::lock_guard<std::mutex> lock(ctx->captureLock);
+        if (!capture_decode(ctx, out, timing)) return false;
+    } else {
+        std::unique_lock<std::mutex> lock(ctx->queueLock);
+        ctx->queueReady.wait(lock, [ctx] { return !ctx->queue.empty() || ctx->eof; });
+        if (ctx->queue.empty()) return false;
+        DecodedFrame& item = ctx->queue.front();
+        std::swap(out, item.image);
+        timing = item.timing;
+        if (recycle && !item.image.empty()) {
+            ctx->pool.push_back(std::move(item.image));
+        }
+        ctx->queue.pop_front();
+        ctx->queueSpace.notify_one();
+    }
+    timing.dequeueNs = monotonic_ns();
+    ctx->inflight.push_back(timing);
+    return true;
+}
+
+// 출력된 프레임의 시각을 확정하고 구간별 지연을 기록.
+// 안정화기는 radius 프레임, 멀티 프레임 디노이저는 windowSize / 2 프레임 전에 들어온 프레임을 출력함
+void capture_finish_timing(VideoCaptureContext* ctx) {
+    size_t delay = ctx->stabilizer != nullptr ? (size_t)ctx->stabilizer->radius : 0;
+    if (ctx->denoiser != nullptr && ctx->denoiser->mode == 1) delay += (size_t)(ctx->denoiser->windowSize / 2);
+    while (ctx->inflight.size() > delay + 1) ctx->inflight.pop_front();
+    if (ctx->inflight.empty()) return;
+    CvFrameTiming timing = ctx->inflight.front();
+    ctx->inflight.pop_front();
+    timing.processedNs = monotonic_ns();
+    std::lock_guard<std::mutex> lock(ctx->latencyLock);
+    ctx->last = timing;
+    latency_record(ctx->latency[CV_LATENCY_QUEUE], timing.dequeueNs - timing.captureNs);
+    latency_record(ctx->latency[CV_LATENCY_PROCESS], timing.processedNs - timing.dequeueNs);
+    latency_record(ctx->latency[CV_LATENCY_CAPTURE_TO_PROCESSED], timing.processedNs - timing.captureNs);
+}
+
+// 변환 단계 (리맵 -> 안정화 -> 노이즈 제거) 를 순서대로 적용. 마지막 단계는 바로 frame 에 기록
+int capture_transform(VideoCaptureContext* ctx, cv::Mat& frame) {
+    const cv::Mat* current = &ctx->raw;
+    if (ctx->remap != nullptr) {
+        cv::Mat& out = ctx->stabilizer != nullptr || ctx->denoiser != nullptr ? ctx->remapped : frame;
+        CV_TRACE_SPAN("capture_remap");
+        if (!remap_cache_apply(ctx->remap, *current, out)) return 0;
+        current = &out;
+    }
+    if (ctx->stabilizer != nullptr) {
+        cv::Mat& out = ctx->denoiser != nullptr ? ctx->stabilized : frame;
+        CV_TRACE_SPAN("capture_stabilize");
+        if (!stabilizer_process(ctx->stabilizer, *current, out)) return 0;
+        current = &out;
+    }
+    if (ctx->denoiser != nullptr) {
+        CV_TRACE_SPAN("capture_denoise");
+        return denoiser_process(ctx->denoiser, *current, frame);
+    }
+    return 1;
+}
+
+} // namespace
+
+FFI_PLUGIN_EXPORT CvVideoCapture* cv_videocapture_create(int index) {
+    CV_PROFILE();
+    VideoCaptureContext* ctx = new VideoCaptureContext();
+    if (!ctx->capture.open(index)) {
+        delete ctx;
+        return nullptr;
+    }
+    return (CvVideoCapture*)ctx;
+}
+
+FFI_PLUGIN_EXPORT CvVideoCapture* cv_videocapture_open(const char* path, int api, int queueSize, int stride) {
+    CV_PROFILE();
+    if (path == nullptr) return nullptr;
+    VideoCaptureContext* ctx = new VideoCaptureContext();
+    if (!ctx->capture.open(path, api)) {
+        delete ctx;
+        return nullptr;
+    }
+    ctx->stride = std::max(1, stride);
+    const double count = ctx->capture.get(cv::CAP_PROP_FRAME_COUNT);
+    ctx->frameCount = count > 0 ? (long long)count : 0; // 라이브 스트림은 0
+    if (queueSize > 0) {
+        ctx->queueCapacity = (size_t)queueSize;
+        ctx->decoder = std::thread(capture_decode_loop, ctx);
+    }
+    return (CvVideoCapture*)ctx;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_release(CvVideoCapture* cap) {
+    CV_PROFILE();
+    if (cap != nullptr) {
+        VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+        capture_stop_decoder(ctx);
+        delete ctx;
+    }
+}
+
+FFI_PLUGIN_EXPORT int cv_videocapture_read(CvVideoCapture* cap, CvMat* dst) {
+    CV_PROFILE_MAT(dst);
+    if (cap == nullptr || dst == nullptr) return 0;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    cv::Mat* frame = (cv::Mat*)dst;
+    const bool transforms = ctx->remap != nullptr || ctx->stabilizer != nullptr || ctx->denoiser != nullptr;
+    if (!transforms) {
+        if (!capture_next(ctx, *frame, false)) return 0;
+    } else {
+        // 안정화기는 radius 프레임, 멀티 프레임 디노이저는 창 전체가 쌓여야 출력하므로 처음에는 필요한 만큼 더 읽음
+        int attempts = 1;
+        if (ctx->stabilizer != nullptr) attempts += ctx->stabilizer->radius;
+        if (ctx->denoiser != nullptr && ctx->denoiser->mode == 1) attempts += ctx->denoiser->windowSize - 1;
+        int ok = 0;
+        while (!ok && attempts-- > 0) {
+            if (!capture_next(ctx, ctx->raw, true)) return 0;
+            ok = capture_transform(ctx, *frame);
+        }
+        if (!ok) return 0;
+    }
+    // 분석 단계는 최종 프레임을 읽기만 함
+    if (ctx->stats != nullptr) {
+        CV_TRACE_SPAN("capture_frame_stats");
+        frame_stats_compute(ctx->stats, *frame);
+    }
+    if (ctx->motion != nullptr) {
+        CV_TRACE_SPAN("capture_motion");
+        motion_detector_process(ctx->motion, *frame);
+    }
+    capture_finish_timing(ctx);
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT double cv_videocapture_get(CvVideoCapture* cap, int propId) {
+    CV_PROFILE();
+    if (cap == nullptr) return 0.0;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->captureLock);
+    return ctx->capture.get(propId);
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_set(CvVideoCapture* cap, int propId, double value) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->captureLock);
+    ctx->capture.set(propId, value);
+}
+
+FFI_PLUGIN_EXPORT int cv_videocapture_seek(CvVideoCapture* cap, int frameIndex) {
+    CV_PROFILE();
+    if (cap == nullptr || frameIndex < 0) return 0;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    long long target = frameIndex;
+    if (ctx->frameCount > 0 && target >= ctx->frameCount) return 0;
+
+    std::lock_guard<std::mutex> captureLock(ctx->captureLock);
+    {
+        // 큐에 남은 프레임은 버퍼 풀로 돌리고 디코드 중인 프레임은 세대 번호로 무효화
+        std::lock_guard<std::mutex> lock(ctx->queueLock);
+        ctx->generation++;
+        for (DecodedFrame& item : ctx->queue) {
+            ctx->pool.push_back(std::move(item.image));
+        }
+        ctx->queue.clear();
+        ctx->eof = false;
+    }
+    ctx->inflight.clear();
+    // 시간 단계에 쌓인 이전 위치의 프레임이 seek 뒤에 출력되지 않도록 초기화
+    if (ctx->stabilizer != nullptr) stabilizer_reset(ctx->stabilizer);
+    if (ctx->denoiser != nullptr) denoiser_reset(ctx->denoiser);
+    // 가까운 앞쪽이면 grab 으로 전진, 아니면 백엔드 탐색 (직전 키프레임부터 디코드)
+    int ok = 1;
+    const long long distance = target - ctx->decodeIndex;
+    if (distance >= 0 && distance <= kSeekGrabLimit) {
+        for (long long i = 0; i < distance && ok; i++) {
+            ok = ctx->capture.grab() ? 1 : 0;
+            if (ok) ctx->decodeIndex++;
+        }
+    } else {
+        ok = ctx->capture.set(cv::CAP_PROP_POS_FRAMES, (double)target) ? 1 : 0;
+        if (ok) ctx->decodeIndex = target;
+    }
+    ctx->pendingSkip = 0;
+    ctx->queueSpace.notify_all();
+    return ok;
+}
+
+FFI_PLUGIN_EXPORT int cv_videocapture_position(CvVideoCapture* cap) {
+    CV_PROFILE();
+    if (cap == nullptr) return -1;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->latencyLock);
+    return (int)ctx->last.frameIndex;
+}
+
+// leaf 호출이라 계측하지 않음 (cv_mat_width 참고)
+FFI_PLUGIN_EXPORT int64_t cv_monotonic_ns() {
+    return monotonic_ns();
+}
+
+FFI_PLUGIN_EXPORT int cv_videocapture_timing(CvVideoCapture* cap, struct CvFrameTiming* out) {
+    CV_PROFILE();
+    if (cap == nullptr || out == nullptr) return 0;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->latencyLock);
+    if (ctx->last.frameIndex < 0) return 0;
+    *out = ctx->last;
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_mark_done(CvVideoCapture* cap) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->latencyLock);
+    if (ctx->last.frameIndex < 0) return;
+    latency_record(ctx->latency[CV_LATENCY_END_TO_END], monotonic_ns() - ctx->last.captureNs);
+}
+
+FFI_PLUGIN_EXPORT int cv_videocapture_latency(CvVideoCapture* cap, int stage, struct CvLatencyStats* out) {
+    CV_PROFILE();
+    if (cap == nullptr || out == nullptr || stage < 0 || stage >= kLatencyStages) return 0;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->latencyLock);
+    const LatencyHistogram& h = ctx->latency[stage];
+    out->count = h.count;
+    out->meanMs = h.count > 0 ? (double)h.sumUs / h.count / 1000.0 : 0.0;
+    out->p50Ms = latency_percentile_ms(h, 0.50);
+    out->p95Ms = latency_percentile_ms(h, 0.95);
+    out->p99Ms = latency_percentile_ms(h, 0.99);
+    out->maxMs = h.maxUs / 1000.0;
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_latency_reset(CvVideoCapture* cap) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    VideoCaptureContext* ctx = (VideoCaptureContext*)cap;
+    std::lock_guard<std::mutex> lock(ctx->latencyLock);
+    for (LatencyHistogram& h : ctx->latency) h = LatencyHistogram();
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_set_denoiser(CvVideoCapture* cap, CvTemporalDenoiser* denoiser) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    ((VideoCaptureContext*)cap)->denoiser = (TemporalDenoiser*)denoiser;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_set_remap(CvVideoCapture* cap, CvRemapCache* cache) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    ((VideoCaptureContext*)cap)->remap = (RemapCache*)cache;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_set_frame_stats(CvVideoCapture* cap, CvFrameStatsCollector* collector) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    ((VideoCaptureContext*)cap)->stats = (FrameStatsCollector*)collector;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_set_motion_detector(CvVideoCapture* cap, CvMotionDetector* detector) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    ((VideoCaptureContext*)cap)->motion = (MotionDetector*)detector;
+}
+
+FFI_PLUGIN_EXPORT void cv_videocapture_set_stabilizer(CvVideoCapture* cap, CvStabilizer* stabilizer) {
+    CV_PROFILE();
+    if (cap == nullptr) return;
+    ((VideoCaptureContext*)cap)->stabilizer = (VideoStabilizer*)stabilizer;
+}
+
+// 시간적 노이즈 제거
+FFI_PLUGIN_EXPORT CvTemporalDenoiser* cv_temporal_denoiser_create(int mode, int windowSize, float h, float alpha, int motionThreshold) {
+    CV_PROFILE();
+    TemporalDenoiser* d = new TemporalDenoiser();
+    if (windowSize < 3) windowSize = 3;
+    if (windowSize % 2 == 0) windowSize++; // 홀수로 보정
+    if (motionThreshold < 1) motionThreshold = 1;
+    alpha = std::min(std::max(alpha, 0.0f), 1.0f);
+
+    d->mode = mode;
+    d->windowSize = windowSize;
+    d->h = h;
+    d->motionThreshold = motionThreshold;
+    d->ring.resize(windowSize);
+    d->ordered.resize(windowSize);
+
+    // 차이 0 에서 alpha, motionThreshold 이상에서 1.0 으로 선형 증가
+    int base = cvRound(alpha * 256);
+    for (int i = 0; i < 256; i++) {
+        int ramp = std::min(i, motionThreshold);
+        d->weights[i] = (uint16_t)(base + (256 - base) * ramp / motionThreshold);
+    }
+    return (CvTemporalDenoiser*)d;
+}
+
+FFI_PLUGIN_EXPORT void cv_temporal_denoiser_release(CvTemporalDenoiser* denoiser) {
+    CV_PROFILE();
+    if (denoiser != nullptr) {
+        delete (TemporalDenoiser*)denoiser;
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_temporal_denoiser_reset(CvTemporalDenoiser* denoiser) {
+    CV_PROFILE();
+    if (denoiser == nullptr) return;
+    denoiser_reset((TemporalDenoiser*)denoiser);
+}
+
+FFI_PLUGIN_EXPORT int cv_temporal_denoiser_process(CvTemporalDenoiser* denoiser, CvMat* src, CvMat* dst) {
+    CV_PROFILE_MAT(src);
+    if (denoiser == nullptr || src == nullptr || dst == nullptr) return 0;
+    return denoiser_process((TemporalDenoiser*)denoiser, *(cv::Mat*)src, *(cv::Mat*)dst);
+}
+
+// 프레임 통계
+FFI_PLUGIN_EXPORT CvFrameStatsCollector* cv_frame_stats_create(int step, int lowClip, int highClip) {
+    CV_PROFILE();
+    FrameStatsCollector* c = new FrameStatsCollector();
+    c->stats = CvFrameStats();
+    c->step = std::max(1, step);
+    c->lowClip = lowClip;
+    c->highClip = highClip;
+    return (CvFrameStatsCollector*)c;
+}
+
+FFI_PLUGIN_EXPORT void cv_frame_stats_release(CvFrameStatsCollector* collector) {
+    CV_PROFILE();
+    if (collector != nullptr) {
+        delete (FrameStatsCollector*)collector;
+    }
+}
+
+FFI_PLUGIN_EXPORT int cv_frame_stats_compute(CvFrameStatsCollector* collector, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
+    if (collector == nullptr || mat == nullptr) return 0;
+    return frame_stats_compute((FrameStatsCollector*)collector, *(cv::Mat*)mat);
+}
+
+FFI_PLUGIN_EXPORT const struct CvFrameStats* cv_frame_stats_get(CvFrameStatsCollector* collector) {
+    CV_PROFILE();
+    if (collector == nullptr) return nullptr;
+    return &((FrameStatsCollector*)collector)->stats;
+}
+
+// 움직임 검출
+FFI_PLUGIN_EXPORT CvMotionDetector* cv_motion_detector_create(int method, int maxSide, double learningRate, int threshold, int minArea) {
+    CV_PROFILE();
+    if (method < 0 || method > 2) return nullptr;
+    MotionDetector* m = new MotionDetector();
+    m->method = method;
+    m->maxSide = maxSide > 0 ? maxSide : 320;
+    m->learningRate = learningRate;
+    m->threshold = threshold > 0 ? threshold : 25;
+    m->minArea = std::max(1, minArea);
+    motion_detector_reset(m);
+    return (CvMotionDetector*)m;
+}
+
+FFI_PLUGIN_EXPORT void cv_motion_detector_release(CvMotionDetector* detector) {
+    CV_PROFILE();
+    if (detector != nullptr) {
+        delete (MotionDetector*)detector;
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_motion_detector_reset(CvMotionDetector* detector) {
+    CV_PROFILE();
+    if (detector == nullptr) return;
+    motion_detector_reset((MotionDetector*)detector);
+}
+
+FFI_PLUGIN_EXPORT int cv_motion_detector_process(CvMotionDetector* detector, CvMat* mat) {
+    CV_PROFILE_MAT(mat);
+    if (detector == nullptr || mat == nullptr) return 0;
+    return motion_detector_process((MotionDetector*)detector, *(cv::Mat*)mat);
+}
+
+FFI_PLUGIN_EXPORT double cv_motion_detector_activity(CvMotionDetector* detector) {
+    CV_PROFILE();
+    if (detector == nullptr) return 0.0;
+    return ((MotionDetector*)detector)->activity;
+}
+
+FFI_PLUGIN_EXPORT int cv_motion_detector_boxes(CvMotionDetector* detector, int* outBoxes, int maxBoxes) {
+    CV_PROFILE();
+    if (detector == nullptr) return 0;
+    const std::vector<cv::Rect>& boxes = ((MotionDetector*)detector)->boxes;
+    if (outBoxes == nullptr) return (int)boxes.size();
+    int count = std::min((int)boxes.size(), maxBoxes);
+    for (int i = 0; i < count; i++) {
+        outBoxes[i * 4] = boxes[i].x;
+        outBoxes[i * 4 + 1] = boxes[i].y;
+        outBoxes[i * 4 + 2] = boxes[i].width;
+        outBoxes[i * 4 + 3] = boxes[i].height;
+    }
+    return count;
+}
+
+FFI_PLUGIN_EXPORT CvMat* cv_motion_detector_mask(CvMotionDetector* detector) {
+    CV_PROFILE();
+    if (detector == nullptr) return nullptr;
+    MotionDetector* m = (MotionDetector*)detector;
+    if (m->cleaned.empty()) return nullptr;
+    return (CvMat*)new cv::Mat(m->cleaned.clone());
+}
+
+// 영상 안정화
+FFI_PLUGIN_EXPORT CvStabilizer* cv_stabilizer_create(int radius, double zoom, int maxSide) {
+    CV_PROFILE();
+    VideoStabilizer* st = new VideoStabilizer();
+    st->radius = std::max(1, radius);
+    st->zoom = zoom >= 1.0 ? zoom : 1.0;
+    st->maxSide = maxSide > 0 ? maxSide : 640;
+    stabilizer_reset(st);
+    return (CvStabilizer*)st;
+}
+
+FFI_PLUGIN_EXPORT void cv_stabilizer_release(CvStabilizer* stabilizer) {
+    CV_PROFILE();
+    if (stabilizer != nullptr) {
+        delete (VideoStabilizer*)stabilizer;
+    }
+}
+
+FFI_PLUGIN_EXPORT void cv_stabilizer_reset(CvStabilizer* stabilizer) {
+    CV_PROFILE();
+    if (stabilizer == nullptr) return;
+    stabilizer_reset((VideoStabilizer*)stabilizer);
+}
+
+FFI_PLUGIN_EXPORT int cv_stabilizer_process(CvStabilizer* stabilizer, CvMat* src, CvMat* dst) {
+    CV_PROFILE_MAT(src);
+    if (stabilizer == nullptr || src == nullptr || dst == nullptr) return 0;
+    return stabilizer_process((VideoStabilizer*)stabilizer, *(cv::Mat*)src, *(cv::Mat*)dst);
+}
+
+FFI_PLUGIN_EXPORT double cv_stabilizer_latency_ms(CvStabilizer* stabilizer) {
+    CV_PROFILE();
+    if (stabilizer == nullptr) return 0.0;
+    return ((VideoStabilizer*)stabilizer)->latencyMs;
+}
+
+FFI_PLUGIN_EXPORT int cv_stabilizer_delay_frames(CvStabilizer* stabilizer) {
+    CV_PROFILE();
+    if (stabilizer == nullptr) return 0;
+    return ((VideoStabilizer*)stabilizer)->radius;
+}
+
+namespace {
+
+// 비동기 동영상 기록기. 프레임은 복사 없이 큐로 이동되고 쓰기 스레드가 인코딩
+struct AsyncVideoWriter {
+    cv::VideoWriter writer;
+    cv::Size frameSize;
+    bool isColor = true;
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable ready, space;
+    std::deque<cv::Mat> queue;
+    size_t capacity = 1;
+    bool dropWhenFull = false; // true 면 큐가 가득 찼을 때 새 프레임을 버림, false 면 빈자리가 날 때까지 대기
+    bool closing = false;
+    long long written = 0;
+    long long dropped = 0;
+    // 쓰기 스레드 전용 변환 버퍼
+    cv::Mat converted, resized;
+};
+
+// 채널 수와 크기를 기록기 설정에 맞춰 기록. 맞출 수 없는 프레임은 false
+bool video_writer_encode(AsyncVideoWriter* w, const cv::Mat& frame) {
+    if (frame.depth() != CV_8U) return false;
+    const cv::Mat* current = &frame;
+    const int channels = w->isColor ? 3 : 1;
+    if (frame.channels() != channels) {
+        int code = -1;
+        if (channels == 3 && frame.channels() == 1) code = cv::COLOR_GRAY2BGR;
+        if (channels == 3 && frame.channels() == 4) code = cv::COLOR_BGRA2BGR;
+        if (channels == 1 && frame.channels() == 3) code = cv::COLOR_BGR2GRAY;
+        if (channels == 1 && frame.channels() == 4) code = cv::COLOR_BGRA2GRAY;
+        if (code < 0) return false;
+        cv::cvtColor(frame, w->converted, code);
+        current = &w->converted;
+    }
+    if (current->size() != w->frameSize) {
+        resize_image(*current, w->resized, w->frameSize, -1);
+        current = &w->resized;
+    }
+    w->writer.write(*current);
+    return true;
+}
+
+// 쓰기 스레드. 닫힐 때는 큐에 남은 프레임을 모두 기록한 뒤 종료
+void video_writer_loop(AsyncVideoWriter* w) {
+    CV_TRACE_THREAD_NAME("cv_video_writer");
+    for (;;) {
+        cv::Mat frame;
+        {
+            std::unique_lock<std::mutex> lock(w->lock);
+            w->ready.wait(lock, [w] { return w->closing || !w->queue.empty(); });
+            if (w->queue.empty()) return;
+            frame = std::move(w->queue.front());
+            w->queue.pop_front();
+        }
+        w->space.notify_one();
+        bool ok;
+        {
+            CV_TRACE_SPAN("video_writer_encode");
+            ok = video_writer_encode(w, frame);
+        }
+        std::lock_guard<std::mutex> lock(w->lock);
+        if (ok) {
+            w->written++;
+        } else {
+            w->dropped++;
+        }
+    }
+}
+
+void video_writer_close(AsyncVideoWriter* w) {
+    {
+        std::lock_guard<std::mutex> lock(w->lock);
+        w->closing = true;
+    }
+    w->ready.notify_all();
+    w->space.notify_all();
+    if (w->worker.joinable()) {
+        w->worker.join();
+    }
+    w->writer.release(); // 컨테이너 마무리
+}
+
+} // namespace
+
+// 비동기 동영상 기록
+FFI_PLUGIN_EXPORT CvVideoWriter* cv_videowriter_open(const char* path, const char* fourcc, double fps, int width, int height, int isColor, int queueSize, int dropWhenFull) {
+    CV_PROFILE();
+    if (path == nullptr || fourcc == nullptr || strlen(fourcc) != 4 || fps <= 0 || width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    AsyncVideoWriter* w = new AsyncVideoWriter();
+    w->frameSize = cv::Size(width, height);
+    w->isColor = isColor != 0;
+    const int code = cv::VideoWriter::fourcc(fourcc[0], fourcc[1], fourcc[2], fourcc[3]);
+    if (!w->writer.open(path, code, fps, w->frameSize, w->isColor)) {
+        delete w;
+        return nullptr;
+    }
+    w->capacity = (size_t)std::max(1, queueSize);
+    w->dropWhenFull = dropWhenFull != 0;
+    w->worker = std::thread(video_writer_loop, w);
+    return (CvVideoWriter*)w;
+}
+
+FFI_PLUGIN_EXPORT void cv_videowriter_release(CvVideoWriter* writer) {
+    CV_PROFILE();
+    if (writer != nullptr) {
+        AsyncVideoWriter* w = (AsyncVideoWriter*)writer;
+        video_writer_close(w);
+        delete w;
+    }
+}
+
+FFI_PLUGIN_EXPORT int cv_videowriter_write(CvVideoWriter* writer, CvMat* frame) {
+    CV_PROFILE_MAT(frame);
+    if (writer == nullptr || frame == nullptr) return 0;
+    AsyncVideoWriter* w = (AsyncVideoWriter*)writer;
+    cv::Mat* m = (cv::Mat*)frame;
+    if (m->empty()) return 0;
+    {
+        std::unique_lock<std::mutex> lock(w->lock);
+        if (w->closing) return 0;
+        if (w->queue.size() >= w->capacity) {
+            if (w->dropWhenFull) {
+                w->dropped++;
+                return 0;
+            }
+            w->space.wait(lock, [w] { return w->closing || w->queue.size() < w->capacity; });
+            if (w->closing) return 0;
+        }
+        w->queue.push_back(std::move(*m)); // 픽셀 복사 없이 소유권만 이동
+    }
+    w->ready.notify_one();
+    return 1;
+}
+
+FFI_PLUGIN_EXPORT void cv_videowriter_close(CvVideoWriter* writer) {
+    CV_PROFILE();
+    if (writer == nullptr) return;
+    video_writer_close((AsyncVideoWriter*)writer);
+}
+
+FFI_PLUGIN_EXPORT int cv_videowriter_pending(CvVideoWriter* writer) {
+    CV_PROFILE();
+    if (writer == nullptr) return 0;
+    AsyncVideoWriter* w = (AsyncVideoWriter*)writer;
+    std::lock_guard<std::mutex> lock(w->lock);
+    return (int)w->queue.size();
+}
+
+FFI_PLUGIN_EXPORT int cv_videowriter_written(CvVideoWriter* writer) {
+    CV_PROFILE();
+    if (writer == nullptr) return 0;
+    AsyncVideoWriter* w = (AsyncVideoWriter*)writer;
+    std::lock_guard<std::mutex> lock(w->lock);
+    return (int)w->written;
+}
+
+FFI_PLUGIN_EXPORT int cv_videowriter_dropped(CvVideoWriter* writer) {
+    CV_PROFILE();
+    if (writer == nullptr) return 0;
+    AsyncVideoWriter* w = (AsyncVideoWriter*)writer;
+    std::lock_guard<std::mutex> lock(w->lock);
+    return (int)w->dropped;
+}
+
+// leaf 호출이라 계측하지 않음 (cv_mat_width 참고)
+FFI_PLUGIN_EXPORT int cv_mat_data_len(CvMat* mat) {
+    if (mat == nullptr) return 0;
+    cv::Mat* m = (cv::Mat*)mat;
+    return m->total() * m->elemSize();
+}
+
+// leaf 호출이라 계측하지 않음 (cv_mat_width 참고)
+FFI_PLUGIN_EXPORT int cv_mat_info(CvMat* mat, struct CvMatInfo* out) {
+    if (mat == nullptr || out == nullptr) return 0;
+    const cv::Mat* m = (const cv::Mat*)mat;
+    out->width = m->cols;
+    out->height = m->rows;
+    out->channels = m->channels();
+    out->type = m->type();
+    out->depth = m->depth();
+    out->elemSize = (int32_t)m->elemSize();
+    out->step = (int64_t)m->step[0];
+    out->dataLen = (int64_t)(m->total() * m->elemSize());
+    out->continuous = m->isContinuous() ? 1 : 0;
+    out->empty = m->empty() ? 1 : 0;
+    return 1;
+}
+
+// 호출 통계
+FFI_PLUGIN_EXPORT void cv_stats_enable(int enabled) {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    static CountingMatAllocator* counting = nullptr;
+    static cv::MatAllocator* previous = nullptr;
+    std::lock_guard<std::mutex> lock(g_profileLock);
+    if (enabled != 0 && counting == nullptr) {
+        previous = cv::Mat::getDefaultAllocator();
+        counting = new CountingMatAllocator(previous); // 이 할당기로 만든 Mat 이 남아 있을 수 있어 해제하지 않음
+    }
+    if (counting != nullptr) {
+        cv::Mat::setDefaultAllocator(enabled != 0 ? counting : previous);
+    }
+    if (enabled != 0) {
+        g_instrument.fetch_or(kInstrumentStats, std::memory_order_relaxed);
+    } else {
+        g_instrument.fetch_and(~kInstrumentStats, std::memory_order_relaxed);
+    }
+#else
+    (void)enabled;
+#endif
+}
+
+FFI_PLUGIN_EXPORT int cv_stats_enabled() {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    return (g_instrument.load(std::memory_order_relaxed) & kInstrumentStats) ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+namespace {
+
+// 모든 스레드 표를 함수별로 합쳐 총 시간 내림차순으로 정렬
+std::vector<CvCallStats> stats_collect() {
+    std::map<const char*, CvCallStats> merged;
+    auto merge = [&merged](const ThreadProfile* p) {
+        for (const ProfileSlot& slot : p->slots) {
+            const char* name = slot.name.load(std::memory_order_acquire);
+            if (name == nullptr) continue;
+            const int64_t calls = slot.calls.load(std::memory_order_relaxed);
+            if (calls == 0) continue;
+            auto inserted = merged.emplace(name, CvCallStats());
+            CvCallStats& out = inserted.first->second;
+            if (inserted.second) {
+                memset(&out, 0, sizeof(out));
+                strncpy(out.name, name, sizeof(out.name) - 1);
+            }
+            const int64_t minNs = slot.minNs.load(std::memory_order_relaxed);
+            out.calls += calls;
+            out.totalNs += slot.totalNs.load(std::memory_order_relaxed);
+            if (out.minNs == 0 || (minNs > 0 && minNs < out.minNs)) out.minNs = minNs;
+            out.maxNs = std::max(out.maxNs, slot.maxNs.load(std::memory_order_relaxed));
+            out.bytesAllocated += slot.bytes.load(std::memory_order_relaxed);
+            out.pixels += slot.pixels.load(std::memory_order_relaxed);
+            const int32_t width = slot.lastWidth.load(std::memory_order_relaxed);
+            if (width > 0) {
+                out.lastWidth = width;
+                out.lastHeight = slot.lastHeight.load(std::memory_order_relaxed);
+            }
+        }
+    };
+    {
+        std::lock_guard<std::mutex> lock(g_profileLock);
+        merge(&g_retiredProfile);
+        for (const ThreadProfile* p : g_profiles) merge(p);
+    }
+    std::vector<CvCallStats> result;
+    result.reserve(merged.size());
+    for (const auto& entry : merged) result.push_back(entry.second);
+    std::sort(result.begin(), result.end(), [](const CvCallStats& a, const CvCallStats& b) { return a.totalNs > b.totalNs; });
+    return result;
+}
+
+void profile_clear(ThreadProfile* p) {
+    for (ProfileSlot& slot : p->slots) {
+        slot.calls.store(0, std::memory_order_relaxed);
+        slot.totalNs.store(0, std::memory_order_relaxed);
+        slot.minNs.store(0, std::memory_order_relaxed);
+        slot.maxNs.store(0, std::memory_order_relaxed);
+        slot.bytes.store(0, std::memory_order_relaxed);
+        slot.pixels.store(0, std::memory_order_relaxed);
+        slot.lastWidth.store(0, std::memory_order_relaxed);
+        slot.lastHeight.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+#endif
+
+FFI_PLUGIN_EXPORT int cv_stats_snapshot(struct CvCallStats* out, int maxEntries) {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    const std::vector<CvCallStats> stats = stats_collect();
+    if (out == nullptr) return (int)stats.size();
+    const int count = std::min((int)stats.size(), std::max(0, maxEntries));
+    std::copy(stats.begin(), stats.begin() + count, out);
+    return count;
+#else
+    (void)out;
+    (void)maxEntries;
+    return 0;
+#endif
+}
+
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+namespace {
+
+// JSON 문자열 값으로 덧붙이기 (따옴표, 역슬래시, 제어 문자 이스케이프). 스레드 이름은 Dart 에서 임의로 들어옴
+void json_append_string(std::string& out, const char* s) {
+    out += '"';
+    for (; *s != 0; s++) {
+        const unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += (char)c;
+        } else if (c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += (char)c;
+        }
+    }
+    out += '"';
+}
+
+} // namespace
+#endif
+
+FFI_PLUGIN_EXPORT struct BytesResult cv_stats_json() {
+    std::string json = "{\"enabled\":";
+    json += cv_stats_enabled() ? "true" : "false";
+    json += ",\"functions\":[";
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    const std::vector<CvCallStats> stats = stats_collect();
+    char line[320];
+    for (size_t i = 0; i < stats.size(); i++) {
+        const CvCallStats& st = stats[i];
+        json += i > 0 ? ",{\"name\":" : "{\"name\":";
+        json_append_string(json, st.name);
+        snprintf(line, sizeof(line),
+                 ",\"calls\":%lld,\"totalMs\":%.3f,\"meanUs\":%.1f,\"minUs\":%.1f,\"maxUs\":%.1f,"
+                 "\"bytesAllocated\":%lld,\"pixels\":%lld,\"lastWidth\":%d,\"lastHeight\":%d}",
+                 (long long)st.calls, st.totalNs / 1e6, st.totalNs / 1e3 / std::max<int64_t>(1, st.calls),
+                 st.minNs / 1e3, st.maxNs / 1e3, (long long)st.bytesAllocated, (long long)st.pixels, st.lastWidth, st.lastHeight);
+        json += line;
+    }
+#endif
+    json += "]}";
+    struct BytesResult result = {nullptr, 0};
+    result.len = (int)json.size();
+    result.data = (uint8_t*)malloc(result.len);
+    memcpy(result.data, json.data(), result.len);
+    return result;
+}
+
+FFI_PLUGIN_EXPORT void cv_stats_reset() {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    // 다른 스레드가 기록 중이면 그 호출 하나는 리셋 전/후 어느 쪽에 남을 수 있음
+    std::lock_guard<std::mutex> lock(g_profileLock);
+    profile_clear(&g_retiredProfile);
+    for (ThreadProfile* p : g_profiles) profile_clear(p);
+#endif
+}
+
+// trace span
+FFI_PLUGIN_EXPORT void cv_trace_enable(int enabled) {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    if (enabled != 0) {
+        g_instrument.fetch_or(kInstrumentTrace, std::memory_order_relaxed);
+    } else {
+        g_instrument.fetch_and(~kInstrumentTrace, std::memory_order_relaxed);
+    }
+#else
+    (void)enabled;
+#endif
+}
+
+FFI_PLUGIN_EXPORT int cv_trace_enabled() {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    return (g_instrument.load(std::memory_order_relaxed) & kInstrumentTrace) ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
+FFI_PLUGIN_EXPORT void cv_trace_set_thread_name(const char* name) {
+    if (name == nullptr) return;
+    CV_TRACE_THREAD_NAME(name);
+}
+
+FFI_PLUGIN_EXPORT struct BytesResult cv_trace_export() {
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+#ifdef _WIN32
+    const int pid = _getpid();
+#else
+    const int pid = (int)getpid();
+#endif
+    char line[256];
+    bool first = true;
+    std::vector<TraceEvent> events;
+    std::lock_guard<std::mutex> lock(g_profileLock); // 링이 해제되지 않도록
+    for (const TraceRing* ring : g_traceRings) {
+        snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":",
+                 first ? "" : ",", pid, ring->tid);
+        json += line;
+        json_append_string(json, ring->threadName);
+        json += "}}";
+        first = false;
+
+        // 소유 스레드가 계속 쓰는 중일 수 있으므로 복사 후 그동안 덮어쓴 칸은 버림
+        const uint64_t end = ring->head.load(std::memory_order_acquire);
+        const uint64_t begin = std::min(end, std::max(ring->resetAt.load(std::memory_order_relaxed), end > kTraceRingSize ? end - kTraceRingSize : 0));
+        events.clear();
+        for (uint64_t i = begin; i < end; i++) events.push_back(ring->events[i % kTraceRingSize]);
+        const uint64_t after = ring->head.load(std::memory_order_acquire);
+        const uint64_t valid = after > kTraceRingSize ? after - kTraceRingSize : 0;
+        for (uint64_t i = std::max(begin, valid); i < end; i++) {
+            const TraceEvent& e = events[i - begin];
+            json += ",{\"name\":";
+            json_append_string(json, e.name);
+            snprintf(line, sizeof(line), ",\"cat\":\"flutter_opencv\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+                     e.startNs / 1e3, e.durationNs / 1e3, pid, ring->tid);
+            json += line;
+        }
+    }
+#endif
+    json += "]}";
+    struct BytesResult result = {nullptr, 0};
+    result.len = (int)json.size();
+    result.data = (uint8_t*)malloc(result.len);
+    memcpy(result.data, json.data(), result.len);
+    return result;
+}
+
+FFI_PLUGIN_EXPORT void cv_trace_reset() {
+#ifndef FLUTTER_OPENCV_NO_PROFILING
+    // 살아 있는 스레드의 링은 head 를 건드리지 않고 내보낼 시작점만 옮기고, 종료된 스레드의 링은 해제
+    std::lock_guard<std::mutex> lock(g_profileLock);
+    for (auto it = g_traceRings.begin(); it != g_traceRings.end();) {
+        if ((*it)->finished) {
+            delete *it;
+            it = g_traceRings.erase(it);
+        } else {
+            (*it)->resetAt.store((*it)->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+            ++it;
+        }
+    }
+#endif
 }
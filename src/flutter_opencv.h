@@ -51,9 +51,57 @@ FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_bgr2lab(CvMat* mat);
 FFI_PLUGIN_EXPORT CvMat* cv_cvtColor_lab2bgr(CvMat* mat);
 
 // 변환
+// interpolation: -1=자동 (축소 AREA, 확대 LINEAR). 8비트 AREA 축소는 2배 이상이면 정수 배율 박스 축소를 먼저 수행
 FFI_PLUGIN_EXPORT CvMat* cv_resize(CvMat* mat, int width, int height, int interpolation);
 FFI_PLUGIN_EXPORT CvMat* cv_flip(CvMat* mat, int mode); // mode: 0=x축, 1=y축, -1=양축
 FFI_PLUGIN_EXPORT CvMat* cv_rotate(CvMat* mat, int code); // code: 0=90도CW, 1=180도, 2=90도CCW
+// m: 행 우선 2x3 (affine) / 3x3 (perspective) 행렬. width, height 가 0 이면 입력 크기
+FFI_PLUGIN_EXPORT CvMat* cv_warp_affine(CvMat* mat, const double* m, int width, int height, int interpolation, int borderMode);
+FFI_PLUGIN_EXPORT CvMat* cv_warp_perspective(CvMat* mat, const double* m, int width, int height, int interpolation, int borderMode);
+// mapX, mapY: 출력 크기의 CV_32FC1 입력 좌표 맵
+FFI_PLUGIN_EXPORT CvMat* cv_remap(CvMat* mat, CvMat* mapX, CvMat* mapY, int interpolation, int borderMode);
+
+// 리맵 캐시 포인터. 반복되는 기하 변환을 고정소수점 테이블로 한 번만 계산해 재사용
+typedef void CvRemapCache;
+
+// width x height 출력용 캐시 생성 (m 은 정방향 변환 행렬)
+FFI_PLUGIN_EXPORT CvRemapCache* cv_remap_cache_create_affine(const double* m, int width, int height, int interpolation, int borderMode);
+FFI_PLUGIN_EXPORT CvRemapCache* cv_remap_cache_create_perspective(const double* m, int width, int height, int interpolation, int borderMode);
+FFI_PLUGIN_EXPORT CvRemapCache* cv_remap_cache_create_maps(CvMat* mapX, CvMat* mapY, int interpolation, int borderMode);
+FFI_PLUGIN_EXPORT void cv_remap_cache_release(CvRemapCache* cache);
+FFI_PLUGIN_EXPORT CvMat* cv_remap_cache_apply(CvRemapCache* cache, CvMat* mat);
+
+// 카메라 보정 포인터 (체스보드 관측값과 내부 파라미터 / 왜곡 계수)
+typedef void CvCalibration;
+
+// patternCols x patternRows: 체스보드 내부 코너 개수, squareSize: 칸 한 변 길이
+FFI_PLUGIN_EXPORT CvCalibration* cv_calibration_create(int patternCols, int patternRows, float squareSize);
+FFI_PLUGIN_EXPORT void cv_calibration_release(CvCalibration* calib);
+// 체스보드를 찾으면 관측값에 추가하고 1 반환. outCorners(선택)에 코너 (x, y) 를 기록
+FFI_PLUGIN_EXPORT int cv_calibration_add_frame(CvCalibration* calib, CvMat* mat, float* outCorners);
+FFI_PLUGIN_EXPORT int cv_calibration_frame_count(CvCalibration* calib);
+// 3장 이상의 관측값으로 보정하고 재투영 RMS 오차 반환 (실패 시 -1)
+FFI_PLUGIN_EXPORT double cv_calibration_calibrate(CvCalibration* calib);
+// outCameraMatrix: 3x3 행 우선, outDistCoeffs: k1 k2 p1 p2 k3, outSize: width height
+FFI_PLUGIN_EXPORT int cv_calibration_get_params(CvCalibration* calib, double* outCameraMatrix, double* outDistCoeffs, int* outSize);
+FFI_PLUGIN_EXPORT void cv_calibration_set_params(CvCalibration* calib, const double* cameraMatrix, const double* distCoeffs, int width, int height);
+// OpenCV FileStorage 형식 (확장자에 따라 .yml / .xml / .json)
+FFI_PLUGIN_EXPORT int cv_calibration_save(CvCalibration* calib, const char* path);
+FFI_PLUGIN_EXPORT CvCalibration* cv_calibration_load(const char* path);
+// 왜곡 보정 맵을 한 번 생성한 리맵 캐시 반환 (cv_videocapture_set_remap 으로 캡처에 부착 가능)
+FFI_PLUGIN_EXPORT CvRemapCache* cv_undistorter_create(CvCalibration* calib, double alpha, int interpolation);
+
+// 영상 피라미드 포인터. 레벨은 처음 접근할 때 바로 아래 레벨에서 계산되어 캐시됨
+typedef void CvPyramid;
+
+// levels 가 0 이하면 짧은 변이 16 픽셀 이상인 최대 레벨 수. 레벨 0 은 원본과 데이터를 공유
+FFI_PLUGIN_EXPORT CvPyramid* cv_pyramid_create(CvMat* mat, int levels);
+FFI_PLUGIN_EXPORT void cv_pyramid_release(CvPyramid* pyramid);
+FFI_PLUGIN_EXPORT int cv_pyramid_levels(CvPyramid* pyramid);
+// 반환된 영상은 레벨별 독립 버퍼를 공유 (피라미드를 해제해도 유효)
+FFI_PLUGIN_EXPORT CvMat* cv_pyramid_gaussian(CvPyramid* pyramid, int level);
+// 8비트 입력은 CV_16S, 그 외는 CV_32F. level == levels 이면 가장 작은 Gaussian 레벨
+FFI_PLUGIN_EXPORT CvMat* cv_pyramid_laplacian(CvPyramid* pyramid, int level);
 
 // 필터
 FFI_PLUGIN_EXPORT CvMat* cv_gaussian_blur(CvMat* mat, int kernelSize, double sigma);
@@ -69,13 +117,98 @@ FFI_PLUGIN_EXPORT CvMat* cv_erode(CvMat* mat, int kernelSize, int iterations);
 FFI_PLUGIN_EXPORT CvMat* cv_dilate(CvMat* mat, int kernelSize, int iterations);
 FFI_PLUGIN_EXPORT CvMat* cv_morphology_ex(CvMat* mat, int op, int kernelSize);
 
+// 커널 포인터 (shape: 0=사각형, 1=십자형, 2=타원형). 한 번 만들어 여러 호출에 재사용
+typedef void CvKernel;
+
+FFI_PLUGIN_EXPORT CvKernel* cv_kernel_create(int shape, int width, int height);
+FFI_PLUGIN_EXPORT CvKernel* cv_kernel_create_custom(const float* data, int width, int height, int anchorX, int anchorY);
+FFI_PLUGIN_EXPORT void cv_kernel_release(CvKernel* kernel);
+FFI_PLUGIN_EXPORT CvMat* cv_erode_kernel(CvMat* mat, CvKernel* kernel, int iterations);
+FFI_PLUGIN_EXPORT CvMat* cv_dilate_kernel(CvMat* mat, CvKernel* kernel, int iterations);
+FFI_PLUGIN_EXPORT CvMat* cv_morphology_ex_kernel(CvMat* mat, int op, CvKernel* kernel, int iterations);
+FFI_PLUGIN_EXPORT CvMat* cv_filter2d_kernel(CvMat* mat, CvKernel* kernel, double delta, int borderType);
+
+// 사용자 커널 필터 (anchor -1 이면 중앙, 분리 가능한 커널은 자동으로 분리 적용)
+FFI_PLUGIN_EXPORT CvMat* cv_filter2d(CvMat* mat, const float* kernel, int kernelWidth, int kernelHeight, int anchorX, int anchorY, double delta, int borderType);
+FFI_PLUGIN_EXPORT CvMat* cv_sep_filter2d(CvMat* mat, const float* kernelX, int kernelXLen, const float* kernelY, int kernelYLen, int anchorX, int anchorY, double delta, int borderType);
+FFI_PLUGIN_EXPORT CvMat* cv_unsharp_mask(CvMat* mat, double sigma, double amount, int threshold);
+
 // 임계값 처리
 FFI_PLUGIN_EXPORT CvMat* cv_threshold(CvMat* mat, double thresh, double maxval, int type);
 FFI_PLUGIN_EXPORT CvMat* cv_adaptive_threshold(CvMat* mat, double maxValue, int adaptiveMethod, int thresholdType, int blockSize, double C);
+// 문서 이진화 (method: 0=Sauvola, 1=Wolf, 2=Niblack). scales > 1 이면 대비가 낮은 영역에 2배씩 큰 창을 사용
+FFI_PLUGIN_EXPORT CvMat* cv_binarize_document(CvMat* mat, int method, int windowSize, double k, double r, int scales);
+
+// 문서 스캐너
+// 축소 영상(긴 변 maxSide)에서 문서 사각형 검출. outQuad 에 좌상, 우상, 우하, 좌하 (x, y) 8개를 원본 좌표로 기록하고 신뢰도(0~1)를 반환 (없으면 0)
+FFI_PLUGIN_EXPORT double cv_document_detect(CvMat* mat, int maxSide, float* outQuad);
+// 전체 해상도에서 꼭짓점 주변 ROI 만 사용해 quad 를 서브픽셀로 보정
+FFI_PLUGIN_EXPORT int cv_document_refine(CvMat* mat, float* quad, int searchRadius);
+// quad 를 outWidth x outHeight 로 원근 보정. 0 이면 변 길이로 자동 결정
+FFI_PLUGIN_EXPORT CvMat* cv_document_warp(CvMat* mat, const float* quad, int outWidth, int outHeight);
+
+// 적분 영상 포인터. flags: 1=제곱합, 2=기울어진(45도) 합 추가 계산
+typedef void CvIntegral;
+
+FFI_PLUGIN_EXPORT CvIntegral* cv_integral_create();
+FFI_PLUGIN_EXPORT void cv_integral_release(CvIntegral* integral);
+FFI_PLUGIN_EXPORT int cv_integral_compute(CvIntegral* integral, CvMat* mat, int flags);
+// rects: (x, y, width, height) * count. 영상 경계로 잘라서 계산하며 처리한 개수를 반환
+FFI_PLUGIN_EXPORT int cv_integral_rect_sums(CvIntegral* integral, const int* rects, int count, int channel, double* outSums);
+FFI_PLUGIN_EXPORT int cv_integral_rect_stats(CvIntegral* integral, const int* rects, int count, int channel, double* outMeans, double* outVariances);
+// rects: 위쪽 꼭짓점 (x, y) 와 45도 기울어진 변 길이 (width, height)
+FFI_PLUGIN_EXPORT int cv_integral_tilted_sums(CvIntegral* integral, const int* rects, int count, int channel, double* outSums);
 
 // 히스토그램
+// outHist 에 bins 개씩 채널 순서로 기록 (channel -1 이면 모든 채널, channels * bins). mask 는 nullptr 가능
+FFI_PLUGIN_EXPORT int cv_calc_hist(CvMat* mat, int channel, int bins, float rangeMin, float rangeMax, CvMat* mask, float* outHist);
+// 컬러 영상은 밝기(Y)만 평활화, BGRA 는 알파 유지. 8비트 1/3/4 채널이 아니면 nullptr
 FFI_PLUGIN_EXPORT CvMat* cv_equalize_hist(CvMat* mat);
 
+// CLAHE 포인터 (프레임 간 재사용)
+typedef void CvClahe;
+
+FFI_PLUGIN_EXPORT CvClahe* cv_clahe_create(double clipLimit, int tilesX, int tilesY);
+FFI_PLUGIN_EXPORT void cv_clahe_release(CvClahe* clahe);
+FFI_PLUGIN_EXPORT void cv_clahe_set(CvClahe* clahe, double clipLimit, int tilesX, int tilesY);
+// 컬러 영상은 밝기(Y)에만 적용
+FFI_PLUGIN_EXPORT CvMat* cv_clahe_apply(CvClahe* clahe, CvMat* mat);
+
+// 룩업 테이블 포인터. 톤 연산을 순서대로 합성해 한 번의 패스로 적용
+typedef void CvLut;
+
+// 항등 테이블로 생성
+FFI_PLUGIN_EXPORT CvLut* cv_lut_create();
+FFI_PLUGIN_EXPORT void cv_lut_release(CvLut* lut);
+FFI_PLUGIN_EXPORT void cv_lut_reset(CvLut* lut);
+// channel: -1=색상 채널 전체(알파 제외), 0~3=해당 채널. 1채널 영상은 0번 테이블 사용
+FFI_PLUGIN_EXPORT void cv_lut_brightness(CvLut* lut, int channel, double delta);
+FFI_PLUGIN_EXPORT void cv_lut_contrast(CvLut* lut, int channel, double factor, double pivot);
+FFI_PLUGIN_EXPORT void cv_lut_gamma(CvLut* lut, int channel, double gamma);
+FFI_PLUGIN_EXPORT void cv_lut_levels(CvLut* lut, int channel, double inBlack, double inWhite, double outBlack, double outWhite);
+// points: 제어점 (x, y) count 개, 0~255
+FFI_PLUGIN_EXPORT void cv_lut_curve(CvLut* lut, int channel, const float* points, int count);
+// table: 256개 값을 현재 결과 뒤에 합성
+FFI_PLUGIN_EXPORT void cv_lut_table(CvLut* lut, int channel, const uint8_t* table);
+// 3D 색보정 격자 (.cube 순서, size^3 * 3 개 RGB 0~1). data 가 nullptr 이면 제거
+FFI_PLUGIN_EXPORT int cv_lut_set_3d(CvLut* lut, const float* data, int size);
+// 8비트 영상에 적용
+FFI_PLUGIN_EXPORT CvMat* cv_lut_apply(CvLut* lut, CvMat* mat);
+
+// 옵티컬 플로우 추적기 포인터. 이전 프레임의 피라미드를 보관해 재사용
+typedef void CvFlowTracker;
+
+FFI_PLUGIN_EXPORT CvFlowTracker* cv_flow_tracker_create(int winSize, int maxLevel);
+FFI_PLUGIN_EXPORT void cv_flow_tracker_release(CvFlowTracker* tracker);
+FFI_PLUGIN_EXPORT void cv_flow_tracker_reset(CvFlowTracker* tracker);
+// 새 프레임을 넣고 이전 프레임의 points (x, y) count 개를 추적. 이전 프레임이 없으면 0 반환 (프레임은 저장됨)
+// outPoints: count * 2, outStatus: count (1=성공), outError: count. 각각 nullptr 가능
+FFI_PLUGIN_EXPORT int cv_flow_tracker_track(CvFlowTracker* tracker, CvMat* mat, const float* points, int count, float* outPoints, uint8_t* outStatus, float* outError);
+// 마지막 프레임에서 추적할 코너를 최대 maxCorners 개 검출해 outPoints (x, y) 에 기록하고 개수 반환
+FFI_PLUGIN_EXPORT int cv_flow_tracker_detect(CvFlowTracker* tracker, int maxCorners, double quality, double minDistance, float* outPoints);
+// 조밀 옵티컬 플로우 (CV_32FC2). method: 0=DIS, 1=Farneback. preset: DIS 프리셋 (0=ultrafast, 1=fast, 2=medium)
+FFI_PLUGIN_EXPORT CvMat* cv_optical_flow_dense(CvMat* prev, CvMat* next, int method, int preset);
+
 // 노이즈 제거
 FFI_PLUGIN_EXPORT CvMat* cv_fast_nl_means_denoising(CvMat* mat, float h, int templateWindowSize, int searchWindowSize);
 FFI_PLUGIN_EXPORT CvMat* cv_fast_nl_means_denoising_colored(CvMat* mat, float h, float hColor, int templateWindowSize, int searchWindowSize);
@@ -100,10 +233,140 @@ FFI_PLUGIN_EXPORT void cv_line(CvMat* mat, int x1, int y1, int x2, int y2, int r
 typedef void CvVideoCapture;
 
 FFI_PLUGIN_EXPORT CvVideoCapture* cv_videocapture_create(int index);
+// 동영상 파일/스트림 URL 열기. api: cv::CAP_* 백엔드 (0 이면 자동),
+// queueSize > 0 이면 백그라운드 스레드가 최대 queueSize 프레임을 미리 디코드, stride: N 프레임마다 한 장만 디코드
+FFI_PLUGIN_EXPORT CvVideoCapture* cv_videocapture_open(const char* path, int api, int queueSize, int stride);
 FFI_PLUGIN_EXPORT void cv_videocapture_release(CvVideoCapture* cap);
 FFI_PLUGIN_EXPORT int cv_videocapture_read(CvVideoCapture* cap, CvMat* dst);
 FFI_PLUGIN_EXPORT double cv_videocapture_get(CvVideoCapture* cap, int propId);
 FFI_PLUGIN_EXPORT void cv_videocapture_set(CvVideoCapture* cap, int propId, double value);
+// 다음 read 가 frameIndex 프레임부터 반환하도록 이동 (미리 디코드된 프레임은 버리고 부착된 안정화기/디노이저는 초기화). 실패 시 0
+FFI_PLUGIN_EXPORT int cv_videocapture_seek(CvVideoCapture* cap, int frameIndex);
+// 마지막 read 로 반환된 프레임 번호 (아직 없으면 -1)
+FFI_PLUGIN_EXPORT int cv_videocapture_position(CvVideoCapture* cap);
+
+// 프레임 시각 (cv_monotonic_ns 기준 ns). capture: grab 완료, dequeue: read 가 받은 시점, processed: 부착 단계 처리 완료
+struct CvFrameTiming {
+    int64_t frameIndex;
+    int64_t captureNs;
+    int64_t dequeueNs;
+    int64_t processedNs;
+};
+
+// 지연 통계 구간
+#define CV_LATENCY_QUEUE 0 // capture -> dequeue (디코드 큐 대기)
+#define CV_LATENCY_PROCESS 1 // dequeue -> processed (리맵/안정화/노이즈 제거/분석)
+#define CV_LATENCY_CAPTURE_TO_PROCESSED 2 // capture -> processed
+#define CV_LATENCY_END_TO_END 3 // capture -> cv_videocapture_mark_done (표시/인코딩까지)
+
+struct CvLatencyStats {
+    int64_t count;
+    double meanMs;
+    double p50Ms;
+    double p95Ms;
+    double p99Ms;
+    double maxMs;
+};
+
+// 단조 증가 시계 (ns)
+FFI_PLUGIN_EXPORT int64_t cv_monotonic_ns();
+// 마지막 read 로 반환된 프레임의 시각. 아직 없으면 0
+FFI_PLUGIN_EXPORT int cv_videocapture_timing(CvVideoCapture* cap, struct CvFrameTiming* out);
+// 마지막 프레임의 표시/인코딩이 끝났음을 기록 (CV_LATENCY_END_TO_END)
+FFI_PLUGIN_EXPORT void cv_videocapture_mark_done(CvVideoCapture* cap);
+// stage 구간의 누적 지연 통계 (로그 구간 히스토그램 기반 p50/p95/p99)
+FFI_PLUGIN_EXPORT int cv_videocapture_latency(CvVideoCapture* cap, int stage, struct CvLatencyStats* out);
+FFI_PLUGIN_EXPORT void cv_videocapture_latency_reset(CvVideoCapture* cap);
+
+// 시간적 노이즈 제거기 포인터 (mode: 0=움직임 적응형 재귀 평균, 1=멀티 프레임 NL-Means)
+typedef void CvTemporalDenoiser;
+
+FFI_PLUGIN_EXPORT CvTemporalDenoiser* cv_temporal_denoiser_create(int mode, int windowSize, float h, float alpha, int motionThreshold);
+FFI_PLUGIN_EXPORT void cv_temporal_denoiser_release(CvTemporalDenoiser* denoiser);
+FFI_PLUGIN_EXPORT void cv_temporal_denoiser_reset(CvTemporalDenoiser* denoiser);
+// 프레임을 넣고 디노이즈된 프레임을 dst 에 기록. 멀티 프레임 모드는 창 (windowSize 장) 이 찰 때까지 출력할 프레임이 없어 0
+FFI_PLUGIN_EXPORT int cv_temporal_denoiser_process(CvTemporalDenoiser* denoiser, CvMat* src, CvMat* dst);
+// 캡처 스트림에 부착 (nullptr 이면 해제). read 시 프레임이 디노이즈되어 반환됨
+FFI_PLUGIN_EXPORT void cv_videocapture_set_denoiser(CvVideoCapture* cap, CvTemporalDenoiser* denoiser);
+// 리맵 캐시 부착 (nullptr 이면 해제). 노이즈 제거보다 먼저 적용됨
+FFI_PLUGIN_EXPORT void cv_videocapture_set_remap(CvVideoCapture* cap, CvRemapCache* cache);
+
+// 프레임 통계 (자동 노출 / 화이트 밸런스용). 수집기 안에 있으며 매 프레임 덮어씀
+struct CvFrameStats {
+    // 밝기 히스토그램 (샘플 수 기준)
+    uint32_t histogram[256];
+    uint32_t samples;
+    uint32_t frameCount;
+    float meanLuma;
+    // lowClip 이하 / highClip 이상인 샘플 비율 (0~1)
+    float clipLow;
+    float clipHigh;
+    // B, G, R, A 채널 평균
+    float channelMeans[4];
+    // Gray-world 화이트 밸런스 게인 (B, G, R)
+    float grayWorldGains[3];
+};
+
+// 프레임 통계 수집기 포인터
+typedef void CvFrameStatsCollector;
+
+// step: 샘플링 격자 간격 (4 이면 1/16 픽셀), lowClip / highClip: 클리핑으로 볼 밝기
+FFI_PLUGIN_EXPORT CvFrameStatsCollector* cv_frame_stats_create(int step, int lowClip, int highClip);
+FFI_PLUGIN_EXPORT void cv_frame_stats_release(CvFrameStatsCollector* collector);
+FFI_PLUGIN_EXPORT int cv_frame_stats_compute(CvFrameStatsCollector* collector, CvMat* mat);
+// 수집기 내부 구조체 포인터 (복사 없이 읽기, 수집기가 해제되기 전까지 유효)
+FFI_PLUGIN_EXPORT const struct CvFrameStats* cv_frame_stats_get(CvFrameStatsCollector* collector);
+// 캡처 스트림에 부착 (nullptr 이면 해제). read 시 최종 프레임의 통계가 갱신됨
+FFI_PLUGIN_EXPORT void cv_videocapture_set_frame_stats(CvVideoCapture* cap, CvFrameStatsCollector* collector);
+
+// 움직임 검출기 포인터 (축소한 그레이 프레임에서 배경 차분)
+typedef void CvMotionDetector;
+
+// method: 0=이동 평균 배경 차분, 1=MOG2, 2=KNN. maxSide: 처리 해상도의 긴 변, minArea: 축소 좌표 기준 최소 영역 넓이
+FFI_PLUGIN_EXPORT CvMotionDetector* cv_motion_detector_create(int method, int maxSide, double learningRate, int threshold, int minArea);
+FFI_PLUGIN_EXPORT void cv_motion_detector_release(CvMotionDetector* detector);
+FFI_PLUGIN_EXPORT void cv_motion_detector_reset(CvMotionDetector* detector);
+FFI_PLUGIN_EXPORT int cv_motion_detector_process(CvMotionDetector* detector, CvMat* mat);
+// 마지막 프레임에서 움직인 픽셀 비율 (0~1)
+FFI_PLUGIN_EXPORT double cv_motion_detector_activity(CvMotionDetector* detector);
+// 움직임 영역 (x, y, width, height) 을 원본 좌표로 최대 maxBoxes 개 기록하고 개수 반환. outBoxes 가 nullptr 이면 전체 개수만 반환
+FFI_PLUGIN_EXPORT int cv_motion_detector_boxes(CvMotionDetector* detector, int* outBoxes, int maxBoxes);
+// 마지막 움직임 마스크 (축소 해상도) 복사본
+FFI_PLUGIN_EXPORT CvMat* cv_motion_detector_mask(CvMotionDetector* detector);
+// 캡처 스트림에 부착 (nullptr 이면 해제). read 시 최종 프레임으로 갱신됨
+FFI_PLUGIN_EXPORT void cv_videocapture_set_motion_detector(CvVideoCapture* cap, CvMotionDetector* detector);
+
+// 영상 안정화기 포인터. 출력은 radius 프레임 지연됨
+typedef void CvStabilizer;
+
+// radius: 궤적 평활화 반경 (앞뒤 프레임 수), zoom: 가장자리를 가리기 위한 확대 비율 (>= 1), maxSide: 움직임 추정 해상도의 긴 변
+FFI_PLUGIN_EXPORT CvStabilizer* cv_stabilizer_create(int radius, double zoom, int maxSide);
+FFI_PLUGIN_EXPORT void cv_stabilizer_release(CvStabilizer* stabilizer);
+FFI_PLUGIN_EXPORT void cv_stabilizer_reset(CvStabilizer* stabilizer);
+// 프레임을 넣고 radius 프레임 전의 보정된 프레임을 dst 에 기록. 아직 출력할 프레임이 없으면 0
+FFI_PLUGIN_EXPORT int cv_stabilizer_process(CvStabilizer* stabilizer, CvMat* src, CvMat* dst);
+// 마지막 프레임의 처리 시간 (ms)
+FFI_PLUGIN_EXPORT double cv_stabilizer_latency_ms(CvStabilizer* stabilizer);
+// 출력 지연 프레임 수
+FFI_PLUGIN_EXPORT int cv_stabilizer_delay_frames(CvStabilizer* stabilizer);
+// 캡처 스트림에 부착 (nullptr 이면 해제). 리맵 뒤, 노이즈 제거 앞에 적용됨
+FFI_PLUGIN_EXPORT void cv_videocapture_set_stabilizer(CvVideoCapture* cap, CvStabilizer* stabilizer);
+
+// 비동기 동영상 기록기 포인터 (쓰기 스레드 + 크기 제한 프레임 큐)
+typedef void CvVideoWriter;
+
+// fourcc: 코덱 4 글자 (예: "mp4v", "MJPG"), queueSize: 대기 가능한 프레임 수,
+// dropWhenFull: 1 이면 큐가 가득 찼을 때 새 프레임을 버림, 0 이면 빈자리가 날 때까지 대기
+FFI_PLUGIN_EXPORT CvVideoWriter* cv_videowriter_open(const char* path, const char* fourcc, double fps, int width, int height, int isColor, int queueSize, int dropWhenFull);
+// 남은 프레임을 모두 기록하고 해제
+FFI_PLUGIN_EXPORT void cv_videowriter_release(CvVideoWriter* writer);
+// frame 을 큐로 이동 (성공 시 frame 은 빈 Mat 이 됨). 버려지거나 실패하면 0 을 반환하고 frame 은 그대로
+FFI_PLUGIN_EXPORT int cv_videowriter_write(CvVideoWriter* writer, CvMat* frame);
+// 남은 프레임을 모두 기록하고 파일을 닫음 (이후 write 는 0)
+FFI_PLUGIN_EXPORT void cv_videowriter_close(CvVideoWriter* writer);
+FFI_PLUGIN_EXPORT int cv_videowriter_pending(CvVideoWriter* writer);
+FFI_PLUGIN_EXPORT int cv_videowriter_written(CvVideoWriter* writer);
+FFI_PLUGIN_EXPORT int cv_videowriter_dropped(CvVideoWriter* writer);
 
 // 속성 접근자
 FFI_PLUGIN_EXPORT int cv_mat_width(CvMat* mat);
@@ -112,6 +375,59 @@ FFI_PLUGIN_EXPORT int cv_mat_channels(CvMat* mat);
 FFI_PLUGIN_EXPORT const uint8_t* cv_mat_data(CvMat* mat);
 FFI_PLUGIN_EXPORT int cv_mat_data_len(CvMat* mat);
 
+// Mat 속성을 한 번의 호출로 조회 (cv_mat_info)
+struct CvMatInfo {
+    int32_t width;
+    int32_t height;
+    int32_t channels;
+    // OpenCV 타입 (CV_8UC3 등) 과 깊이 (CV_8U 등)
+    int32_t type;
+    int32_t depth;
+    // 픽셀당 바이트
+    int32_t elemSize;
+    // 행 간격 (바이트)
+    int64_t step;
+    // total * elemSize (바이트)
+    int64_t dataLen;
+    // 행 사이에 여백이 없으면 1 (data 를 하나의 버퍼로 읽을 수 있음)
+    int32_t continuous;
+    int32_t empty;
+};
+
+// 크기/타입/행 간격/연속성을 out 에 채움. mat 이 nullptr 이면 0
+FFI_PLUGIN_EXPORT int cv_mat_info(CvMat* mat, struct CvMatInfo* out);
+
+// 함수별 호출 통계 (cv_stats_enable(1) 이후의 호출만 기록)
+struct CvCallStats {
+    char name[64];
+    int64_t calls;
+    int64_t totalNs;
+    int64_t minNs;
+    int64_t maxNs;
+    int64_t bytesAllocated; // 호출 스레드에서 cv::Mat 이 새로 할당한 바이트
+    int64_t pixels; // 입력 Mat 픽셀 수 합계
+    int32_t lastWidth; // 마지막 호출의 입력 크기
+    int32_t lastHeight;
+};
+
+// 계측 켜기/끄기 (꺼져 있으면 호출당 원자 변수 한 번 읽는 비용만 남음)
+FFI_PLUGIN_EXPORT void cv_stats_enable(int enabled);
+FFI_PLUGIN_EXPORT int cv_stats_enabled();
+// 모든 스레드의 통계를 합쳐 총 시간 내림차순으로 out 에 기록. out 이 nullptr 이면 항목 수만 반환
+FFI_PLUGIN_EXPORT int cv_stats_snapshot(struct CvCallStats* out, int maxEntries);
+// 같은 내용을 JSON 으로 반환 (cv_free_bytes 로 해제)
+FFI_PLUGIN_EXPORT struct BytesResult cv_stats_json();
+FFI_PLUGIN_EXPORT void cv_stats_reset();
+
+// trace span 기록 켜기/끄기. 모든 cv_* 호출 (leaf 접근자 제외) 과 캡처/기록 파이프라인 단계, 내부 parallel_for_ 조각이 스레드별 링 버퍼 (최근 4096 개) 에 기록됨
+FFI_PLUGIN_EXPORT void cv_trace_enable(int enabled);
+FFI_PLUGIN_EXPORT int cv_trace_enabled();
+// 호출 스레드의 trace 이름 (예: "dart_ui")
+FFI_PLUGIN_EXPORT void cv_trace_set_thread_name(const char* name);
+// Chrome trace-event JSON 으로 내보내기 (Perfetto 에서 열 수 있음, cv_free_bytes 로 해제). 시각은 cv_monotonic_ns 기준
+FFI_PLUGIN_EXPORT struct BytesResult cv_trace_export();
+FFI_PLUGIN_EXPORT void cv_trace_reset();
+
 #ifdef __cplusplus
 }
 #endif
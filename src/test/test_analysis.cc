@@ -0,0 +1,239 @@
+// 문서 스캐너 / 옵티컬 플로우 / NL-Means / 컨투어 / 도형 그리기
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+using test::handle;
+using test::mat_near;
+using test::mat_of;
+using test::MatPtr;
+
+TEST(Document, DetectFindsPage) {
+    cv::Point2f corners[4];
+    cv::Mat image = test::make_document(1280, 960, corners);
+    float quad[8];
+    const double score = cv_document_detect(handle(image), 640, quad);
+    EXPECT_GE(score, 0.5);
+    // 축소 영상에서 검출한 좌표를 원본 좌표로 되돌리므로 축소 배율(2) 몇 배 이내
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(quad[i * 2], corners[i].x, 8.0) << "corner " << i;
+        EXPECT_NEAR(quad[i * 2 + 1], corners[i].y, 8.0) << "corner " << i;
+    }
+
+    // 서브픽셀 보정은 실제 꼭짓점에 더 가까워져야 함
+    ASSERT_EQ(cv_document_refine(handle(image), quad, 12), 1);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_LT(cv::norm(cv::Point2f(quad[i * 2], quad[i * 2 + 1]) - corners[i]), 3.0) << "corner " << i;
+    }
+
+    cv::Mat blank(480, 640, CV_8UC3, cv::Scalar(90, 90, 90));
+    EXPECT_EQ(cv_document_detect(handle(blank), 640, quad), 0.0);
+    EXPECT_EQ(cv_document_detect(nullptr, 640, quad), 0.0);
+}
+
+TEST(Document, WarpMatchesPerspectiveTransform) {
+    cv::Point2f corners[4];
+    cv::Mat image = test::make_document(800, 600, corners);
+    float quad[8];
+    for (int i = 0; i < 4; i++) {
+        quad[i * 2] = corners[i].x;
+        quad[i * 2 + 1] = corners[i].y;
+    }
+
+    // 자동 크기: 마주 보는 변 중 긴 쪽
+    const int width = (int)std::max(cv::norm(corners[1] - corners[0]), cv::norm(corners[2] - corners[3]));
+    const int height = (int)std::max(cv::norm(corners[3] - corners[0]), cv::norm(corners[2] - corners[1]));
+    const cv::Point2f to[4] = {
+        cv::Point2f(0, 0),
+        cv::Point2f((float)(width - 1), 0),
+        cv::Point2f((float)(width - 1), (float)(height - 1)),
+        cv::Point2f(0, (float)(height - 1)),
+    };
+    cv::Mat expected;
+    cv::warpPerspective(image, expected, cv::getPerspectiveTransform(corners, to), cv::Size(width, height), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    EXPECT_TRUE(mat_near(MatPtr(cv_document_warp(handle(image), quad, 0, 0)), expected, 0));
+
+    MatPtr fixed(cv_document_warp(handle(image), quad, 420, 594));
+    ASSERT_NE(fixed, nullptr);
+    EXPECT_EQ(mat_of(fixed).cols, 420);
+    EXPECT_EQ(mat_of(fixed).rows, 594);
+    // 대부분 종이 색
+    EXPECT_GT(cv::mean(mat_of(fixed))[0], 180.0);
+
+    EXPECT_EQ(cv_document_warp(handle(image), nullptr, 0, 0), nullptr);
+}
+
+namespace {
+
+// 영상을 (dx, dy) 만큼 평행 이동 (경계는 복제)
+cv::Mat shifted(const cv::Mat& src, double dx, double dy) {
+    cv::Mat m = (cv::Mat_<double>(2, 3) << 1, 0, dx, 0, 1, dy), dst;
+    cv::warpAffine(src, dst, m, src.size(), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    return dst;
+}
+
+} // namespace
+
+TEST(Flow, TrackerFollowsShift) {
+    cv::Mat frame0 = test::make_scene(320, 240, 3);
+    cv::Mat frame1 = shifted(frame0, 2, 1);
+
+    CvFlowTracker* tracker = cv_flow_tracker_create(21, 3);
+    ASSERT_NE(tracker, nullptr);
+    // 첫 프레임은 저장만
+    EXPECT_EQ(cv_flow_tracker_track(tracker, handle(frame0), nullptr, 0, nullptr, nullptr, nullptr), 0);
+
+    std::vector<float> points(2 * 50);
+    const int found = cv_flow_tracker_detect(tracker, 50, 0.01, 8, points.data());
+    ASSERT_GT(found, 10);
+    cv::Mat gray0;
+    cv::cvtColor(frame0, gray0, cv::COLOR_BGR2GRAY);
+    std::vector<cv::Point2f> reference;
+    cv::goodFeaturesToTrack(gray0, reference, 50, 0.01, 8);
+    ASSERT_EQ(found, (int)reference.size());
+    for (int i = 0; i < found; i++) {
+        EXPECT_EQ(points[i * 2], reference[i].x);
+        EXPECT_EQ(points[i * 2 + 1], reference[i].y);
+    }
+
+    std::vector<float> next(2 * found), error(found);
+    std::vector<uint8_t> status(found);
+    ASSERT_EQ(cv_flow_tracker_track(tracker, handle(frame1), points.data(), found, next.data(), status.data(), error.data()), 1);
+    int good = 0;
+    for (int i = 0; i < found; i++) {
+        if (!status[i]) continue;
+        // 영상 경계 근처는 복제 경계 때문에 제외
+        if (points[i * 2] < 25 || points[i * 2] > 295 || points[i * 2 + 1] < 25 || points[i * 2 + 1] > 215) continue;
+        EXPECT_NEAR(next[i * 2] - points[i * 2], 2.0, 0.2) << "point " << i;
+        EXPECT_NEAR(next[i * 2 + 1] - points[i * 2 + 1], 1.0, 0.2) << "point " << i;
+        good++;
+    }
+    EXPECT_GT(good, found / 2);
+
+    // 리셋 후에는 다시 첫 프레임
+    cv_flow_tracker_reset(tracker);
+    EXPECT_EQ(cv_flow_tracker_detect(tracker, 50, 0.01, 8, points.data()), 0);
+    EXPECT_EQ(cv_flow_tracker_track(tracker, handle(frame1), points.data(), found, next.data(), nullptr, nullptr), 0);
+    cv_flow_tracker_release(tracker);
+}
+
+TEST(Flow, DenseMatchesOpenCV) {
+    cv::Mat frame0 = test::make_scene(160, 120, 3);
+    cv::Mat frame1 = shifted(frame0, 1.5, -1);
+    cv::Mat gray0, gray1;
+    cv::cvtColor(frame0, gray0, cv::COLOR_BGR2GRAY);
+    cv::cvtColor(frame1, gray1, cv::COLOR_BGR2GRAY);
+
+    cv::Mat expected;
+    cv::calcOpticalFlowFarneback(gray0, gray1, expected, 0.5, 3, 15, 3, 5, 1.2, 0);
+    EXPECT_TRUE(mat_near(MatPtr(cv_optical_flow_dense(handle(frame0), handle(frame1), 1, 0)), expected, 1e-4));
+
+    for (int preset : {cv::DISOpticalFlow::PRESET_ULTRAFAST, cv::DISOpticalFlow::PRESET_FAST, cv::DISOpticalFlow::PRESET_MEDIUM}) {
+        cv::DISOpticalFlow::create(preset)->calc(gray0, gray1, expected);
+        // 프리셋별 스레드 로컬 인스턴스 재사용. 두 번 호출해도 같은 결과
+        for (int call = 0; call < 2; call++) {
+            MatPtr flow(cv_optical_flow_dense(handle(frame0), handle(frame1), 0, preset));
+            EXPECT_TRUE(mat_near(flow, expected, 1e-4)) << "preset " << preset << " call " << call;
+        }
+    }
+
+    // 중앙부 평균 이동량이 실제 이동과 비슷해야 함
+    MatPtr flow(cv_optical_flow_dense(handle(frame0), handle(frame1), 0, cv::DISOpticalFlow::PRESET_MEDIUM));
+    ASSERT_NE(flow, nullptr);
+    cv::Scalar mean = cv::mean(mat_of(flow)(cv::Rect(30, 30, 100, 60)));
+    EXPECT_NEAR(mean[0], 1.5, 0.3);
+    EXPECT_NEAR(mean[1], -1.0, 0.3);
+
+    cv::Mat small(60, 80, CV_8UC3);
+    EXPECT_EQ(cv_optical_flow_dense(handle(frame0), handle(small), 0, 0), nullptr);
+}
+
+TEST(Denoise, NlMeansMatchesOpenCV) {
+    cv::Mat bgr = test::make_scene(96, 72, 3);
+    cv::Mat gray = test::make_scene(96, 72, 1);
+    cv::Mat expected;
+    cv::fastNlMeansDenoising(gray, expected, 10, 7, 21);
+    EXPECT_TRUE(mat_near(MatPtr(cv_fast_nl_means_denoising(handle(gray), 10, 7, 21)), expected, 0));
+    cv::fastNlMeansDenoisingColored(bgr, expected, 10, 10, 7, 21);
+    EXPECT_TRUE(mat_near(MatPtr(cv_fast_nl_means_denoising_colored(handle(bgr), 10, 10, 7, 21)), expected, 0));
+}
+
+TEST(Contours, MatchFindContours) {
+    cv::Mat binary(200, 300, CV_8UC1, cv::Scalar(0));
+    cv::rectangle(binary, cv::Rect(20, 20, 80, 60), cv::Scalar(255), -1);
+    cv::rectangle(binary, cv::Rect(40, 35, 30, 20), cv::Scalar(0), -1);
+    cv::circle(binary, cv::Point(200, 120), 50, cv::Scalar(255), -1);
+    cv::line(binary, cv::Point(150, 20), cv::Point(280, 40), cv::Scalar(255), 3);
+
+    for (int mode : {cv::RETR_EXTERNAL, cv::RETR_LIST, cv::RETR_TREE}) {
+        for (int method : {cv::CHAIN_APPROX_NONE, cv::CHAIN_APPROX_SIMPLE}) {
+            std::vector<std::vector<cv::Point>> expected;
+            cv::findContours(binary.clone(), expected, mode, method);
+            struct ContoursResult result = cv_find_contours(handle(binary), mode, method);
+            ASSERT_EQ(result.num_contours, (int)expected.size()) << "mode " << mode << " method " << method;
+            for (int i = 0; i < result.num_contours; i++) {
+                ASSERT_EQ(result.contour_sizes[i], (int)expected[i].size());
+                for (int j = 0; j < result.contour_sizes[i]; j++) {
+                    EXPECT_EQ(result.contours[i][j * 2], expected[i][j].x);
+                    EXPECT_EQ(result.contours[i][j * 2 + 1], expected[i][j].y);
+                }
+            }
+            cv_free_contours(result);
+        }
+    }
+}
+
+TEST(Contours, EmptyImageReturnsNullArrays) {
+    cv::Mat empty(50, 50, CV_8UC1, cv::Scalar(0));
+    struct ContoursResult result = cv_find_contours(handle(empty), cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+    EXPECT_EQ(result.num_contours, 0);
+    EXPECT_EQ(result.contours, nullptr);
+    EXPECT_EQ(result.contour_sizes, nullptr);
+    cv_free_contours(result);
+
+    result = cv_find_contours(nullptr, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE);
+    EXPECT_EQ(result.num_contours, 0);
+    // 빈 결과를 그려도 영상은 그대로
+    cv::Mat canvas(50, 50, CV_8UC3, cv::Scalar(1, 2, 3));
+    const cv::Mat before = canvas.clone();
+    cv_draw_contours(handle(canvas), result, -1, 255, 0, 0, 1);
+    EXPECT_TRUE(mat_near(canvas, before, 0));
+}
+
+// 컨투어 배열은 malloc 으로 할당되고 cv_free_contours 로 해제됨 (ASan/LSan 빌드에서 누수 확인)
+TEST(Contours, FreeLoop) {
+    cv::Mat binary(120, 160, CV_8UC1, cv::Scalar(0));
+    for (int i = 0; i < 12; i++) cv::circle(binary, cv::Point(15 + (i % 4) * 40, 20 + (i / 4) * 40), 10 + i % 3, cv::Scalar(255), -1);
+    for (int i = 0; i < 200; i++) {
+        struct ContoursResult result = cv_find_contours(handle(binary), cv::RETR_LIST, i % 2 == 0 ? cv::CHAIN_APPROX_NONE : cv::CHAIN_APPROX_SIMPLE);
+        ASSERT_EQ(result.num_contours, 12);
+        cv_free_contours(result);
+    }
+}
+
+TEST(Drawing, MatchesOpenCV) {
+    cv::Mat canvas(120, 160, CV_8UC3, cv::Scalar(10, 20, 30));
+    cv::Mat expected = canvas.clone();
+
+    // r, g, b 순서 인자 -> BGR Scalar
+    cv_rectangle(handle(canvas), 10, 15, 60, 40, 255, 128, 0, 2);
+    cv::rectangle(expected, cv::Rect(10, 15, 60, 40), cv::Scalar(0, 128, 255), 2);
+    cv_circle(handle(canvas), 100, 60, 25, 0, 255, 0, -1);
+    cv::circle(expected, cv::Point(100, 60), 25, cv::Scalar(0, 255, 0), -1);
+    cv_line(handle(canvas), 0, 119, 159, 0, 12, 34, 56, 3);
+    cv::line(expected, cv::Point(0, 119), cv::Point(159, 0), cv::Scalar(56, 34, 12), 3);
+    EXPECT_TRUE(mat_near(canvas, expected, 0));
+
+    cv::Mat binary(120, 160, CV_8UC1, cv::Scalar(0));
+    cv::rectangle(binary, cv::Rect(30, 30, 50, 40), cv::Scalar(255), -1);
+    struct ContoursResult result = cv_find_contours(handle(binary), cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+    std::vector<std::vector<cv::Point>> contours;
+    cv::findContours(binary.clone(), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+    cv_draw_contours(handle(canvas), result, -1, 200, 100, 50, 2);
+    cv::drawContours(expected, contours, -1, cv::Scalar(50, 100, 200), 2);
+    EXPECT_TRUE(mat_near(canvas, expected, 0));
+    cv_free_contours(result);
+
+    cv_rectangle(nullptr, 0, 0, 1, 1, 0, 0, 0, 1);
+}
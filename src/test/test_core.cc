@@ -0,0 +1,428 @@
+// Mat / 입출력 / 색 변환 / 기하 변환 / 리맵 캐시 / 보정 / 피라미드
+#include "test_util.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using test::handle;
+using test::mat_near;
+using test::mat_of;
+using test::MatPtr;
+
+TEST(Core, Version) {
+    ASSERT_NE(opencv_version(), nullptr);
+    EXPECT_STREQ(opencv_version(), CV_VERSION);
+}
+
+TEST(Core, MatAccessors) {
+    MatPtr empty(cv_mat_create());
+    ASSERT_NE(empty, nullptr);
+    EXPECT_EQ(cv_mat_width(empty.get()), 0);
+    EXPECT_EQ(cv_mat_data_len(empty.get()), 0);
+
+    cv::Mat image = test::make_scene(97, 61, 3);
+    EXPECT_EQ(cv_mat_width(handle(image)), 97);
+    EXPECT_EQ(cv_mat_height(handle(image)), 61);
+    EXPECT_EQ(cv_mat_channels(handle(image)), 3);
+    EXPECT_EQ(cv_mat_data(handle(image)), image.data);
+    EXPECT_EQ(cv_mat_data_len(handle(image)), 97 * 61 * 3);
+
+    EXPECT_EQ(cv_mat_width(nullptr), 0);
+    EXPECT_EQ(cv_mat_data(nullptr), nullptr);
+    cv_mat_release(nullptr);
+}
+
+TEST(Core, MatInfo) {
+    struct CvMatInfo info;
+    cv::Mat image = test::make_scene(97, 61, 4);
+    ASSERT_EQ(cv_mat_info(handle(image), &info), 1);
+    EXPECT_EQ(info.width, 97);
+    EXPECT_EQ(info.height, 61);
+    EXPECT_EQ(info.channels, 4);
+    EXPECT_EQ(info.type, CV_8UC4);
+    EXPECT_EQ(info.depth, CV_8U);
+    EXPECT_EQ(info.elemSize, 4);
+    EXPECT_EQ(info.step, 97 * 4);
+    EXPECT_EQ(info.dataLen, 97 * 61 * 4);
+    EXPECT_EQ(info.continuous, 1);
+    EXPECT_EQ(info.empty, 0);
+
+    // ROI 는 부모의 행 간격을 유지하고 연속이 아님
+    cv::Mat roi = image(cv::Rect(10, 5, 40, 20));
+    ASSERT_EQ(cv_mat_info(handle(roi), &info), 1);
+    EXPECT_EQ(info.width, 40);
+    EXPECT_EQ(info.step, 97 * 4);
+    EXPECT_EQ(info.dataLen, 40 * 20 * 4);
+    EXPECT_EQ(info.continuous, 0);
+
+    cv::Mat floats(8, 6, CV_32FC2);
+    ASSERT_EQ(cv_mat_info(handle(floats), &info), 1);
+    EXPECT_EQ(info.type, CV_32FC2);
+    EXPECT_EQ(info.depth, CV_32F);
+    EXPECT_EQ(info.elemSize, 8);
+
+    MatPtr empty(cv_mat_create());
+    ASSERT_EQ(cv_mat_info(empty.get(), &info), 1);
+    EXPECT_EQ(info.empty, 1);
+    EXPECT_EQ(info.dataLen, 0);
+
+    EXPECT_EQ(cv_mat_info(nullptr, &info), 0);
+    EXPECT_EQ(cv_mat_info(handle(image), nullptr), 0);
+}
+
+TEST(Core, ImwriteImread) {
+    cv::Mat image = test::make_scene(120, 80, 3);
+    const std::string path = test::temp_path("core.png");
+    ASSERT_EQ(cv_imwrite(path.c_str(), handle(image)), 1);
+    MatPtr loaded(cv_imread(path.c_str()));
+    EXPECT_TRUE(mat_near(loaded, image, 0));
+    std::remove(path.c_str());
+
+    EXPECT_EQ(cv_imread(test::temp_path("missing.png").c_str()), nullptr);
+}
+
+TEST(Core, ImencodeImdecodePng) {
+    cv::Mat image = test::make_scene(160, 90, 3);
+    struct BytesResult bytes = cv_imencode(".png", handle(image));
+    ASSERT_NE(bytes.data, nullptr);
+    ASSERT_GT(bytes.len, 0);
+
+    std::vector<uint8_t> reference;
+    cv::imencode(".png", image, reference);
+    ASSERT_EQ((size_t)bytes.len, reference.size());
+    EXPECT_EQ(std::memcmp(bytes.data, reference.data(), reference.size()), 0);
+
+    MatPtr decoded(cv_imdecode(bytes.data, bytes.len));
+    EXPECT_TRUE(mat_near(decoded, image, 0));
+    cv_free_bytes(bytes);
+}
+
+TEST(Core, ImencodeJpegMatchesOpenCV) {
+    cv::Mat image = test::make_scene(320, 240, 3);
+    struct BytesResult bytes = cv_imencode(".jpg", handle(image));
+    ASSERT_NE(bytes.data, nullptr);
+    std::vector<uint8_t> reference;
+    cv::imencode(".jpg", image, reference);
+    EXPECT_EQ(std::vector<uint8_t>(bytes.data, bytes.data + bytes.len), reference);
+    cv_free_bytes(bytes);
+}
+
+TEST(Core, ImdecodeRejectsGarbage) {
+    const uint8_t garbage[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    EXPECT_EQ(cv_imdecode(garbage, sizeof(garbage)), nullptr);
+}
+
+// cv_imencode 가 malloc 한 버퍼는 cv_free_bytes 로만 해제됨 (ASan/LSan 빌드에서 누수 확인)
+TEST(Core, ImencodeFreeLoop) {
+    cv::Mat image = test::make_scene(64, 48, 3);
+    for (int i = 0; i < 200; i++) {
+        struct BytesResult bytes = cv_imencode(i % 2 == 0 ? ".png" : ".jpg", handle(image));
+        ASSERT_NE(bytes.data, nullptr);
+        cv_free_bytes(bytes);
+    }
+}
+
+TEST(Core, ColorConversions) {
+    cv::Mat bgr = test::make_scene(131, 77, 3);
+    struct Case {
+        CvMat* (*fn)(CvMat*);
+        int code;
+    } cases[] = {
+        {cv_cvtColor_bgr2gray, cv::COLOR_BGR2GRAY},
+        {cv_cvtColor_bgr2rgb, cv::COLOR_BGR2RGB},
+        {cv_cvtColor_bgr2hsv, cv::COLOR_BGR2HSV},
+        {cv_cvtColor_bgr2lab, cv::COLOR_BGR2Lab},
+    };
+    for (const Case& c : cases) {
+        cv::Mat expected;
+        cv::cvtColor(bgr, expected, c.code);
+        MatPtr actual(c.fn(handle(bgr)));
+        EXPECT_TRUE(mat_near(actual, expected, 0)) << "code " << c.code;
+    }
+
+    cv::Mat hsv, lab, expected;
+    cv::cvtColor(bgr, hsv, cv::COLOR_BGR2HSV);
+    cv::cvtColor(hsv, expected, cv::COLOR_HSV2BGR);
+    EXPECT_TRUE(mat_near(MatPtr(cv_cvtColor_hsv2bgr(handle(hsv))), expected, 0));
+    cv::cvtColor(bgr, lab, cv::COLOR_BGR2Lab);
+    cv::cvtColor(lab, expected, cv::COLOR_Lab2BGR);
+    EXPECT_TRUE(mat_near(MatPtr(cv_cvtColor_lab2bgr(handle(lab))), expected, 0));
+}
+
+TEST(Core, ResizeExplicitInterpolation) {
+    cv::Mat image = test::make_scene(200, 150, 3);
+    for (int interp : {cv::INTER_NEAREST, cv::INTER_LINEAR, cv::INTER_CUBIC}) {
+        cv::Mat expected;
+        cv::resize(image, expected, cv::Size(130, 70), 0, 0, interp);
+        EXPECT_TRUE(mat_near(MatPtr(cv_resize(handle(image), 130, 70, interp)), expected, 0)) << "interp " << interp;
+    }
+}
+
+TEST(Core, ResizeAutoInterpolation) {
+    cv::Mat image = test::make_scene(400, 300, 3);
+    cv::Mat expected;
+    // 확대는 LINEAR
+    cv::resize(image, expected, cv::Size(520, 390), 0, 0, cv::INTER_LINEAR);
+    EXPECT_TRUE(mat_near(MatPtr(cv_resize(handle(image), 520, 390, -1)), expected, 0));
+    // 정수배 축소는 박스 축소 경로 (반올림 차이만 허용)
+    cv::resize(image, expected, cv::Size(100, 75), 0, 0, cv::INTER_AREA);
+    EXPECT_TRUE(mat_near(MatPtr(cv_resize(handle(image), 100, 75, -1)), expected, 1));
+    // 비정수배 축소 (박스 축소 후 나머지 AREA)
+    cv::resize(image, expected, cv::Size(150, 110), 0, 0, cv::INTER_AREA);
+    MatPtr actual(cv_resize(handle(image), 150, 110, -1));
+    ASSERT_NE(actual, nullptr);
+    EXPECT_LT(test::mean_abs_diff(mat_of(actual), expected), 1.0);
+}
+
+TEST(Core, FlipRotate) {
+    cv::Mat image = test::make_scene(90, 50, 3);
+    for (int mode : {0, 1, -1}) {
+        cv::Mat expected;
+        cv::flip(image, expected, mode);
+        EXPECT_TRUE(mat_near(MatPtr(cv_flip(handle(image), mode)), expected, 0));
+    }
+    for (int code : {cv::ROTATE_90_CLOCKWISE, cv::ROTATE_180, cv::ROTATE_90_COUNTERCLOCKWISE}) {
+        cv::Mat expected;
+        cv::rotate(image, expected, code);
+        EXPECT_TRUE(mat_near(MatPtr(cv_rotate(handle(image), code)), expected, 0));
+    }
+}
+
+TEST(Core, WarpAffinePerspective) {
+    cv::Mat image = test::make_scene(160, 120, 3);
+    const double affine[6] = {0.9, 0.2, 5, -0.15, 1.05, 8};
+    const double perspective[9] = {1.0, 0.1, 3, 0.05, 0.95, 2, 0.0004, 0.0002, 1};
+
+    cv::Mat expected;
+    cv::warpAffine(image, expected, cv::Mat(2, 3, CV_64F, (void*)affine), cv::Size(140, 100), cv::INTER_LINEAR, cv::BORDER_REFLECT);
+    EXPECT_TRUE(mat_near(MatPtr(cv_warp_affine(handle(image), affine, 140, 100, cv::INTER_LINEAR, cv::BORDER_REFLECT)), expected, 0));
+    // 크기 0 이면 입력 크기
+    cv::warpAffine(image, expected, cv::Mat(2, 3, CV_64F, (void*)affine), image.size(), cv::INTER_NEAREST, cv::BORDER_CONSTANT);
+    EXPECT_TRUE(mat_near(MatPtr(cv_warp_affine(handle(image), affine, 0, 0, cv::INTER_NEAREST, cv::BORDER_CONSTANT)), expected, 0));
+
+    cv::warpPerspective(image, expected, cv::Mat(3, 3, CV_64F, (void*)perspective), image.size(), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    EXPECT_TRUE(mat_near(MatPtr(cv_warp_perspective(handle(image), perspective, 0, 0, cv::INTER_LINEAR, cv::BORDER_REPLICATE)), expected, 0));
+}
+
+namespace {
+
+// 소용돌이 형태의 입력 좌표 맵
+void make_maps(int width, int height, cv::Mat& mapX, cv::Mat& mapY) {
+    mapX.create(height, width, CV_32FC1);
+    mapY.create(height, width, CV_32FC1);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const float dx = x - width * 0.5f, dy = y - height * 0.5f;
+            const float a = 0.0004f * std::sqrt(dx * dx + dy * dy);
+            mapX.at<float>(y, x) = width * 0.5f + dx * std::cos(a) - dy * std::sin(a);
+            mapY.at<float>(y, x) = height * 0.5f + dx * std::sin(a) + dy * std::cos(a);
+        }
+    }
+}
+
+} // namespace
+
+TEST(Core, Remap) {
+    cv::Mat image = test::make_scene(150, 100, 3);
+    cv::Mat mapX, mapY, expected;
+    make_maps(120, 90, mapX, mapY);
+    cv::remap(image, expected, mapX, mapY, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    EXPECT_TRUE(mat_near(MatPtr(cv_remap(handle(image), handle(mapX), handle(mapY), cv::INTER_LINEAR, cv::BORDER_CONSTANT)), expected, 0));
+}
+
+// 리맵 캐시는 OpenCV 와 같은 고정소수점 맵을 쓰므로 warpAffine/warpPerspective/remap 결과와 거의 같아야 함
+TEST(Core, RemapCacheMatchesWarp) {
+    cv::Mat image = test::make_scene(160, 120, 3);
+    const double affine[6] = {0.9, 0.2, 5, -0.15, 1.05, 8};
+    const double perspective[9] = {1.0, 0.1, 3, 0.05, 0.95, 2, 0.0004, 0.0002, 1};
+    cv::Mat expected;
+
+    CvRemapCache* cache = cv_remap_cache_create_affine(affine, 140, 100, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    ASSERT_NE(cache, nullptr);
+    cv::warpAffine(image, expected, cv::Mat(2, 3, CV_64F, (void*)affine), cv::Size(140, 100), cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(mat_near(MatPtr(cv_remap_cache_apply(cache, handle(image))), expected, 1));
+    }
+    cv_remap_cache_release(cache);
+
+    cache = cv_remap_cache_create_perspective(perspective, 160, 120, cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    ASSERT_NE(cache, nullptr);
+    cv::warpPerspective(image, expected, cv::Mat(3, 3, CV_64F, (void*)perspective), image.size(), cv::INTER_LINEAR, cv::BORDER_REPLICATE);
+    EXPECT_TRUE(mat_near(MatPtr(cv_remap_cache_apply(cache, handle(image))), expected, 1));
+    cv_remap_cache_release(cache);
+
+    cv::Mat mapX, mapY;
+    make_maps(120, 90, mapX, mapY);
+    cache = cv_remap_cache_create_maps(handle(mapX), handle(mapY), cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    ASSERT_NE(cache, nullptr);
+    cv::remap(image, expected, mapX, mapY, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    EXPECT_TRUE(mat_near(MatPtr(cv_remap_cache_apply(cache, handle(image))), expected, 1));
+    cv_remap_cache_release(cache);
+
+    EXPECT_EQ(cv_remap_cache_apply(nullptr, handle(image)), nullptr);
+    cv_remap_cache_release(nullptr);
+}
+
+TEST(Core, CalibrationFromChessboard) {
+    CvCalibration* calib = cv_calibration_create(9, 6, 25.0f);
+    ASSERT_NE(calib, nullptr);
+    cv::Mat board = test::make_chessboard(640, 480, 40);
+
+    // 조금씩 다른 시점의 체스보드
+    float corners[9 * 6 * 2];
+    const double views[4][9] = {
+        {1, 0, 0, 0, 1, 0, 0, 0, 1},
+        {0.95, 0.08, 10, -0.05, 0.97, 12, 0.0002, 0.0001, 1},
+        {1.02, -0.06, -8, 0.07, 1.0, 5, -0.0001, 0.0002, 1},
+        {0.9, 0.0, 30, 0.0, 0.9, 20, 0.0003, -0.0002, 1},
+    };
+    for (const double* h : views) {
+        cv::Mat view;
+        cv::warpPerspective(board, view, cv::Mat(3, 3, CV_64F, (void*)h), board.size(), cv::INTER_LINEAR, cv::BORDER_CONSTANT, cv::Scalar(255));
+        cv::Mat bgr;
+        cv::cvtColor(view, bgr, cv::COLOR_GRAY2BGR);
+        EXPECT_EQ(cv_calibration_add_frame(calib, handle(bgr), corners), 1);
+    }
+    EXPECT_EQ(cv_calibration_frame_count(calib), 4);
+
+    // 체스보드가 없는 프레임은 무시
+    cv::Mat blank(480, 640, CV_8UC3, cv::Scalar(128, 128, 128));
+    EXPECT_EQ(cv_calibration_add_frame(calib, handle(blank), nullptr), 0);
+    EXPECT_EQ(cv_calibration_frame_count(calib), 4);
+
+    const double rms = cv_calibration_calibrate(calib);
+    EXPECT_GE(rms, 0.0);
+    EXPECT_LT(rms, 2.0);
+
+    double cameraMatrix[9], distCoeffs[5];
+    int size[2];
+    ASSERT_EQ(cv_calibration_get_params(calib, cameraMatrix, distCoeffs, size), 1);
+    EXPECT_EQ(size[0], 640);
+    EXPECT_EQ(size[1], 480);
+    EXPECT_GT(cameraMatrix[0], 0.0);
+
+    // 저장 -> 불러오기 왕복
+    const std::string path = test::temp_path("calibration.yml");
+    ASSERT_EQ(cv_calibration_save(calib, path.c_str()), 1);
+    CvCalibration* loaded = cv_calibration_load(path.c_str());
+    ASSERT_NE(loaded, nullptr);
+    double loadedMatrix[9], loadedDist[5];
+    int loadedSize[2];
+    ASSERT_EQ(cv_calibration_get_params(loaded, loadedMatrix, loadedDist, loadedSize), 1);
+    for (int i = 0; i < 9; i++) EXPECT_NEAR(loadedMatrix[i], cameraMatrix[i], 1e-9);
+    for (int i = 0; i < 5; i++) EXPECT_NEAR(loadedDist[i], distCoeffs[i], 1e-9);
+    std::remove(path.c_str());
+
+    cv_calibration_release(loaded);
+    cv_calibration_release(calib);
+}
+
+// 파싱 예외 (행렬 원소 수 불일치) 는 nullptr 로 끝나야 하고 새니타이저 빌드에서 누수가 없어야 함
+TEST(Calibration, LoadCorruptFileReturnsNull) {
+    const std::string path = test::temp_path("calibration_corrupt.yml");
+    {
+        std::ofstream out(path);
+        out << "%YAML:1.0\n---\nimage_width: 640\nimage_height: 480\n"
+            << "camera_matrix: !!opencv-matrix\n   rows: 3\n   cols: 3\n   dt: d\n   data: [ 1., 0., 320. ]\n";
+    }
+    EXPECT_EQ(cv_calibration_load(path.c_str()), nullptr);
+    std::remove(path.c_str());
+    EXPECT_EQ(cv_calibration_load(test::temp_path("calibration_missing.yml").c_str()), nullptr);
+}
+
+TEST(Core, CalibrationRequiresThreeFrames) {
+    CvCalibration* calib = cv_calibration_create(9, 6, 1.0f);
+    ASSERT_NE(calib, nullptr);
+    EXPECT_EQ(cv_calibration_calibrate(calib), -1.0);
+    EXPECT_EQ(cv_calibration_save(calib, test::temp_path("empty.yml").c_str()), 0);
+    cv_calibration_release(calib);
+    EXPECT_EQ(cv_calibration_create(1, 6, 1.0f), nullptr);
+}
+
+// 알려진 파라미터로 만든 왜곡 보정 캐시는 initUndistortRectifyMap + remap 과 같아야 함
+TEST(Core, UndistorterMatchesOpenCV) {
+    const double cameraMatrix[9] = {500, 0, 320, 0, 500, 240, 0, 0, 1};
+    const double distCoeffs[5] = {-0.2, 0.05, 0.001, -0.001, 0.0};
+    CvCalibration* calib = cv_calibration_create(9, 6, 1.0f);
+    ASSERT_NE(calib, nullptr);
+    cv_calibration_set_params(calib, cameraMatrix, distCoeffs, 640, 480);
+
+    CvRemapCache* undistorter = cv_undistorter_create(calib, 0.0, cv::INTER_LINEAR);
+    ASSERT_NE(undistorter, nullptr);
+
+    cv::Mat K(3, 3, CV_64F, (void*)cameraMatrix), D(1, 5, CV_64F, (void*)distCoeffs);
+    cv::Mat newK = cv::getOptimalNewCameraMatrix(K, D, cv::Size(640, 480), 0.0);
+    cv::Mat mapX, mapY, expected;
+    cv::initUndistortRectifyMap(K, D, cv::Mat(), newK, cv::Size(640, 480), CV_32FC1, mapX, mapY);
+    cv::Mat image = test::make_scene(640, 480, 3);
+    cv::remap(image, expected, mapX, mapY, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+
+    MatPtr actual(cv_remap_cache_apply(undistorter, handle(image)));
+    ASSERT_NE(actual, nullptr);
+    EXPECT_LT(test::mean_abs_diff(mat_of(actual), expected), 0.5);
+
+    cv_remap_cache_release(undistorter);
+    cv_calibration_release(calib);
+}
+
+TEST(Core, PyramidMatchesPyrDownPyrUp) {
+    cv::Mat image = test::make_scene(320, 200, 3);
+    CvPyramid* pyramid = cv_pyramid_create(handle(image), 3);
+    ASSERT_NE(pyramid, nullptr);
+    ASSERT_EQ(cv_pyramid_levels(pyramid), 3);
+
+    std::vector<cv::Mat> gaussian(4);
+    gaussian[0] = image;
+    for (int i = 1; i <= 3; i++) cv::pyrDown(gaussian[i - 1], gaussian[i]);
+
+    for (int level = 0; level <= 3; level++) {
+        EXPECT_TRUE(mat_near(MatPtr(cv_pyramid_gaussian(pyramid, level)), gaussian[level], 0)) << "level " << level;
+    }
+    for (int level = 0; level < 3; level++) {
+        cv::Mat up, expected;
+        cv::pyrUp(gaussian[level + 1], up, gaussian[level].size());
+        cv::subtract(gaussian[level], up, expected, cv::noArray(), CV_16S);
+        EXPECT_TRUE(mat_near(MatPtr(cv_pyramid_laplacian(pyramid, level)), expected, 0)) << "level " << level;
+    }
+    // level == levels 는 가장 작은 Gaussian
+    EXPECT_TRUE(mat_near(MatPtr(cv_pyramid_laplacian(pyramid, 3)), gaussian[3], 0));
+    EXPECT_EQ(cv_pyramid_gaussian(pyramid, 4), nullptr);
+
+    // 반환된 레벨에 기본 경계 필터를 적용해도 다른 레벨이나 초기화되지 않은 메모리를 읽지 않아야 함
+    for (int level = 1; level <= 3; level++) {
+        MatPtr view(cv_pyramid_gaussian(pyramid, level));
+        cv::Mat expected, actual;
+        cv::GaussianBlur(gaussian[level], expected, cv::Size(7, 7), 0);
+        cv::GaussianBlur(mat_of(view), actual, cv::Size(7, 7), 0);
+        EXPECT_TRUE(mat_near(actual, expected, 0)) << "level " << level;
+    }
+    for (int level = 0; level < 3; level++) {
+        MatPtr lap(cv_pyramid_laplacian(pyramid, level));
+        cv::Mat up, reference, expected, actual;
+        cv::pyrUp(gaussian[level + 1], up, gaussian[level].size());
+        cv::subtract(gaussian[level], up, reference, cv::noArray(), CV_16S);
+        cv::erode(reference, expected, cv::Mat());
+        cv::erode(mat_of(lap), actual, cv::Mat());
+        EXPECT_TRUE(mat_near(actual, expected, 0)) << "level " << level;
+    }
+
+    // 반환된 뷰는 피라미드를 해제해도 유효
+    MatPtr level2(cv_pyramid_gaussian(pyramid, 2));
+    cv_pyramid_release(pyramid);
+    EXPECT_TRUE(mat_near(level2, gaussian[2], 0));
+}
+
+TEST(Core, PyramidAutoLevels) {
+    cv::Mat image = test::make_scene(256, 64, 1);
+    CvPyramid* pyramid = cv_pyramid_create(handle(image), 0);
+    ASSERT_NE(pyramid, nullptr);
+    // 짧은 변 64 -> 32 -> 16
+    EXPECT_EQ(cv_pyramid_levels(pyramid), 2);
+    cv_pyramid_release(pyramid);
+
+    cv::Mat tiny(20, 20, CV_8UC1, cv::Scalar(0));
+    EXPECT_EQ(cv_pyramid_create(handle(tiny), 0), nullptr);
+}
@@ -0,0 +1,575 @@
+// 필터 / 형태학 / 커널 / 임계값 / 문서 이진화 / 적분 영상 / 히스토그램 / CLAHE / LUT
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+using test::handle;
+using test::mat_near;
+using test::mat_of;
+using test::MatPtr;
+
+TEST(Filters, DirectOpenCVCalls) {
+    cv::Mat bgr = test::make_scene(181, 123, 3);
+    cv::Mat gray = test::make_scene(181, 123, 1);
+    cv::Mat expected;
+
+    cv::GaussianBlur(bgr, expected, cv::Size(7, 7), 1.5);
+    EXPECT_TRUE(mat_near(MatPtr(cv_gaussian_blur(handle(bgr), 7, 1.5)), expected, 0));
+    // 짝수 크기는 다음 홀수로 보정
+    cv::GaussianBlur(bgr, expected, cv::Size(5, 5), 0);
+    EXPECT_TRUE(mat_near(MatPtr(cv_gaussian_blur(handle(bgr), 4, 0)), expected, 0));
+
+    cv::medianBlur(bgr, expected, 5);
+    EXPECT_TRUE(mat_near(MatPtr(cv_median_blur(handle(bgr), 5)), expected, 0));
+    cv::bilateralFilter(bgr, expected, 9, 75, 75);
+    EXPECT_TRUE(mat_near(MatPtr(cv_bilateral_filter(handle(bgr), 9, 75, 75)), expected, 0));
+    cv::Canny(gray, expected, 50, 150);
+    EXPECT_TRUE(mat_near(MatPtr(cv_canny(handle(gray), 50, 150)), expected, 0));
+    cv::Sobel(gray, expected, CV_8U, 1, 0, 3);
+    EXPECT_TRUE(mat_near(MatPtr(cv_sobel(handle(gray), 1, 0, 3)), expected, 0));
+    cv::Laplacian(gray, expected, CV_8U, 3);
+    EXPECT_TRUE(mat_near(MatPtr(cv_laplacian(handle(gray), 3)), expected, 0));
+
+    const cv::Mat sharpen = (cv::Mat_<float>(3, 3) << 0, -1, 0, -1, 5, -1, 0, -1, 0);
+    cv::filter2D(bgr, expected, -1, sharpen);
+    EXPECT_TRUE(mat_near(MatPtr(cv_sharpen(handle(bgr))), expected, 0));
+
+    EXPECT_EQ(cv_gaussian_blur(nullptr, 3, 0), nullptr);
+    EXPECT_EQ(cv_sharpen(nullptr), nullptr);
+}
+
+// 작은 커널은 cv::erode/dilate, 큰 사각형은 vHGW 경로. 둘 다 OpenCV 결과와 정확히 같아야 함
+TEST(Filters, ErodeDilateMatchOpenCV) {
+    for (int channels : {1, 3}) {
+        cv::Mat image = test::make_scene(203, 117, channels);
+        for (int ksize : {3, 15, 21}) {
+            for (int iterations : {1, 2}) {
+                const cv::Mat element = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(ksize, ksize));
+                cv::Mat expected;
+                cv::erode(image, expected, element, cv::Point(-1, -1), iterations);
+                EXPECT_TRUE(mat_near(MatPtr(cv_erode(handle(image), ksize, iterations)), expected, 0))
+                    << "erode cn " << channels << " k " << ksize << " it " << iterations;
+                cv::dilate(image, expected, element, cv::Point(-1, -1), iterations);
+                EXPECT_TRUE(mat_near(MatPtr(cv_dilate(handle(image), ksize, iterations)), expected, 0))
+                    << "dilate cn " << channels << " k " << ksize << " it " << iterations;
+            }
+        }
+    }
+}
+
+TEST(Filters, MorphologyExMatchesOpenCV) {
+    cv::Mat image = test::make_scene(160, 120, 1);
+    const int ops[] = {cv::MORPH_OPEN, cv::MORPH_CLOSE, cv::MORPH_GRADIENT, cv::MORPH_TOPHAT, cv::MORPH_BLACKHAT};
+    for (int op : ops) {
+        for (int ksize : {5, 17}) {
+            const cv::Mat element = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(ksize, ksize));
+            cv::Mat expected;
+            cv::morphologyEx(image, expected, op, element);
+            EXPECT_TRUE(mat_near(MatPtr(cv_morphology_ex(handle(image), op, ksize)), expected, 0)) << "op " << op << " k " << ksize;
+        }
+    }
+}
+
+TEST(Filters, KernelObjects) {
+    cv::Mat image = test::make_scene(150, 110, 3);
+    for (int shape : {cv::MORPH_RECT, cv::MORPH_CROSS, cv::MORPH_ELLIPSE}) {
+        CvKernel* kernel = cv_kernel_create(shape, 7, 5);
+        ASSERT_NE(kernel, nullptr);
+        const cv::Mat element = cv::getStructuringElement(shape, cv::Size(7, 5));
+        cv::Mat expected;
+
+        cv::erode(image, expected, element, cv::Point(-1, -1), 2);
+        EXPECT_TRUE(mat_near(MatPtr(cv_erode_kernel(handle(image), kernel, 2)), expected, 0)) << "shape " << shape;
+        cv::dilate(image, expected, element);
+        EXPECT_TRUE(mat_near(MatPtr(cv_dilate_kernel(handle(image), kernel, 1)), expected, 0)) << "shape " << shape;
+        cv::morphologyEx(image, expected, cv::MORPH_CLOSE, element);
+        EXPECT_TRUE(mat_near(MatPtr(cv_morphology_ex_kernel(handle(image), cv::MORPH_CLOSE, kernel, 1)), expected, 0)) << "shape " << shape;
+
+        // 정규화된 평균 필터 (사각형은 분리 가능 고정소수점 경로, ±1 반올림)
+        cv::Mat weights;
+        element.convertTo(weights, CV_32F, 1.0 / cv::countNonZero(element));
+        cv::filter2D(image, expected, -1, weights, cv::Point(-1, -1), 0, cv::BORDER_REFLECT_101);
+        EXPECT_TRUE(mat_near(MatPtr(cv_filter2d_kernel(handle(image), kernel, 0, cv::BORDER_REFLECT_101)), expected, 1)) << "shape " << shape;
+        cv_kernel_release(kernel);
+    }
+    EXPECT_EQ(cv_kernel_create(3, 5, 5), nullptr);
+    EXPECT_EQ(cv_kernel_create(0, 0, 5), nullptr);
+    cv_kernel_release(nullptr);
+}
+
+TEST(Filters, CustomKernel) {
+    cv::Mat image = test::make_scene(120, 90, 1);
+    const float emboss[9] = {-2, -1, 0, -1, 1, 1, 0, 1, 2};
+    CvKernel* kernel = cv_kernel_create_custom(emboss, 3, 3, -1, -1);
+    ASSERT_NE(kernel, nullptr);
+    cv::Mat expected;
+    cv::filter2D(image, expected, -1, cv::Mat(3, 3, CV_32F, (void*)emboss), cv::Point(-1, -1), 16, cv::BORDER_REPLICATE);
+    EXPECT_TRUE(mat_near(MatPtr(cv_filter2d_kernel(handle(image), kernel, 16, cv::BORDER_REPLICATE)), expected, 0));
+    cv_kernel_release(kernel);
+    EXPECT_EQ(cv_kernel_create_custom(nullptr, 3, 3, -1, -1), nullptr);
+}
+
+TEST(Filters, Filter2dAutoSeparation) {
+    cv::Mat image = test::make_scene(170, 130, 3);
+    cv::Mat expected;
+
+    // rank 1 (가우시안 외적) -> 분리 경로
+    const float gauss[25] = {1, 4, 6, 4, 1, 4, 16, 24, 16, 4, 6, 24, 36, 24, 6, 4, 16, 24, 16, 4, 1, 4, 6, 4, 1};
+    std::vector<float> normalized(gauss, gauss + 25);
+    for (float& v : normalized) v /= 256.0f;
+    cv::filter2D(image, expected, -1, cv::Mat(5, 5, CV_32F, normalized.data()), cv::Point(-1, -1), 0, cv::BORDER_REFLECT_101);
+    EXPECT_TRUE(mat_near(MatPtr(cv_filter2d(handle(image), normalized.data(), 5, 5, -1, -1, 0, cv::BORDER_REFLECT_101)), expected, 1));
+
+    // rank 2 -> cv::filter2D 그대로
+    const float ridge[9] = {1, 0, -1, 0, 2, 0, -1, 0, 1};
+    cv::filter2D(image, expected, -1, cv::Mat(3, 3, CV_32F, (void*)ridge), cv::Point(-1, -1), 5, cv::BORDER_CONSTANT);
+    EXPECT_TRUE(mat_near(MatPtr(cv_filter2d(handle(image), ridge, 3, 3, -1, -1, 5, cv::BORDER_CONSTANT)), expected, 0));
+
+    EXPECT_EQ(cv_filter2d(handle(image), nullptr, 3, 3, -1, -1, 0, 0), nullptr);
+}
+
+TEST(Filters, SepFilter2d) {
+    cv::Mat image = test::make_scene(170, 130, 3);
+    const float kx[5] = {0.1f, 0.2f, 0.4f, 0.2f, 0.1f};
+    const float ky[3] = {0.25f, 0.5f, 0.25f};
+    cv::Mat expected;
+    cv::sepFilter2D(image, expected, -1, cv::Mat(1, 5, CV_32F, (void*)kx), cv::Mat(3, 1, CV_32F, (void*)ky), cv::Point(-1, -1), 0, cv::BORDER_REFLECT_101);
+    EXPECT_TRUE(mat_near(MatPtr(cv_sep_filter2d(handle(image), kx, 5, ky, 3, -1, -1, 0, cv::BORDER_REFLECT_101)), expected, 1));
+
+    cv::Mat gray32;
+    test::make_scene(170, 130, 1).convertTo(gray32, CV_32F, 1.0 / 255);
+    cv::sepFilter2D(gray32, expected, -1, cv::Mat(1, 5, CV_32F, (void*)kx), cv::Mat(3, 1, CV_32F, (void*)ky), cv::Point(-1, -1), 0, cv::BORDER_REFLECT_101);
+    EXPECT_TRUE(mat_near(MatPtr(cv_sep_filter2d(handle(gray32), kx, 5, ky, 3, -1, -1, 0, cv::BORDER_REFLECT_101)), expected, 1e-5));
+
+    // ROI 입력: BORDER_ISOLATED 면 ROI 바깥을 읽지 않고, 없으면 부모 영상의 이웃 픽셀을 읽음 (OpenCV 와 같게)
+    const cv::Mat roi = image(cv::Rect(20, 15, 100, 80));
+    for (int border : {(int)cv::BORDER_REFLECT_101, cv::BORDER_REFLECT_101 | cv::BORDER_ISOLATED}) {
+        cv::sepFilter2D(roi, expected, -1, cv::Mat(1, 5, CV_32F, (void*)kx), cv::Mat(3, 1, CV_32F, (void*)ky), cv::Point(-1, -1), 0, border);
+        EXPECT_TRUE(mat_near(MatPtr(cv_sep_filter2d(handle(roi), kx, 5, ky, 3, -1, -1, 0, border)), expected, 1)) << "border " << border;
+    }
+}
+
+// 고정소수점 한 패스 언샤프 마스크 vs GaussianBlur + addWeighted 참조 (threshold 0)
+TEST(Filters, UnsharpMaskMatchesReference) {
+    cv::Mat image = test::make_scene(200, 140, 3);
+    // 고정소수점 경로: 블러 반올림과 amount 양자화 (1/256) 차이만 허용
+    for (double sigma : {1.0, 1.5, 2.0, 3.0}) {
+        for (double amount : {0.8, 1.5}) {
+            const int ksize = cvRound(sigma * 6 + 1) | 1;
+            cv::Mat blurred, expected;
+            cv::GaussianBlur(image, blurred, cv::Size(ksize, ksize), sigma);
+            cv::addWeighted(image, 1.0 + amount, blurred, -amount, 0, expected);
+            MatPtr actual(cv_unsharp_mask(handle(image), sigma, amount, 0));
+            EXPECT_TRUE(mat_near(actual, expected, 2)) << "sigma " << sigma << " amount " << amount;
+            EXPECT_LT(test::mean_abs_diff(mat_of(actual), expected), 0.5) << "sigma " << sigma << " amount " << amount;
+
+            // threshold: 원본과 블러의 차이가 작은 픽셀은 원본 유지 (경계값 근처 몇 픽셀만 판정이 갈릴 수 있음)
+            cv::Mat diff, thresholded = expected.clone();
+            cv::absdiff(image, blurred, diff);
+            image.copyTo(thresholded, diff < 10);
+            MatPtr sharpened(cv_unsharp_mask(handle(image), sigma, amount, 10));
+            ASSERT_NE(sharpened, nullptr);
+            cv::absdiff(mat_of(sharpened), thresholded, diff);
+            EXPECT_LT(cv::countNonZero(diff.reshape(1) > 2), (int)(diff.total() * diff.channels() / 100)) << "sigma " << sigma;
+        }
+    }
+
+    // threshold 가 255 보다 크면 모든 픽셀 유지
+    EXPECT_TRUE(mat_near(MatPtr(cv_unsharp_mask(handle(image), 1.5, 0.8, 256)), image, 0));
+    EXPECT_EQ(cv_unsharp_mask(handle(image), 0, 0.8, 0), nullptr);
+}
+
+TEST(Filters, UnsharpMaskFloatFallback) {
+    cv::Mat image;
+    test::make_scene(160, 100, 1).convertTo(image, CV_32F);
+    const double sigma = 2.0, amount = 1.0;
+    const int ksize = cvRound(sigma * 6 + 1) | 1;
+    cv::Mat blurred, expected;
+    cv::GaussianBlur(image, blurred, cv::Size(ksize, ksize), sigma);
+    cv::addWeighted(image, 1.0 + amount, blurred, -amount, 0, expected);
+    EXPECT_TRUE(mat_near(MatPtr(cv_unsharp_mask(handle(image), sigma, amount, 0)), expected, 1e-3));
+
+    // 폴백 경로도 threshold 적용
+    cv::Mat diff, thresholded = expected.clone();
+    cv::absdiff(image, blurred, diff);
+    image.copyTo(thresholded, diff < 10);
+    EXPECT_TRUE(mat_near(MatPtr(cv_unsharp_mask(handle(image), sigma, amount, 10)), thresholded, 1e-3));
+    EXPECT_TRUE(mat_near(MatPtr(cv_unsharp_mask(handle(image), sigma, amount, 256)), image, 0));
+}
+
+TEST(Filters, Thresholds) {
+    cv::Mat gray = test::make_scene(160, 100, 1);
+    cv::Mat expected;
+    const int types[] = {cv::THRESH_BINARY, cv::THRESH_BINARY_INV, cv::THRESH_TRUNC, cv::THRESH_TOZERO, cv::THRESH_BINARY | cv::THRESH_OTSU};
+    for (int type : types) {
+        cv::threshold(gray, expected, 100, 255, type);
+        EXPECT_TRUE(mat_near(MatPtr(cv_threshold(handle(gray), 100, 255, type)), expected, 0)) << "type " << type;
+    }
+    cv::adaptiveThreshold(gray, expected, 255, cv::ADAPTIVE_THRESH_GAUSSIAN_C, cv::THRESH_BINARY, 11, 2);
+    EXPECT_TRUE(mat_near(MatPtr(cv_adaptive_threshold(handle(gray), 255, cv::ADAPTIVE_THRESH_GAUSSIAN_C, cv::THRESH_BINARY, 11, 2)), expected, 0));
+    // 짝수 블록은 다음 홀수로 보정
+    cv::adaptiveThreshold(gray, expected, 255, cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY, 15, 5);
+    EXPECT_TRUE(mat_near(MatPtr(cv_adaptive_threshold(handle(gray), 255, cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY, 14, 5)), expected, 0));
+}
+
+namespace {
+
+// 경계에서 잘라낸 창의 평균/표준편차를 직접 계산하는 단일 스케일 참조 구현
+cv::Mat reference_binarize(const cv::Mat& gray, int method, int window, double k, double r) {
+    const int half = window / 2;
+    cv::Mat sum, sqsum;
+    cv::integral(gray, sum, sqsum, CV_64F, CV_64F);
+    double minGray = 0;
+    cv::minMaxLoc(gray, &minGray);
+    cv::Mat mean(gray.size(), CV_64F), stdev(gray.size(), CV_64F);
+    double maxStd = 0;
+    for (int y = 0; y < gray.rows; y++) {
+        for (int x = 0; x < gray.cols; x++) {
+            const int x0 = std::max(0, x - half), x1 = std::min(gray.cols, x + half + 1);
+            const int y0 = std::max(0, y - half), y1 = std::min(gray.rows, y + half + 1);
+            const double n = (double)(x1 - x0) * (y1 - y0);
+            const double s = sum.at<double>(y1, x1) - sum.at<double>(y1, x0) - sum.at<double>(y0, x1) + sum.at<double>(y0, x0);
+            const double q = sqsum.at<double>(y1, x1) - sqsum.at<double>(y1, x0) - sqsum.at<double>(y0, x1) + sqsum.at<double>(y0, x0);
+            mean.at<double>(y, x) = s / n;
+            stdev.at<double>(y, x) = std::sqrt(std::max(0.0, q / n - (s / n) * (s / n)));
+            maxStd = std::max(maxStd, stdev.at<double>(y, x));
+        }
+    }
+    maxStd = std::max(1.0, maxStd);
+    cv::Mat out(gray.size(), CV_8U);
+    for (int y = 0; y < gray.rows; y++) {
+        for (int x = 0; x < gray.cols; x++) {
+            const double m = mean.at<double>(y, x), sd = stdev.at<double>(y, x);
+            double t;
+            if (method == 1) {
+                t = (1 - k) * m + k * minGray + k * sd / maxStd * (m - minGray);
+            } else if (method == 2) {
+                t = m + k * sd;
+            } else {
+                t = m * (1 + k * (sd / r - 1));
+            }
+            out.at<uchar>(y, x) = gray.at<uchar>(y, x) > t ? 255 : 0;
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+// float 누적 순서 차이로 임계값과 거의 같은 픽셀만 뒤집힐 수 있으므로 0.1% 미만 불일치 허용
+TEST(Filters, BinarizeDocumentMatchesReference) {
+    cv::Point2f corners[4];
+    cv::Mat gray;
+    cv::cvtColor(test::make_document(240, 180, corners), gray, cv::COLOR_BGR2GRAY);
+    const struct {
+        int method;
+        double k;
+    } cases[] = {{0, 0.2}, {1, 0.5}, {2, -0.2}};
+    for (const auto& c : cases) {
+        cv::Mat expected = reference_binarize(gray, c.method, 25, c.k, 128);
+        MatPtr actual(cv_binarize_document(handle(gray), c.method, 25, c.k, 128, 1));
+        ASSERT_NE(actual, nullptr);
+        ASSERT_EQ(mat_of(actual).size(), expected.size());
+        cv::Mat diff = mat_of(actual) != expected;
+        EXPECT_LT(cv::countNonZero(diff), (int)(gray.total() / 1000) + 1) << "method " << c.method;
+    }
+
+    // 컬러 입력은 그레이 변환 후 처리, 다중 스케일도 이진 영상
+    cv::Mat color = test::make_document(240, 180, corners);
+    MatPtr multi(cv_binarize_document(handle(color), 0, 15, 0.2, 0, 3));
+    ASSERT_NE(multi, nullptr);
+    EXPECT_EQ(mat_of(multi).type(), CV_8UC1);
+    EXPECT_EQ(cv::countNonZero((mat_of(multi) > 0) & (mat_of(multi) < 255)), 0);
+
+    cv::Mat floatImage(10, 10, CV_32F, cv::Scalar(0));
+    EXPECT_EQ(cv_binarize_document(handle(floatImage), 0, 15, 0.2, 128, 1), nullptr);
+}
+
+// 그림자 페이지에서 Sauvola/Wolf 가 이전 파이프라인(블러 -> 적응형 임계값 11 -> 열림)보다 정답 마스크에 가까워야 함
+TEST(Filters, BinarizeShadowedPageBeatsAdaptiveThreshold) {
+    cv::Mat mask;
+    const cv::Mat page = test::make_shadowed_page(640, 480, &mask);
+    ASSERT_GT(cv::countNonZero(mask), 0);
+
+    cv::Mat legacy;
+    cv::GaussianBlur(page, legacy, cv::Size(5, 5), 0);
+    cv::adaptiveThreshold(legacy, legacy, 255, cv::ADAPTIVE_THRESH_GAUSSIAN_C, cv::THRESH_BINARY, 11, 2);
+    cv::morphologyEx(legacy, legacy, cv::MORPH_OPEN, cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3)));
+    const double legacyError = test::binarization_error(legacy, mask);
+
+    MatPtr sauvola(cv_binarize_document(handle(page), 0, 25, 0.2, 128, 1));
+    MatPtr wolf(cv_binarize_document(handle(page), 1, 25, 0.5, 128, 1));
+    ASSERT_NE(sauvola, nullptr);
+    ASSERT_NE(wolf, nullptr);
+    const double sauvolaError = test::binarization_error(mat_of(sauvola), mask);
+    const double wolfError = test::binarization_error(mat_of(wolf), mask);
+    EXPECT_LT(sauvolaError, legacyError * 0.5) << "legacy " << legacyError;
+    EXPECT_LT(wolfError, legacyError) << "legacy " << legacyError;
+    EXPECT_LT(sauvolaError, 0.06);
+}
+
+TEST(Filters, IntegralRectSumsAndStats) {
+    cv::Mat image = test::make_scene(130, 90, 3);
+    CvIntegral* integral = cv_integral_create();
+    ASSERT_NE(integral, nullptr);
+    ASSERT_EQ(cv_integral_compute(integral, handle(image), 1), 1);
+
+    // 마지막 두 개는 경계로 잘리거나 완전히 밖
+    const int rects[] = {0, 0, 130, 90, 10, 20, 30, 15, 100, 70, 50, 50, -20, -20, 10, 10};
+    double sums[4], means[4], variances[4];
+    for (int channel = 0; channel < 3; channel++) {
+        ASSERT_EQ(cv_integral_rect_sums(integral, rects, 4, channel, sums), 4);
+        ASSERT_EQ(cv_integral_rect_stats(integral, rects, 4, channel, means, variances), 4);
+        const cv::Rect clipped[3] = {cv::Rect(0, 0, 130, 90), cv::Rect(10, 20, 30, 15), cv::Rect(100, 70, 30, 20)};
+        for (int i = 0; i < 3; i++) {
+            cv::Mat roi;
+            cv::extractChannel(image(clipped[i]), roi, channel);
+            cv::Scalar mean, stddev;
+            cv::meanStdDev(roi, mean, stddev);
+            EXPECT_DOUBLE_EQ(sums[i], cv::sum(roi)[0]) << "rect " << i << " channel " << channel;
+            EXPECT_NEAR(means[i], mean[0], 1e-9);
+            EXPECT_NEAR(variances[i], stddev[0] * stddev[0], 1e-6);
+        }
+        EXPECT_EQ(sums[3], 0.0);
+        EXPECT_EQ(means[3], 0.0);
+    }
+    EXPECT_EQ(cv_integral_rect_sums(integral, rects, 1, 3, sums), 0);
+    // 제곱합 없이 계산하면 분산은 요청할 수 없음
+    ASSERT_EQ(cv_integral_compute(integral, handle(image), 0), 1);
+    EXPECT_EQ(cv_integral_rect_stats(integral, rects, 1, 0, means, variances), 0);
+    EXPECT_EQ(cv_integral_rect_stats(integral, rects, 1, 0, means, nullptr), 1);
+    EXPECT_EQ(cv_integral_tilted_sums(integral, rects, 1, 0, sums), 0);
+    cv_integral_release(integral);
+}
+
+TEST(Filters, IntegralTiltedSums) {
+    cv::Mat gray = test::make_scene(80, 60, 1);
+    CvIntegral* integral = cv_integral_create();
+    ASSERT_EQ(cv_integral_compute(integral, handle(gray), 2), 1);
+    cv::Mat sum, sqsum, tilted;
+    cv::integral(gray, sum, sqsum, tilted, CV_32S, CV_64F);
+
+    const int rects[] = {20, 5, 10, 8, 40, 10, 15, 15, 2, 0, 5, 5};
+    double sums[3];
+    ASSERT_EQ(cv_integral_tilted_sums(integral, rects, 3, 0, sums), 3);
+    for (int i = 0; i < 2; i++) {
+        const int x = rects[i * 4], y = rects[i * 4 + 1], w = rects[i * 4 + 2], h = rects[i * 4 + 3];
+        const double expected = (double)tilted.at<int>(y, x) - tilted.at<int>(y + h, x - h) - tilted.at<int>(y + w, x + w) + tilted.at<int>(y + w + h, x + w - h);
+        EXPECT_EQ(sums[i], expected) << "rect " << i;
+        EXPECT_GT(sums[i], 0.0);
+    }
+    // x - h < 0 인 사각형은 0
+    EXPECT_EQ(sums[2], 0.0);
+    // 기울어진 합은 제곱합도 함께 계산
+    double means[1], variances[1];
+    EXPECT_EQ(cv_integral_rect_stats(integral, rects, 1, 0, means, variances), 1);
+    cv_integral_release(integral);
+}
+
+TEST(Filters, CalcHistMatchesOpenCV) {
+    cv::Mat image = test::make_scene(150, 100, 3);
+    cv::Mat mask(image.size(), CV_8UC1, cv::Scalar(0));
+    cv::circle(mask, cv::Point(75, 50), 40, cv::Scalar(255), -1);
+
+    for (int bins : {256, 32, 10}) {
+        for (const cv::Mat& m : {cv::Mat(), mask}) {
+            std::vector<float> actual(3 * bins);
+            CvMat* maskHandle = m.empty() ? nullptr : handle(m);
+            ASSERT_EQ(cv_calc_hist(handle(image), -1, bins, 0, 256, maskHandle, actual.data()), 1);
+            float range[] = {0, 256};
+            const float* ranges[] = {range};
+            for (int c = 0; c < 3; c++) {
+                cv::Mat expected;
+                cv::calcHist(&image, 1, &c, m, expected, 1, &bins, ranges);
+                for (int b = 0; b < bins; b++) {
+                    EXPECT_EQ(actual[c * bins + b], expected.at<float>(b)) << "bins " << bins << " channel " << c << " bin " << b;
+                }
+            }
+        }
+    }
+
+    // 부분 구간, 단일 채널
+    std::vector<float> partial(16);
+    ASSERT_EQ(cv_calc_hist(handle(image), 1, 16, 64, 192, nullptr, partial.data()), 1);
+    float range[] = {64, 192};
+    const float* ranges[] = {range};
+    int channel = 1, bins = 16;
+    cv::Mat expected;
+    cv::calcHist(&image, 1, &channel, cv::Mat(), expected, 1, &bins, ranges);
+    for (int b = 0; b < 16; b++) EXPECT_EQ(partial[b], expected.at<float>(b));
+
+    // float 영상은 cv::calcHist 경로
+    cv::Mat image32;
+    image.convertTo(image32, CV_32F, 1.0 / 255);
+    ASSERT_EQ(cv_calc_hist(handle(image32), 2, 16, 0, 1, nullptr, partial.data()), 1);
+    float unit[] = {0, 1};
+    const float* unitRanges[] = {unit};
+    channel = 2;
+    cv::calcHist(&image32, 1, &channel, cv::Mat(), expected, 1, &bins, unitRanges);
+    for (int b = 0; b < 16; b++) EXPECT_EQ(partial[b], expected.at<float>(b));
+
+    EXPECT_EQ(cv_calc_hist(handle(image), 3, 16, 0, 256, nullptr, partial.data()), 0);
+    cv::Mat badMask(10, 10, CV_8UC1);
+    EXPECT_EQ(cv_calc_hist(handle(image), 0, 16, 0, 256, handle(badMask), partial.data()), 0);
+}
+
+TEST(Filters, EqualizeHist) {
+    cv::Mat gray = test::make_scene(160, 120, 1);
+    cv::Mat expected;
+    cv::equalizeHist(gray, expected);
+    EXPECT_TRUE(mat_near(MatPtr(cv_equalize_hist(handle(gray))), expected, 0));
+
+    // 무채색 컬러 영상은 밝기 = 각 채널이므로 그레이 평활화와 같아야 함
+    cv::Mat grayBgr, expectedBgr;
+    cv::cvtColor(gray, grayBgr, cv::COLOR_GRAY2BGR);
+    cv::cvtColor(expected, expectedBgr, cv::COLOR_GRAY2BGR);
+    EXPECT_TRUE(mat_near(MatPtr(cv_equalize_hist(handle(grayBgr))), expectedBgr, 0));
+
+    // 알파 채널은 유지
+    cv::Mat bgra = test::make_scene(160, 120, 4);
+    MatPtr equalized(cv_equalize_hist(handle(bgra)));
+    ASSERT_NE(equalized, nullptr);
+    cv::Mat alphaIn, alphaOut;
+    cv::extractChannel(bgra, alphaIn, 3);
+    cv::extractChannel(mat_of(equalized), alphaOut, 3);
+    EXPECT_TRUE(mat_near(alphaOut, alphaIn, 0));
+
+    // 8비트가 아니거나 2 채널이면 실패
+    cv::Mat floats, twoChannels(8, 8, CV_8UC2, cv::Scalar(1, 2));
+    gray.convertTo(floats, CV_32F);
+    EXPECT_EQ(cv_equalize_hist(handle(floats)), nullptr);
+    EXPECT_EQ(cv_equalize_hist(handle(twoChannels)), nullptr);
+}
+
+TEST(Filters, Clahe) {
+    CvClahe* clahe = cv_clahe_create(2.0, 8, 8);
+    ASSERT_NE(clahe, nullptr);
+    cv::Mat gray = test::make_scene(200, 150, 1);
+    cv::Ptr<cv::CLAHE> reference = cv::createCLAHE(2.0, cv::Size(8, 8));
+    cv::Mat expected;
+    reference->apply(gray, expected);
+    EXPECT_TRUE(mat_near(MatPtr(cv_clahe_apply(clahe, handle(gray))), expected, 0));
+
+    // 설정 변경 후 재사용
+    cv_clahe_set(clahe, 4.0, 4, 4);
+    reference->setClipLimit(4.0);
+    reference->setTilesGridSize(cv::Size(4, 4));
+    reference->apply(gray, expected);
+    EXPECT_TRUE(mat_near(MatPtr(cv_clahe_apply(clahe, handle(gray))), expected, 0));
+
+    cv::Mat grayBgr, expectedBgr;
+    cv::cvtColor(gray, grayBgr, cv::COLOR_GRAY2BGR);
+    cv::cvtColor(expected, expectedBgr, cv::COLOR_GRAY2BGR);
+    EXPECT_TRUE(mat_near(MatPtr(cv_clahe_apply(clahe, handle(grayBgr))), expectedBgr, 0));
+
+    cv::Mat gray32(10, 10, CV_32FC3);
+    EXPECT_EQ(cv_clahe_apply(clahe, handle(gray32)), nullptr);
+    cv_clahe_release(clahe);
+    EXPECT_EQ(cv_clahe_create(2.0, 0, 8), nullptr);
+}
+
+namespace {
+
+// LUT 결과를 픽셀별 테이블로 확인
+cv::Mat apply_table(const cv::Mat& src, const uchar table[256]) {
+    cv::Mat lut(1, 256, CV_8U, (void*)table), dst;
+    cv::LUT(src, lut, dst);
+    return dst;
+}
+
+} // namespace
+
+TEST(Filters, LutToneOperations) {
+    cv::Mat bgr = test::make_scene(120, 80, 3);
+    CvLut* lut = cv_lut_create();
+    ASSERT_NE(lut, nullptr);
+
+    // 항등
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), bgr, 0));
+
+    // 밝기 -> 대비 합성은 float 체인 후 한 번 반올림
+    cv_lut_brightness(lut, -1, 20);
+    cv_lut_contrast(lut, -1, 1.5, 128);
+    uchar table[256];
+    for (int i = 0; i < 256; i++) {
+        const float v = std::min(255.0f, std::max(0.0f, (float)i + 20.0f));
+        table[i] = (uchar)cvRound(std::min(255.0f, std::max(0.0f, (v - 128.0f) * 1.5f + 128.0f)));
+    }
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), apply_table(bgr, table), 0));
+
+    // 감마는 채널 하나에만
+    cv_lut_reset(lut);
+    cv_lut_gamma(lut, 2, 2.2);
+    MatPtr gamma(cv_lut_apply(lut, handle(bgr)));
+    ASSERT_NE(gamma, nullptr);
+    for (int i = 0; i < 256; i++) table[i] = (uchar)cvRound(255.0 * std::pow(i / 255.0, 1.0 / 2.2));
+    std::vector<cv::Mat> in, out;
+    cv::split(bgr, in);
+    cv::split(mat_of(gamma), out);
+    EXPECT_TRUE(mat_near(out[0], in[0], 0));
+    EXPECT_TRUE(mat_near(out[1], in[1], 0));
+    EXPECT_TRUE(mat_near(out[2], apply_table(in[2], table), 1));
+
+    // 레벨
+    cv_lut_reset(lut);
+    cv_lut_levels(lut, -1, 16, 235, 0, 255);
+    for (int i = 0; i < 256; i++) table[i] = (uchar)cvRound(std::min(1.0, std::max(0.0, (i - 16.0) / 219.0)) * 255.0);
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), apply_table(bgr, table), 1));
+
+    // 곡선: (0,0) (128,64) (255,255) 구간 선형
+    cv_lut_reset(lut);
+    const float points[6] = {255, 255, 0, 0, 128, 64};
+    cv_lut_curve(lut, -1, points, 3);
+    for (int i = 0; i < 256; i++) table[i] = (uchar)cvRound(i <= 128 ? i * 0.5f : 64.0f + (i - 128) * (191.0f / 127.0f));
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), apply_table(bgr, table), 1));
+
+    // 테이블 (반전)
+    cv_lut_reset(lut);
+    uchar invert[256];
+    for (int i = 0; i < 256; i++) invert[i] = (uchar)(255 - i);
+    cv_lut_table(lut, -1, invert);
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), apply_table(bgr, invert), 0));
+
+    // 1채널은 0번 테이블
+    cv::Mat gray = test::make_scene(120, 80, 1);
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(gray))), apply_table(gray, invert), 0));
+
+    cv::Mat image32(4, 4, CV_32FC3);
+    EXPECT_EQ(cv_lut_apply(lut, handle(image32)), nullptr);
+    cv_lut_release(lut);
+}
+
+TEST(Filters, Lut3dIdentityAndSwap) {
+    const int size = 17;
+    std::vector<float> identity((size_t)size * size * size * 3), swap(identity.size());
+    size_t i = 0;
+    for (int b = 0; b < size; b++) {
+        for (int g = 0; g < size; g++) {
+            for (int r = 0; r < size; r++, i++) {
+                // .cube 순서: R 이 가장 빠르게 변함, RGB
+                identity[i * 3] = r / (float)(size - 1);
+                identity[i * 3 + 1] = g / (float)(size - 1);
+                identity[i * 3 + 2] = b / (float)(size - 1);
+                swap[i * 3] = b / (float)(size - 1);
+                swap[i * 3 + 1] = g / (float)(size - 1);
+                swap[i * 3 + 2] = r / (float)(size - 1);
+            }
+        }
+    }
+    cv::Mat bgr = test::make_scene(100, 70, 3);
+    CvLut* lut = cv_lut_create();
+    ASSERT_EQ(cv_lut_set_3d(lut, identity.data(), size), 1);
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), bgr, 1));
+
+    // R/B 교환 격자 == BGR -> RGB
+    ASSERT_EQ(cv_lut_set_3d(lut, swap.data(), size), 1);
+    cv::Mat expected;
+    cv::cvtColor(bgr, expected, cv::COLOR_BGR2RGB);
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), expected, 1));
+
+    // nullptr 이면 3D 격자 제거
+    ASSERT_EQ(cv_lut_set_3d(lut, nullptr, 0), 1);
+    EXPECT_TRUE(mat_near(MatPtr(cv_lut_apply(lut, handle(bgr))), bgr, 0));
+    cv_lut_release(lut);
+}
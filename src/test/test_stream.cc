@@ -0,0 +1,596 @@
+// 시간적 노이즈 제거 / 프레임 통계 / 움직임 감지 / 안정화 / 동영상 기록·캡처 / 프로파일링·트레이스
+#include "test_util.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using test::handle;
+using test::mat_near;
+using test::mat_of;
+using test::MatPtr;
+
+namespace {
+
+// 정적 장면 + 프레임마다 다른 가우시안 노이즈
+cv::Mat noisy(const cv::Mat& clean, int seed, double sigma) {
+    cv::Mat noise(clean.size(), CV_16SC(clean.channels())), out;
+    cv::RNG rng(seed);
+    rng.fill(noise, cv::RNG::NORMAL, 0, sigma);
+    cv::add(clean, noise, out, cv::noArray(), clean.type());
+    return out;
+}
+
+double rms_error(const cv::Mat& a, const cv::Mat& b) { return cv::norm(a, b, cv::NORM_L2) / std::sqrt((double)a.total() * a.channels()); }
+
+} // namespace
+
+TEST(TemporalDenoiser, RecursiveKeepsStaticFramesAndReducesNoise) {
+    CvTemporalDenoiser* denoiser = cv_temporal_denoiser_create(0, 5, 10, 0.25f, 40);
+    ASSERT_NE(denoiser, nullptr);
+    cv::Mat clean = test::make_scene(160, 120, 3);
+    MatPtr out(cv_mat_create());
+
+    // 같은 프레임만 들어오면 누적값 = 입력
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(cv_temporal_denoiser_process(denoiser, handle(clean), out.get()), 1);
+        EXPECT_TRUE(mat_near(out, clean, 0)) << "frame " << i;
+    }
+
+    cv_temporal_denoiser_reset(denoiser);
+    cv::Mat first = noisy(clean, 1, 6);
+    ASSERT_EQ(cv_temporal_denoiser_process(denoiser, handle(first), out.get()), 1);
+    // 첫 프레임은 그대로 복사
+    EXPECT_TRUE(mat_near(out, first, 0));
+    cv::Mat last;
+    for (int i = 2; i <= 12; i++) {
+        last = noisy(clean, i, 6);
+        ASSERT_EQ(cv_temporal_denoiser_process(denoiser, handle(last), out.get()), 1);
+    }
+    EXPECT_LT(rms_error(mat_of(out), clean), rms_error(last, clean) * 0.75);
+
+    cv::Mat floatFrame(10, 10, CV_32FC3);
+    EXPECT_EQ(cv_temporal_denoiser_process(denoiser, handle(floatFrame), out.get()), 0);
+    cv_temporal_denoiser_release(denoiser);
+}
+
+TEST(TemporalDenoiser, MultiFrameMatchesOpenCV) {
+    CvTemporalDenoiser* denoiser = cv_temporal_denoiser_create(1, 4, 10, 0, 0); // 짝수 창은 5 로 보정
+    ASSERT_NE(denoiser, nullptr);
+    cv::Mat clean = test::make_scene(64, 48, 3);
+    std::vector<cv::Mat> frames;
+    MatPtr out(cv_mat_create());
+    for (int i = 0; i < 6; i++) {
+        frames.push_back(noisy(clean, 100 + i, 8));
+        // 창 (5 장) 이 찰 때까지는 출력할 프레임이 없음
+        ASSERT_EQ(cv_temporal_denoiser_process(denoiser, handle(frames.back()), out.get()), i >= 4 ? 1 : 0) << "frame " << i;
+        if (i < 4) continue;
+        // 출력은 창의 가운데 프레임 (i - 2) 을 디노이즈한 것
+        cv::Mat expected;
+        cv::fastNlMeansDenoisingColoredMulti(frames, expected, i - 2, 5, 10, 10);
+        EXPECT_TRUE(mat_near(out, expected, 0)) << "frame " << i;
+    }
+
+    // 초기화하면 다시 창을 채움
+    cv_temporal_denoiser_reset(denoiser);
+    EXPECT_EQ(cv_temporal_denoiser_process(denoiser, handle(frames[0]), out.get()), 0);
+    cv_temporal_denoiser_release(denoiser);
+}
+
+TEST(FrameStats, ConstantFrame) {
+    CvFrameStatsCollector* collector = cv_frame_stats_create(4, 2, 253);
+    ASSERT_NE(collector, nullptr);
+    cv::Mat frame(48, 64, CV_8UC3, cv::Scalar(50, 100, 200));
+    ASSERT_EQ(cv_frame_stats_compute(collector, handle(frame)), 1);
+    const struct CvFrameStats* stats = cv_frame_stats_get(collector);
+    ASSERT_NE(stats, nullptr);
+
+    // 격자 (64/4) x (48/4), 밝기 (29*50 + 150*100 + 77*200) >> 8 = 124
+    EXPECT_EQ(stats->samples, 16u * 12u);
+    EXPECT_EQ(stats->frameCount, 1u);
+    EXPECT_FLOAT_EQ(stats->meanLuma, 124.0f);
+    EXPECT_EQ(stats->histogram[124], stats->samples);
+    EXPECT_FLOAT_EQ(stats->clipLow, 0.0f);
+    EXPECT_FLOAT_EQ(stats->clipHigh, 0.0f);
+    EXPECT_FLOAT_EQ(stats->channelMeans[0], 50.0f);
+    EXPECT_FLOAT_EQ(stats->channelMeans[2], 200.0f);
+    EXPECT_FLOAT_EQ(stats->channelMeans[3], 0.0f);
+    const float gray = (50.0f + 100.0f + 200.0f) / 3.0f;
+    EXPECT_FLOAT_EQ(stats->grayWorldGains[0], gray / 50.0f);
+    EXPECT_FLOAT_EQ(stats->grayWorldGains[1], gray / 100.0f);
+    EXPECT_FLOAT_EQ(stats->grayWorldGains[2], gray / 200.0f);
+
+    // 클립 경계 포함 (<= low, >= high)
+    cv::Mat clipped(48, 64, CV_8UC1, cv::Scalar(253));
+    clipped(cv::Rect(0, 0, 32, 48)).setTo(2);
+    ASSERT_EQ(cv_frame_stats_compute(collector, handle(clipped)), 1);
+    EXPECT_EQ(stats->frameCount, 2u);
+    EXPECT_FLOAT_EQ(stats->clipLow, 0.5f);
+    EXPECT_FLOAT_EQ(stats->clipHigh, 0.5f);
+    EXPECT_FLOAT_EQ(stats->grayWorldGains[0], 1.0f);
+
+    cv_frame_stats_release(collector);
+}
+
+TEST(FrameStats, HistogramMatchesSampledPixels) {
+    CvFrameStatsCollector* collector = cv_frame_stats_create(3, 10, 245);
+    cv::Mat gray = test::make_scene(101, 77, 1);
+    ASSERT_EQ(cv_frame_stats_compute(collector, handle(gray)), 1);
+    const struct CvFrameStats* stats = cv_frame_stats_get(collector);
+    uint32_t expected[256] = {0};
+    uint32_t samples = 0;
+    for (int y = 1; y < gray.rows; y += 3) {
+        for (int x = 1; x < gray.cols; x += 3) {
+            expected[gray.at<uchar>(y, x)]++;
+            samples++;
+        }
+    }
+    EXPECT_EQ(stats->samples, samples);
+    EXPECT_EQ(std::memcmp(stats->histogram, expected, sizeof(expected)), 0);
+    cv_frame_stats_release(collector);
+}
+
+TEST(MotionDetector, DetectsMovingSquare) {
+    for (int method : {0, 1, 2}) {
+        CvMotionDetector* detector = cv_motion_detector_create(method, 160, 0.05, 25, 20);
+        ASSERT_NE(detector, nullptr);
+        EXPECT_EQ(cv_motion_detector_mask(detector), nullptr);
+
+        cv::Mat background(240, 320, CV_8UC3, cv::Scalar(60, 60, 60));
+        for (int i = 0; i < 30; i++) {
+            ASSERT_EQ(cv_motion_detector_process(detector, handle(background)), 1);
+        }
+        EXPECT_LT(cv_motion_detector_activity(detector), 0.01) << "method " << method;
+
+        cv::Mat frame = background.clone();
+        cv::rectangle(frame, cv::Rect(100, 80, 60, 50), cv::Scalar(240, 240, 240), -1);
+        ASSERT_EQ(cv_motion_detector_process(detector, handle(frame)), 1);
+        EXPECT_GT(cv_motion_detector_activity(detector), 0.02) << "method " << method;
+
+        const int count = cv_motion_detector_boxes(detector, nullptr, 0);
+        ASSERT_GE(count, 1) << "method " << method;
+        std::vector<int> boxes(count * 4);
+        ASSERT_EQ(cv_motion_detector_boxes(detector, boxes.data(), count), count);
+        // 원본 좌표로 되돌린 상자가 사각형과 겹쳐야 함
+        const cv::Rect box(boxes[0], boxes[1], boxes[2], boxes[3]);
+        EXPECT_GT((box & cv::Rect(100, 80, 60, 50)).area(), 60 * 50 / 2) << "method " << method;
+
+        MatPtr mask(cv_motion_detector_mask(detector));
+        ASSERT_NE(mask, nullptr);
+        EXPECT_EQ(mat_of(mask).cols, 160);
+        EXPECT_EQ(mat_of(mask).rows, 120);
+
+        cv_motion_detector_reset(detector);
+        EXPECT_EQ(cv_motion_detector_activity(detector), 0.0);
+        cv_motion_detector_release(detector);
+    }
+    EXPECT_EQ(cv_motion_detector_create(3, 160, 0.05, 25, 20), nullptr);
+}
+
+TEST(Stabilizer, DelaysAndKeepsStaticFrames) {
+    CvStabilizer* stabilizer = cv_stabilizer_create(3, 1.0, 320);
+    ASSERT_NE(stabilizer, nullptr);
+    EXPECT_EQ(cv_stabilizer_delay_frames(stabilizer), 3);
+    cv::Mat frame = test::make_scene(320, 240, 3);
+    MatPtr out(cv_mat_create());
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(cv_stabilizer_process(stabilizer, handle(frame), out.get()), 0) << "frame " << i;
+    }
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(cv_stabilizer_process(stabilizer, handle(frame), out.get()), 1);
+        ASSERT_EQ(mat_of(out).size(), frame.size());
+        // 움직임이 없으면 보정 변환은 항등에 가까움
+        EXPECT_LT(test::mean_abs_diff(mat_of(out), frame), 1.0);
+    }
+    EXPECT_GE(cv_stabilizer_latency_ms(stabilizer), 0.0);
+
+    cv_stabilizer_reset(stabilizer);
+    EXPECT_EQ(cv_stabilizer_process(stabilizer, handle(frame), out.get()), 0);
+    cv_stabilizer_release(stabilizer);
+}
+
+TEST(Stabilizer, CompensatesShake) {
+    CvStabilizer* stabilizer = cv_stabilizer_create(4, 1.0, 320);
+    cv::Mat base = test::make_scene(320, 240, 3);
+    MatPtr out(cv_mat_create());
+    // 좌우로 흔들리는 프레임: 출력 사이의 이동량이 입력보다 작아야 함
+    std::vector<cv::Mat> outputs;
+    for (int i = 0; i < 16; i++) {
+        const double dx = (i % 2 == 0) ? 4.0 : -4.0;
+        cv::Mat m = (cv::Mat_<double>(2, 3) << 1, 0, dx, 0, 1, 0), frame;
+        cv::warpAffine(base, frame, m, base.size(), cv::INTER_LINEAR, cv::BORDER_REFLECT);
+        if (cv_stabilizer_process(stabilizer, handle(frame), out.get())) outputs.push_back(mat_of(out).clone());
+    }
+    ASSERT_EQ(outputs.size(), 12u);
+    cv::Rect center(40, 40, 240, 160);
+    cv::Mat inputA, inputB;
+    cv::warpAffine(base, inputA, (cv::Mat_<double>(2, 3) << 1, 0, 4, 0, 1, 0), base.size(), cv::INTER_LINEAR, cv::BORDER_REFLECT);
+    cv::warpAffine(base, inputB, (cv::Mat_<double>(2, 3) << 1, 0, -4, 0, 1, 0), base.size(), cv::INTER_LINEAR, cv::BORDER_REFLECT);
+    const double inputJitter = test::mean_abs_diff(inputA(center), inputB(center));
+    const double outputJitter = test::mean_abs_diff(outputs[10](center), outputs[11](center));
+    EXPECT_LT(outputJitter, inputJitter * 0.5);
+    cv_stabilizer_release(stabilizer);
+}
+
+namespace {
+
+// MJPG/AVI 는 대부분의 OpenCV 빌드(FFmpeg 또는 내장 MJPEG 인코더)에서 기록 가능.
+// staticScene 이면 배경 장면은 고정하고 프레임 번호만 바뀜 (안정화기가 움직임을 0 으로 추정)
+bool write_test_video(const std::string& path, int frames, int width, int height, bool staticScene = false) {
+    CvVideoWriter* writer = cv_videowriter_open(path.c_str(), "MJPG", 30, width, height, 1, 4, 0);
+    if (writer == nullptr) return false;
+    for (int i = 0; i < frames; i++) {
+        cv::Mat frame = test::make_scene(width, height, 3, staticScene ? 1 : i + 1);
+        cv::putText(frame, std::to_string(i), cv::Point(10, height - 10), cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(255, 255, 255), 2);
+        if (cv_videowriter_write(writer, handle(frame)) != 1) {
+            cv_videowriter_release(writer);
+            return false;
+        }
+        // 성공하면 프레임은 큐로 이동
+        if (!frame.empty()) {
+            cv_videowriter_release(writer);
+            return false;
+        }
+    }
+    cv_videowriter_close(writer);
+    const bool ok = cv_videowriter_written(writer) == frames && cv_videowriter_pending(writer) == 0 && cv_videowriter_dropped(writer) == 0;
+    cv_videowriter_release(writer);
+    return ok;
+}
+
+} // namespace
+
+TEST(VideoWriter, RejectsInvalidArguments) {
+    const std::string path = test::temp_path("invalid.avi");
+    EXPECT_EQ(cv_videowriter_open(path.c_str(), "MJ", 30, 64, 48, 1, 4, 0), nullptr);
+    EXPECT_EQ(cv_videowriter_open(path.c_str(), "MJPG", 30, 0, 48, 1, 4, 0), nullptr);
+    EXPECT_EQ(cv_videowriter_open(nullptr, "MJPG", 30, 64, 48, 1, 4, 0), nullptr);
+    EXPECT_EQ(cv_videowriter_write(nullptr, nullptr), 0);
+}
+
+TEST(VideoWriter, ClosedWriterRejectsFrames) {
+    const std::string path = test::temp_path("closed.avi");
+    CvVideoWriter* writer = cv_videowriter_open(path.c_str(), "MJPG", 30, 64, 48, 1, 2, 1);
+    if (writer == nullptr) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+    cv_videowriter_close(writer);
+    cv::Mat frame(48, 64, CV_8UC3, cv::Scalar(1, 2, 3));
+    EXPECT_EQ(cv_videowriter_write(writer, handle(frame)), 0);
+    // 실패하면 프레임은 그대로
+    EXPECT_FALSE(frame.empty());
+    cv_videowriter_release(writer);
+    std::remove(path.c_str());
+}
+
+TEST(VideoCapture, WriterCaptureRoundTrip) {
+    const std::string path = test::temp_path("round_trip.avi");
+    if (!write_test_video(path, 12, 160, 120)) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+
+    for (int queueSize : {0, 4}) {
+        CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, queueSize, 1);
+        ASSERT_NE(cap, nullptr) << "queue " << queueSize;
+        EXPECT_EQ(cv_videocapture_position(cap), -1);
+        struct CvFrameTiming timing;
+        EXPECT_EQ(cv_videocapture_timing(cap, &timing), 0);
+
+        MatPtr frame(cv_mat_create());
+        int frames = 0;
+        while (cv_videocapture_read(cap, frame.get())) {
+            EXPECT_EQ(cv_videocapture_position(cap), frames);
+            // MJPEG 손실 압축이므로 원본과 평균 차이만 확인
+            cv::Mat expected = test::make_scene(160, 120, 3, frames + 1);
+            cv::putText(expected, std::to_string(frames), cv::Point(10, 110), cv::FONT_HERSHEY_SIMPLEX, 1.0, cv::Scalar(255, 255, 255), 2);
+            EXPECT_LT(test::mean_abs_diff(mat_of(frame), expected), 8.0) << "frame " << frames;
+            frames++;
+        }
+        EXPECT_EQ(frames, 12) << "queue " << queueSize;
+        EXPECT_DOUBLE_EQ(cv_videocapture_get(cap, cv::CAP_PROP_FRAME_WIDTH), 160.0);
+        cv_videocapture_release(cap);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(VideoCapture, StrideSeekAndTiming) {
+    const std::string path = test::temp_path("stride.avi");
+    if (!write_test_video(path, 12, 96, 72)) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+
+    CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, 2, 3);
+    ASSERT_NE(cap, nullptr);
+    MatPtr frame(cv_mat_create());
+    std::vector<int> positions;
+    while (cv_videocapture_read(cap, frame.get())) positions.push_back(cv_videocapture_position(cap));
+    EXPECT_EQ(positions, (std::vector<int>{0, 3, 6, 9}));
+
+    // seek 후 다음 read 는 해당 프레임
+    ASSERT_EQ(cv_videocapture_seek(cap, 4), 1);
+    ASSERT_EQ(cv_videocapture_read(cap, frame.get()), 1);
+    EXPECT_EQ(cv_videocapture_position(cap), 4);
+    EXPECT_EQ(cv_videocapture_seek(cap, 12), 0);
+    EXPECT_EQ(cv_videocapture_seek(cap, -1), 0);
+
+    struct CvFrameTiming timing;
+    ASSERT_EQ(cv_videocapture_timing(cap, &timing), 1);
+    EXPECT_EQ(timing.frameIndex, 4);
+    EXPECT_LE(timing.captureNs, timing.dequeueNs);
+    EXPECT_LE(timing.dequeueNs, timing.processedNs);
+    EXPECT_LE(timing.processedNs, cv_monotonic_ns());
+
+    cv_videocapture_mark_done(cap);
+    struct CvLatencyStats latency;
+    ASSERT_EQ(cv_videocapture_latency(cap, CV_LATENCY_END_TO_END, &latency), 1);
+    EXPECT_EQ(latency.count, 1);
+    EXPECT_GE(latency.maxMs, 0.0);
+    ASSERT_EQ(cv_videocapture_latency(cap, CV_LATENCY_QUEUE, &latency), 1);
+    EXPECT_EQ(latency.count, 5);
+    EXPECT_LE(latency.p50Ms, latency.p99Ms);
+    cv_videocapture_latency_reset(cap);
+    ASSERT_EQ(cv_videocapture_latency(cap, CV_LATENCY_QUEUE, &latency), 1);
+    EXPECT_EQ(latency.count, 0);
+    cv_videocapture_release(cap);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(cv_videocapture_open(test::temp_path("missing.avi").c_str(), 0, 0, 1), nullptr);
+    // 해제된/없는 캡처에 대한 호출은 무시
+    cv_videocapture_set(nullptr, cv::CAP_PROP_POS_FRAMES, 0);
+    EXPECT_EQ(cv_videocapture_read(nullptr, frame.get()), 0);
+}
+
+// 디코드 스레드가 앞서 디코드하는 도중에 seek 해도 다음 read 는 항상 목표 프레임
+TEST(VideoCapture, SeekWhileStreaming) {
+    const std::string path = test::temp_path("seek_stream.avi");
+    if (!write_test_video(path, 24, 96, 72)) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+
+    // 동기 모드 순차 read 로 기준 프레임 수집
+    std::vector<cv::Mat> reference;
+    CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, 0, 1);
+    ASSERT_NE(cap, nullptr);
+    MatPtr frame(cv_mat_create());
+    while (cv_videocapture_read(cap, frame.get())) reference.push_back(mat_of(frame).clone());
+    cv_videocapture_release(cap);
+    ASSERT_EQ(reference.size(), 24u);
+
+    cap = cv_videocapture_open(path.c_str(), 0, 3, 1);
+    ASSERT_NE(cap, nullptr);
+    const int targets[] = {17, 3, 9, 9, 0, 22, 5, 12, 1, 20};
+    for (int round = 0; round < 20; round++) {
+        for (int target : targets) {
+            // 한 장 읽은 직후에는 디코드 스레드가 빈 큐 자리를 채우는 중
+            ASSERT_EQ(cv_videocapture_read(cap, frame.get()), 1);
+            ASSERT_EQ(cv_videocapture_seek(cap, target), 1);
+            ASSERT_EQ(cv_videocapture_read(cap, frame.get()), 1);
+            ASSERT_EQ(cv_videocapture_position(cap), target) << "round " << round;
+            EXPECT_LT(test::mean_abs_diff(mat_of(frame), reference[target]), 1.0) << "target " << target;
+        }
+    }
+    cv_videocapture_release(cap);
+    std::remove(path.c_str());
+}
+
+// 안정화기가 부착된 채로 seek 해도 seek 이전 위치의 프레임이 섞여 나오지 않음
+TEST(VideoCapture, SeekWhileStreamingStabilized) {
+    const std::string path = test::temp_path("seek_stabilized.avi");
+    if (!write_test_video(path, 24, 96, 72, true)) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+
+    std::vector<cv::Mat> reference;
+    CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, 0, 1);
+    ASSERT_NE(cap, nullptr);
+    MatPtr frame(cv_mat_create());
+    while (cv_videocapture_read(cap, frame.get())) reference.push_back(mat_of(frame).clone());
+    cv_videocapture_release(cap);
+    ASSERT_EQ(reference.size(), 24u);
+
+    cap = cv_videocapture_open(path.c_str(), 0, 3, 1);
+    ASSERT_NE(cap, nullptr);
+    CvStabilizer* stabilizer = cv_stabilizer_create(2, 1.0, 96);
+    cv_videocapture_set_stabilizer(cap, stabilizer);
+    // 프레임 번호가 그려진 좌하단만 비교 (나머지는 모든 프레임이 같음)
+    const cv::Rect label(0, 36, 64, 36);
+    const int targets[] = {17, 3, 9, 9, 0, 21, 5, 12, 1, 20};
+    for (int round = 0; round < 3; round++) {
+        for (int target : targets) {
+            ASSERT_EQ(cv_videocapture_read(cap, frame.get()), 1);
+            ASSERT_EQ(cv_videocapture_seek(cap, target), 1);
+            ASSERT_EQ(cv_videocapture_read(cap, frame.get()), 1);
+            ASSERT_EQ(cv_videocapture_position(cap), target) << "round " << round;
+            // 가장 가까운 기준 프레임이 목표 프레임이어야 함
+            int closest = -1;
+            double best = 0;
+            for (int i = 0; i < (int)reference.size(); i++) {
+                const double diff = test::mean_abs_diff(mat_of(frame)(label), reference[i](label));
+                if (closest < 0 || diff < best) {
+                    closest = i;
+                    best = diff;
+                }
+            }
+            EXPECT_EQ(closest, target) << "round " << round;
+            EXPECT_LT(best, 2.0) << "target " << target;
+        }
+    }
+    cv_videocapture_set_stabilizer(cap, nullptr);
+    cv_videocapture_release(cap);
+    cv_stabilizer_release(stabilizer);
+    std::remove(path.c_str());
+}
+
+// 부착 단계 (리맵 -> 안정화 -> 노이즈 제거 -> 통계/움직임) 를 거친 read
+TEST(VideoCapture, AttachedStages) {
+    const std::string path = test::temp_path("stages.avi");
+    if (!write_test_video(path, 10, 128, 96)) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+
+    CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, 2, 1);
+    ASSERT_NE(cap, nullptr);
+    // 좌우 반전 리맵
+    const double flip[6] = {-1, 0, 127, 0, 1, 0};
+    CvRemapCache* remap = cv_remap_cache_create_affine(flip, 128, 96, cv::INTER_NEAREST, cv::BORDER_REPLICATE);
+    CvStabilizer* stabilizer = cv_stabilizer_create(2, 1.0, 128);
+    CvTemporalDenoiser* denoiser = cv_temporal_denoiser_create(0, 3, 10, 0.5f, 30);
+    CvFrameStatsCollector* stats = cv_frame_stats_create(4, 2, 253);
+    CvMotionDetector* motion = cv_motion_detector_create(0, 64, 0.05, 25, 4);
+    cv_videocapture_set_remap(cap, remap);
+    cv_videocapture_set_stabilizer(cap, stabilizer);
+    cv_videocapture_set_denoiser(cap, denoiser);
+    cv_videocapture_set_frame_stats(cap, stats);
+    cv_videocapture_set_motion_detector(cap, motion);
+
+    MatPtr frame(cv_mat_create());
+    int frames = 0;
+    while (cv_videocapture_read(cap, frame.get())) {
+        EXPECT_EQ(mat_of(frame).cols, 128);
+        frames++;
+    }
+    // 안정화기 지연만큼 적게 반환
+    EXPECT_EQ(frames, 10 - 2);
+    EXPECT_EQ(cv_frame_stats_get(stats)->frameCount, (uint32_t)frames);
+    struct CvLatencyStats latency;
+    ASSERT_EQ(cv_videocapture_latency(cap, CV_LATENCY_PROCESS, &latency), 1);
+    EXPECT_EQ(latency.count, frames);
+
+    // 해제 순서: 캡처에서 떼어낸 뒤 각 단계 해제
+    cv_videocapture_set_remap(cap, nullptr);
+    cv_videocapture_set_stabilizer(cap, nullptr);
+    cv_videocapture_set_denoiser(cap, nullptr);
+    cv_videocapture_set_frame_stats(cap, nullptr);
+    cv_videocapture_set_motion_detector(cap, nullptr);
+    cv_videocapture_release(cap);
+    cv_motion_detector_release(motion);
+    cv_frame_stats_release(stats);
+    cv_temporal_denoiser_release(denoiser);
+    cv_stabilizer_release(stabilizer);
+    cv_remap_cache_release(remap);
+    std::remove(path.c_str());
+}
+
+// 지연 단계 (안정화 radius 2 + 멀티 프레임 디노이저 창 3) 를 거쳐도 위치는 출력 프레임의 원본 번호
+TEST(VideoCapture, DelayedStagesTiming) {
+    const std::string path = test::temp_path("delayed.avi");
+    if (!write_test_video(path, 10, 64, 48)) {
+        GTEST_SKIP() << "MJPG writer not available in this OpenCV build";
+    }
+
+    CvVideoCapture* cap = cv_videocapture_open(path.c_str(), 0, 0, 1);
+    ASSERT_NE(cap, nullptr);
+    CvStabilizer* stabilizer = cv_stabilizer_create(2, 1.0, 64);
+    CvTemporalDenoiser* denoiser = cv_temporal_denoiser_create(1, 3, 10, 0.5f, 30);
+    cv_videocapture_set_stabilizer(cap, stabilizer);
+    cv_videocapture_set_denoiser(cap, denoiser);
+
+    MatPtr frame(cv_mat_create());
+    std::vector<int> positions;
+    while (cv_videocapture_read(cap, frame.get())) positions.push_back(cv_videocapture_position(cap));
+    // 안정화기는 0..7, 디노이저는 그 창의 가운데인 1..6 을 출력
+    EXPECT_EQ(positions, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+
+    cv_videocapture_set_stabilizer(cap, nullptr);
+    cv_videocapture_set_denoiser(cap, nullptr);
+    cv_videocapture_release(cap);
+    cv_temporal_denoiser_release(denoiser);
+    cv_stabilizer_release(stabilizer);
+    std::remove(path.c_str());
+}
+
+TEST(Instrumentation, CallStats) {
+    cv_stats_enable(1);
+    if (!cv_stats_enabled()) {
+        GTEST_SKIP() << "built with FLUTTER_OPENCV_NO_PROFILING";
+    }
+    cv_stats_reset();
+    cv::Mat image = test::make_scene(64, 48, 3);
+    for (int i = 0; i < 5; i++) cv_mat_release(cv_gaussian_blur(handle(image), 5, 0));
+
+    const int count = cv_stats_snapshot(nullptr, 0);
+    ASSERT_GT(count, 0);
+    std::vector<struct CvCallStats> entries(count);
+    ASSERT_EQ(cv_stats_snapshot(entries.data(), count), count);
+    bool found = false;
+    for (const struct CvCallStats& entry : entries) {
+        if (std::strcmp(entry.name, "cv_gaussian_blur") != 0) continue;
+        found = true;
+        EXPECT_EQ(entry.calls, 5);
+        EXPECT_EQ(entry.pixels, 5 * 64 * 48);
+        EXPECT_EQ(entry.lastWidth, 64);
+        EXPECT_EQ(entry.lastHeight, 48);
+        EXPECT_LE(entry.minNs, entry.maxNs);
+        EXPECT_GT(entry.bytesAllocated, 0);
+    }
+    EXPECT_TRUE(found);
+
+    // JSON 버퍼는 malloc 으로 할당 (누수 확인용 반복)
+    for (int i = 0; i < 50; i++) {
+        struct BytesResult json = cv_stats_json();
+        ASSERT_NE(json.data, nullptr);
+        ASSERT_GT(json.len, 0);
+        const std::string text((const char*)json.data, json.len);
+        EXPECT_NE(text.find("cv_gaussian_blur"), std::string::npos);
+        cv_free_bytes(json);
+    }
+    cv_stats_reset();
+    EXPECT_EQ(cv_stats_snapshot(nullptr, 0), 0);
+    cv_stats_enable(0);
+    EXPECT_EQ(cv_stats_enabled(), 0);
+}
+
+TEST(Instrumentation, TraceExport) {
+    cv_trace_enable(1);
+    if (!cv_trace_enabled()) {
+        GTEST_SKIP() << "built with FLUTTER_OPENCV_NO_PROFILING";
+    }
+    cv_trace_reset();
+    cv_trace_set_thread_name("flutter_opencv_tests");
+    cv::Mat image = test::make_scene(320, 240, 3);
+    for (int i = 0; i < 3; i++) cv_mat_release(cv_binarize_document(handle(image), 0, 25, 0.2, 128, 2));
+
+    for (int i = 0; i < 20; i++) {
+        struct BytesResult trace = cv_trace_export();
+        ASSERT_NE(trace.data, nullptr);
+        const std::string text((const char*)trace.data, trace.len);
+        EXPECT_EQ(text.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+        EXPECT_NE(text.find("cv_binarize_document"), std::string::npos);
+        EXPECT_NE(text.find("flutter_opencv_tests"), std::string::npos);
+        cv_free_bytes(trace);
+    }
+    cv_trace_enable(0);
+    cv_trace_reset();
+}
+
+// Dart 에서 넘어온 스레드 이름은 JSON 문자열로 이스케이프되고, 32 바이트 제한에 잘린 UTF-8 문자는 버려짐
+TEST(Instrumentation, TraceExportEscapesThreadNames) {
+    cv_trace_enable(1);
+    if (!cv_trace_enabled()) {
+        GTEST_SKIP() << "built with FLUTTER_OPENCV_NO_PROFILING";
+    }
+    cv_trace_reset();
+    cv::Mat image(16, 16, CV_8UC1, cv::Scalar(0));
+    auto traced = [&](const char* name) {
+        std::thread([&] {
+            cv_trace_set_thread_name(name);
+            cv_mat_release(cv_threshold(handle(image), 100, 255, cv::THRESH_BINARY));
+        }).join();
+    };
+    traced("quote\" back\\slash\nline");
+    traced("\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C"
+           "\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C"); // "스레드" x 4 = 36 바이트
+
+    struct BytesResult trace = cv_trace_export();
+    ASSERT_NE(trace.data, nullptr);
+    const std::string text((const char*)trace.data, trace.len);
+    cv_free_bytes(trace);
+    EXPECT_NE(text.find("\"name\":\"quote\\\" back\\\\slash\\u000aline\""), std::string::npos) << text;
+    // 31 바이트 중 완전한 문자 10 개 (30 바이트) 만 남음
+    const std::string kept = "\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C\xEC\x8A\xA4\xEB\xA0\x88\xEB\x93\x9C\xEC\x8A\xA4";
+    EXPECT_NE(text.find("\"name\":\"" + kept + "\"}"), std::string::npos);
+    cv_trace_enable(0);
+    cv_trace_reset();
+}
@@ -0,0 +1,120 @@
+// 처리량 스모크 테스트: 1080p 프레임에서 주요 경로가 최소 처리량(MP/s) 이상인지 확인
+// 정밀 측정은 bench/ 의 Google Benchmark 로 하고, 여기서는 큰 회귀(경로가 느린 쪽으로 빠지는 등)만 잡음.
+// 하한은 저사양 CI 기준으로 넉넉하게 잡았으며 FLUTTER_OPENCV_THROUGHPUT_SCALE 로 조절 (0 이면 출력만)
+#include "test_util.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+using test::handle;
+
+namespace {
+
+double floor_scale() {
+    const char* env = std::getenv("FLUTTER_OPENCV_THROUGHPUT_SCALE");
+    return env != nullptr ? std::atof(env) : 1.0;
+}
+
+// 워밍업 1 회 후 최소 0.2 초 동안 반복 실행해 입력 메가픽셀/초를 반환
+double measure_mps(const cv::Mat& input, const std::function<void()>& call) {
+    using clock = std::chrono::steady_clock;
+    call();
+    int iterations = 0;
+    const clock::time_point start = clock::now();
+    double elapsed = 0;
+    do {
+        call();
+        iterations++;
+        elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    } while (elapsed < 0.2 || iterations < 3);
+    return input.total() * (double)iterations / elapsed / 1e6;
+}
+
+void expect_throughput(const std::string& name, const cv::Mat& input, double minMps, const std::function<void()>& call) {
+    const double mps = measure_mps(input, call);
+    const double required = minMps * floor_scale();
+    std::printf("[ throughput ] %-32s %9.1f MP/s (min %.1f)\n", name.c_str(), mps, required);
+    EXPECT_GE(mps, required) << name;
+}
+
+// 결과 Mat 을 바로 해제하는 호출 래퍼
+std::function<void()> releasing(const std::function<CvMat*()>& fn) {
+    return [fn] {
+        CvMat* out = fn();
+        ASSERT_NE(out, nullptr);
+        cv_mat_release(out);
+    };
+}
+
+const cv::Mat& frame_1080p() {
+    static const cv::Mat frame = test::make_scene(1920, 1080, 3);
+    return frame;
+}
+
+const cv::Mat& gray_1080p() {
+    static const cv::Mat gray = test::make_scene(1920, 1080, 1);
+    return gray;
+}
+
+} // namespace
+
+TEST(Throughput, ColorAndGeometry) {
+    const cv::Mat& frame = frame_1080p();
+    expect_throughput("cv_cvtColor_bgr2gray", frame, 100, releasing([&] { return cv_cvtColor_bgr2gray(handle(frame)); }));
+    expect_throughput("cv_cvtColor_bgr2hsv", frame, 40, releasing([&] { return cv_cvtColor_bgr2hsv(handle(frame)); }));
+    expect_throughput("cv_resize (area 1/4)", frame, 100, releasing([&] { return cv_resize(handle(frame), 480, 270, -1); }));
+    expect_throughput("cv_flip", frame, 100, releasing([&] { return cv_flip(handle(frame), 1); }));
+
+    const double affine[6] = {0.98, 0.05, 10, -0.05, 0.98, 12};
+    CvRemapCache* cache = cv_remap_cache_create_affine(affine, 1920, 1080, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+    ASSERT_NE(cache, nullptr);
+    expect_throughput("cv_remap_cache_apply", frame, 40, releasing([&] { return cv_remap_cache_apply(cache, handle(frame)); }));
+    cv_remap_cache_release(cache);
+}
+
+TEST(Throughput, Filters) {
+    const cv::Mat& frame = frame_1080p();
+    const cv::Mat& gray = gray_1080p();
+    expect_throughput("cv_gaussian_blur k5", frame, 30, releasing([&] { return cv_gaussian_blur(handle(frame), 5, 0); }));
+    expect_throughput("cv_erode k21 (vHGW)", gray, 50, releasing([&] { return cv_erode(handle(gray), 21, 1); }));
+    expect_throughput("cv_unsharp_mask", frame, 15, releasing([&] { return cv_unsharp_mask(handle(frame), 1.5, 0.8, 0); }));
+    expect_throughput("cv_binarize_document", gray, 15, releasing([&] { return cv_binarize_document(handle(gray), 0, 25, 0.2, 128, 2); }));
+    expect_throughput("cv_equalize_hist (color)", frame, 40, releasing([&] { return cv_equalize_hist(handle(frame)); }));
+
+    CvLut* lut = cv_lut_create();
+    cv_lut_contrast(lut, -1, 1.2, 128);
+    expect_throughput("cv_lut_apply", frame, 100, releasing([&] { return cv_lut_apply(lut, handle(frame)); }));
+    cv_lut_release(lut);
+}
+
+TEST(Throughput, CodecRoundTrip) {
+    const cv::Mat& frame = frame_1080p();
+    expect_throughput("cv_imencode .jpg", frame, 10, [&] {
+        struct BytesResult bytes = cv_imencode(".jpg", handle(frame));
+        ASSERT_NE(bytes.data, nullptr);
+        cv_free_bytes(bytes);
+    });
+    struct BytesResult jpeg = cv_imencode(".jpg", handle(frame));
+    ASSERT_NE(jpeg.data, nullptr);
+    expect_throughput("cv_imdecode .jpg", frame, 15, releasing([&] { return cv_imdecode(jpeg.data, jpeg.len); }));
+    cv_free_bytes(jpeg);
+}
+
+TEST(Throughput, StreamStages) {
+    const cv::Mat& frame = frame_1080p();
+    CvFrameStatsCollector* stats = cv_frame_stats_create(4, 2, 253);
+    expect_throughput("cv_frame_stats_compute step 4", frame, 200, [&] { ASSERT_EQ(cv_frame_stats_compute(stats, handle(frame)), 1); });
+    cv_frame_stats_release(stats);
+
+    CvMotionDetector* motion = cv_motion_detector_create(0, 320, 0.05, 25, 20);
+    expect_throughput("cv_motion_detector_process", frame, 40, [&] { ASSERT_EQ(cv_motion_detector_process(motion, handle(frame)), 1); });
+    cv_motion_detector_release(motion);
+
+    CvTemporalDenoiser* denoiser = cv_temporal_denoiser_create(0, 3, 10, 0.25f, 40);
+    cv::Mat out;
+    expect_throughput("cv_temporal_denoiser_process", frame, 40, [&] { ASSERT_EQ(cv_temporal_denoiser_process(denoiser, handle(frame), handle(out)), 1); });
+    cv_temporal_denoiser_release(denoiser);
+}
@@ -0,0 +1,61 @@
+// flutter_opencv_tests 공용 도우미: 결과 Mat 자동 해제, 합성 입력, 참조 결과 비교
+#pragma once
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "flutter_opencv.h"
+#include "testing/scenes.h"
+
+namespace test {
+
+// cv_* 가 반환한 Mat 을 범위를 벗어날 때 cv_mat_release 로 해제 (LSan 이 누수로 보지 않도록)
+struct MatDeleter {
+    void operator()(CvMat* mat) const { cv_mat_release(mat); }
+};
+using MatPtr = std::unique_ptr<CvMat, MatDeleter>;
+
+// C ABI 로 넘기기 위한 핸들 (읽기 전용 입력도 CvMat* 를 받음)
+inline CvMat* handle(const cv::Mat& mat) { return (CvMat*)&mat; }
+
+inline const cv::Mat& mat_of(const MatPtr& ptr) { return *(const cv::Mat*)ptr.get(); }
+
+// 합성 입력은 벤치마크와 공유 (testing/scenes.h)
+using scenes::make_chessboard;
+using scenes::make_document;
+using scenes::make_scene;
+using scenes::make_shadowed_page;
+using scenes::binarization_error;
+
+// 크기/타입이 같고 모든 원소의 차이가 tolerance 이하인지
+inline ::testing::AssertionResult mat_near(const cv::Mat& actual, const cv::Mat& expected, double tolerance) {
+    if (actual.size() != expected.size() || actual.type() != expected.type()) {
+        return ::testing::AssertionFailure() << "shape mismatch: " << actual.cols << "x" << actual.rows << " type " << actual.type()
+                                             << " vs " << expected.cols << "x" << expected.rows << " type " << expected.type();
+    }
+    if (actual.empty()) return ::testing::AssertionSuccess();
+    const double diff = cv::norm(actual, expected, cv::NORM_INF);
+    if (diff > tolerance) {
+        return ::testing::AssertionFailure() << "max difference " << diff << " > " << tolerance;
+    }
+    return ::testing::AssertionSuccess();
+}
+
+inline ::testing::AssertionResult mat_near(const MatPtr& actual, const cv::Mat& expected, double tolerance) {
+    if (actual == nullptr) return ::testing::AssertionFailure() << "result is nullptr";
+    return mat_near(mat_of(actual), expected, tolerance);
+}
+
+// 평균 절대 차이 (경계 반올림 차이만 허용할 때)
+inline double mean_abs_diff(const cv::Mat& a, const cv::Mat& b) {
+    if (a.size() != b.size() || a.type() != b.type()) return std::numeric_limits<double>::infinity();
+    return cv::norm(a, b, cv::NORM_L1) / (double)(a.total() * a.channels());
+}
+
+inline std::string temp_path(const std::string& name) { return ::testing::TempDir() + "flutter_opencv_" + name; }
+
+} // namespace test
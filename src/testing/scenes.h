@@ -0,0 +1,145 @@
+// 테스트(src/test) 와 벤치마크(src/bench) 가 함께 쓰는 결정적 합성 입력
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace scenes {
+
+// 그라디언트 배경 + 사각형/원/글자 + 노이즈 (에지, 코너, 평탄 영역, 텍스트가 고르게 섞임)
+inline cv::Mat make_scene(int width, int height, int channels, int seed = 1) {
+    cv::Mat bgr(height, width, CV_8UC3);
+    for (int y = 0; y < height; y++) {
+        cv::Vec3b* row = bgr.ptr<cv::Vec3b>(y);
+        for (int x = 0; x < width; x++) {
+            row[x] = cv::Vec3b((uchar)(x * 255 / width), (uchar)(y * 255 / height), (uchar)((x + y) * 127 / (width + height) + 64));
+        }
+    }
+    cv::RNG rng(seed);
+    const int scale = std::max(1, width / 640);
+    for (int i = 0; i < 40; i++) {
+        cv::Point p1(rng.uniform(0, width), rng.uniform(0, height));
+        cv::Point p2(p1.x + rng.uniform(10, 80) * scale, p1.y + rng.uniform(10, 80) * scale);
+        cv::Scalar color(rng.uniform(0, 255), rng.uniform(0, 255), rng.uniform(0, 255));
+        if (i % 2 == 0) {
+            cv::rectangle(bgr, p1, p2, color, i % 4 == 0 ? -1 : 2 * scale);
+        } else {
+            cv::circle(bgr, p1, rng.uniform(5, 40) * scale, color, 2 * scale);
+        }
+    }
+    for (int i = 0; i < 10; i++) {
+        cv::putText(bgr, "flutter_opencv 0123456789", cv::Point(rng.uniform(0, width / 2), rng.uniform(20, std::max(21, height))),
+                    cv::FONT_HERSHEY_SIMPLEX, 0.6 * scale, cv::Scalar(20, 20, 20), scale);
+    }
+    // 부호 있는 노이즈 (8U 로 채우면 음수가 0 으로 잘려 밝기가 치우침)
+    cv::Mat noise(height, width, CV_16SC3);
+    rng.fill(noise, cv::RNG::NORMAL, 0, 4);
+    cv::add(bgr, noise, bgr, cv::noArray(), CV_8UC3);
+
+    cv::Mat out;
+    if (channels == 1) {
+        cv::cvtColor(bgr, out, cv::COLOR_BGR2GRAY);
+    } else if (channels == 4) {
+        cv::cvtColor(bgr, out, cv::COLOR_BGR2BGRA);
+    } else {
+        out = bgr;
+    }
+    return out;
+}
+
+// 어두운 배경 위의 살짝 기울어진 밝은 문서 (corners: 좌상, 우상, 우하, 좌하)
+inline cv::Mat make_document(int width, int height, cv::Point2f* corners = nullptr) {
+    cv::Mat img(height, width, CV_8UC3, cv::Scalar(40, 45, 50));
+    const float w = (float)width, h = (float)height;
+    const cv::Point2f quad[4] = {
+        cv::Point2f(w * 0.18f, h * 0.10f),
+        cv::Point2f(w * 0.80f, h * 0.14f),
+        cv::Point2f(w * 0.84f, h * 0.90f),
+        cv::Point2f(w * 0.14f, h * 0.86f),
+    };
+    std::vector<cv::Point> page;
+    for (int i = 0; i < 4; i++) {
+        page.push_back(cv::Point(cvRound(quad[i].x), cvRound(quad[i].y)));
+        if (corners != nullptr) corners[i] = quad[i];
+    }
+    cv::fillConvexPoly(img, page, cv::Scalar(235, 235, 230));
+    // 줄 간격과 글자 크기는 해상도에 비례, 좁은 영상은 짧은 문장으로 페이지 안에 맞춤
+    const int scale = std::max(1, width / 640);
+    const int step = std::max((int)(h * 0.028f), 14 * scale);
+    const char* text = width >= 640 ? "Lorem ipsum dolor sit amet 12345" : "Lorem ipsum dolor";
+    for (int y = (int)(h * 0.18f); y < (int)(h * 0.82f); y += step) {
+        cv::putText(img, text, cv::Point((int)(w * 0.24f), y), cv::FONT_HERSHEY_SIMPLEX, 0.45 * scale, cv::Scalar(30, 30, 30), scale);
+    }
+    cv::GaussianBlur(img, img, cv::Size(3, 3), 0);
+    return img;
+}
+
+// 대각선 그림자와 비네팅이 드리운 글자 페이지 (그레이). textMask 에 글자 픽셀 = 255 인 정답 마스크를 기록
+// 이진화 결과(글자 = 0)와 비교해 픽셀 오류율을 잴 수 있도록 글자는 LINE_8 로 마스크에 먼저 그림
+inline cv::Mat make_shadowed_page(int width, int height, cv::Mat* textMask = nullptr, int seed = 1) {
+    static const char* const kLines[] = {
+        "The quick brown fox jumps over the lazy dog 0123456789",
+        "Sphinx of black quartz, judge my vow. PACK MY BOX",
+        "Lorem ipsum dolor sit amet, consectetur adipiscing",
+        "flutter_opencv document binarization ground truth",
+    };
+    cv::Mat mask(height, width, CV_8UC1, cv::Scalar(0));
+    const int scale = std::max(1, width / 640);
+    const int step = 24 * scale;
+    int line = 0;
+    for (int y = (int)(height * 0.06f) + step; y < (int)(height * 0.95f); y += step, line++) {
+        cv::putText(mask, kLines[line % 4], cv::Point((int)(width * 0.06f), y), cv::FONT_HERSHEY_SIMPLEX, 0.55 * scale, cv::Scalar(255), scale, cv::LINE_8);
+    }
+
+    // 반사율 (종이 225, 잉크 35) 에 약한 광학 블러
+    cv::Mat reflectance(height, width, CV_32FC1, cv::Scalar(225));
+    reflectance.setTo(cv::Scalar(35), mask);
+    cv::GaussianBlur(reflectance, reflectance, cv::Size(3, 3), 0);
+
+    // 조명: 부드러운 경계의 대각선 그림자 (최대 60% 감광) x 가장자리 비네팅
+    cv::Mat page(height, width, CV_32FC1);
+    for (int y = 0; y < height; y++) {
+        const float* r = reflectance.ptr<float>(y);
+        float* out = page.ptr<float>(y);
+        const float v = (float)y / height;
+        for (int x = 0; x < width; x++) {
+            const float u = (float)x / width;
+            const float shadow = 1.0f - 0.6f / (1.0f + std::exp(-(u * 0.8f + v * 0.6f - 0.75f) / 0.06f));
+            const float vignette = 1.0f - 0.6f * ((u - 0.5f) * (u - 0.5f) + (v - 0.5f) * (v - 0.5f));
+            out[x] = r[x] * shadow * vignette;
+        }
+    }
+    cv::Mat noise(height, width, CV_32FC1);
+    cv::RNG rng(seed);
+    rng.fill(noise, cv::RNG::NORMAL, 0, 3);
+    page += noise;
+
+    cv::Mat gray;
+    page.convertTo(gray, CV_8U);
+    if (textMask != nullptr) *textMask = mask;
+    return gray;
+}
+
+// 이진화 결과(글자 = 0, 배경 = 255)와 정답 글자 마스크가 다른 픽셀의 비율
+inline double binarization_error(const cv::Mat& binary, const cv::Mat& textMask) {
+    if (binary.size() != textMask.size() || binary.type() != CV_8UC1) return 1.0;
+    cv::Mat ink = binary == 0, truth = textMask > 0, wrong;
+    cv::compare(ink, truth, wrong, cv::CMP_NE);
+    return (double)cv::countNonZero(wrong) / (double)binary.total();
+}
+
+// 9x6 내부 코너 체스보드 (칸 크기 square, 여백 포함)
+inline cv::Mat make_chessboard(int width, int height, int square) {
+    cv::Mat board(height, width, CV_8UC1, cv::Scalar(255));
+    for (int y = 0; y < 7; y++) {
+        for (int x = 0; x < 10; x++) {
+            if ((x + y) % 2 == 0) cv::rectangle(board, cv::Rect((x + 2) * square, (y + 1) * square, square, square), cv::Scalar(0), -1);
+        }
+    }
+    return board;
+}
+
+} // namespace scenes